@@ -58,7 +58,7 @@ void PendSV_Handler(void);
 void SysTick_Handler(void);
 void TIM7_IRQHandler(void);
 /* USER CODE BEGIN EFP */
-
+void HSEM2_IRQHandler(void);
 /* USER CODE END EFP */
 
 #ifdef __cplusplus
@@ -0,0 +1,438 @@
+/**
+ ******************************************************************************
+  * @file		: ds_crc16.cpp
+  * @brief		: CRC16 engine source file
+  *				  This file contains the Modbus CRC16 with the table, slicing-by-8 and hardware backends
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+
+/*
+ * Begin of Includes
+ */
+#include "ds_crc16.hpp"
+// End of Includes
+
+
+
+/*
+ * Begin of Object Definitions
+ */
+Tools::CRC16 crc16;
+//End of Object Definitions
+
+
+
+namespace Tools
+{
+
+
+
+/*
+ * Begin of Local Constant Definitions
+ */
+static const uint16_t CRC16_REFLECTED_POLYNOMIAL = 0xA001;
+
+// CRC high byte table
+static const uint8_t CRC_HI[] =
+{
+    0x00, 0xC1, 0x81, 0x40, 0x01, 0xC0, 0x80, 0x41, 0x01, 0xC0, 0x80, 0x41, 0x00, 0xC1, 0x81,
+    0x40, 0x01, 0xC0, 0x80, 0x41, 0x00, 0xC1, 0x81, 0x40, 0x00, 0xC1, 0x81, 0x40, 0x01, 0xC0,
+    0x80, 0x41, 0x01, 0xC0, 0x80, 0x41, 0x00, 0xC1, 0x81, 0x40, 0x00, 0xC1, 0x81, 0x40, 0x01,
+    0xC0, 0x80, 0x41, 0x00, 0xC1, 0x81, 0x40, 0x01, 0xC0, 0x80, 0x41, 0x01, 0xC0, 0x80, 0x41,
+    0x00, 0xC1, 0x81, 0x40, 0x01, 0xC0, 0x80, 0x41, 0x00, 0xC1, 0x81, 0x40, 0x00, 0xC1, 0x81,
+    0x40, 0x01, 0xC0, 0x80, 0x41, 0x00, 0xC1, 0x81, 0x40, 0x01, 0xC0, 0x80, 0x41, 0x01, 0xC0,
+    0x80, 0x41, 0x00, 0xC1, 0x81, 0x40, 0x00, 0xC1, 0x81, 0x40, 0x01, 0xC0, 0x80, 0x41, 0x01,
+    0xC0, 0x80, 0x41, 0x00, 0xC1, 0x81, 0x40, 0x01, 0xC0, 0x80, 0x41, 0x00, 0xC1, 0x81, 0x40,
+    0x00, 0xC1, 0x81, 0x40, 0x01, 0xC0, 0x80, 0x41, 0x01, 0xC0, 0x80, 0x41, 0x00, 0xC1, 0x81,
+    0x40, 0x00, 0xC1, 0x81, 0x40, 0x01, 0xC0, 0x80, 0x41, 0x00, 0xC1, 0x81, 0x40, 0x01, 0xC0,
+    0x80, 0x41, 0x01, 0xC0, 0x80, 0x41, 0x00, 0xC1, 0x81, 0x40, 0x00, 0xC1, 0x81, 0x40, 0x01,
+    0xC0, 0x80, 0x41, 0x01, 0xC0, 0x80, 0x41, 0x00, 0xC1, 0x81, 0x40, 0x01, 0xC0, 0x80, 0x41,
+    0x00, 0xC1, 0x81, 0x40, 0x00, 0xC1, 0x81, 0x40, 0x01, 0xC0, 0x80, 0x41, 0x00, 0xC1, 0x81,
+    0x40, 0x01, 0xC0, 0x80, 0x41, 0x01, 0xC0, 0x80, 0x41, 0x00, 0xC1, 0x81, 0x40, 0x01, 0xC0,
+    0x80, 0x41, 0x00, 0xC1, 0x81, 0x40, 0x00, 0xC1, 0x81, 0x40, 0x01, 0xC0, 0x80, 0x41, 0x01,
+    0xC0, 0x80, 0x41, 0x00, 0xC1, 0x81, 0x40, 0x00, 0xC1, 0x81, 0x40, 0x01, 0xC0, 0x80, 0x41,
+    0x00, 0xC1, 0x81, 0x40, 0x01, 0xC0, 0x80, 0x41, 0x01, 0xC0, 0x80, 0x41, 0x00, 0xC1, 0x81,
+    0x40
+};
+
+
+// CRC low byte table
+static const uint8_t CRC_LO[] =
+{
+    0x00, 0xC0, 0xC1, 0x01, 0xC3, 0x03, 0x02, 0xC2, 0xC6, 0x06, 0x07, 0xC7, 0x05, 0xC5, 0xC4,
+    0x04, 0xCC, 0x0C, 0x0D, 0xCD, 0x0F, 0xCF, 0xCE, 0x0E, 0x0A, 0xCA, 0xCB, 0x0B, 0xC9, 0x09,
+    0x08, 0xC8, 0xD8, 0x18, 0x19, 0xD9, 0x1B, 0xDB, 0xDA, 0x1A, 0x1E, 0xDE, 0xDF, 0x1F, 0xDD,
+    0x1D, 0x1C, 0xDC, 0x14, 0xD4, 0xD5, 0x15, 0xD7, 0x17, 0x16, 0xD6, 0xD2, 0x12, 0x13, 0xD3,
+    0x11, 0xD1, 0xD0, 0x10, 0xF0, 0x30, 0x31, 0xF1, 0x33, 0xF3, 0xF2, 0x32, 0x36, 0xF6, 0xF7,
+    0x37, 0xF5, 0x35, 0x34, 0xF4, 0x3C, 0xFC, 0xFD, 0x3D, 0xFF, 0x3F, 0x3E, 0xFE, 0xFA, 0x3A,
+    0x3B, 0xFB, 0x39, 0xF9, 0xF8, 0x38, 0x28, 0xE8, 0xE9, 0x29, 0xEB, 0x2B, 0x2A, 0xEA, 0xEE,
+    0x2E, 0x2F, 0xEF, 0x2D, 0xED, 0xEC, 0x2C, 0xE4, 0x24, 0x25, 0xE5, 0x27, 0xE7, 0xE6, 0x26,
+    0x22, 0xE2, 0xE3, 0x23, 0xE1, 0x21, 0x20, 0xE0, 0xA0, 0x60, 0x61, 0xA1, 0x63, 0xA3, 0xA2,
+    0x62, 0x66, 0xA6, 0xA7, 0x67, 0xA5, 0x65, 0x64, 0xA4, 0x6C, 0xAC, 0xAD, 0x6D, 0xAF, 0x6F,
+    0x6E, 0xAE, 0xAA, 0x6A, 0x6B, 0xAB, 0x69, 0xA9, 0xA8, 0x68, 0x78, 0xB8, 0xB9, 0x79, 0xBB,
+    0x7B, 0x7A, 0xBA, 0xBE, 0x7E, 0x7F, 0xBF, 0x7D, 0xBD, 0xBC, 0x7C, 0xB4, 0x74, 0x75, 0xB5,
+    0x77, 0xB7, 0xB6, 0x76, 0x72, 0xB2, 0xB3, 0x73, 0xB1, 0x71, 0x70, 0xB0, 0x50, 0x90, 0x91,
+    0x51, 0x93, 0x53, 0x52, 0x92, 0x96, 0x56, 0x57, 0x97, 0x55, 0x95, 0x94, 0x54, 0x9C, 0x5C,
+    0x5D, 0x9D, 0x5F, 0x9F, 0x9E, 0x5E, 0x5A, 0x9A, 0x9B, 0x5B, 0x99, 0x59, 0x58, 0x98, 0x88,
+    0x48, 0x49, 0x89, 0x4B, 0x8B, 0x8A, 0x4A, 0x4E, 0x8E, 0x8F, 0x4F, 0x8D, 0x4D, 0x4C, 0x8C,
+    0x44, 0x84, 0x85, 0x45, 0x87, 0x47, 0x46, 0x86, 0x82, 0x42, 0x43, 0x83, 0x41, 0x81, 0x80,
+    0x40
+};
+
+/**
+ * @brief Slicing-by-8 tables, value[k][x] is the CRC of byte x followed by k zero bytes
+ */
+struct crc16_slicing_table_type
+{
+	uint16_t value[CRC16_SLICE_SIZE][256];
+};
+
+static constexpr crc16_slicing_table_type makeSlicingTable(void)
+{
+	crc16_slicing_table_type table = {};
+	uint16_t				 crc   = 0;
+	uint16_t				 index = 0;
+	uint8_t					 slice = 0;
+	uint8_t					 bit   = 0;
+
+	for(index = 0; index < 256; index++)
+	{
+		crc = index;
+		for(bit = 0; bit < 8; bit++)
+		{
+			crc = ((crc & 1U) != 0U) ? static_cast<uint16_t>((crc >> 1) ^ CRC16_REFLECTED_POLYNOMIAL) : static_cast<uint16_t>(crc >> 1);
+		}
+		table.value[0][index] = crc;
+	}
+
+	for(slice = 1; slice < CRC16_SLICE_SIZE; slice++)
+	{
+		for(index = 0; index < 256; index++)
+		{
+			crc = table.value[slice - 1][index];
+			table.value[slice][index] = static_cast<uint16_t>((crc >> 8) ^ table.value[0][crc & 0xFFU]);
+		}
+	}
+
+	return table;
+}
+
+static constexpr crc16_slicing_table_type SLICING_TABLE = makeSlicingTable();	///< Built by the compiler, placed in the flash
+//End of Local Constant Definitions
+
+
+
+/**
+  * @brief 		Loads the INIT register into the CRC unit
+  */
+static inline void resetCrcUnit(CRC_TypeDef *crc_unit)
+{
+#ifdef DS_SIMULATION
+	simulateCrcReset(crc_unit);
+#else
+	SET_BIT(crc_unit->CR, CRC_CR_RESET);
+#endif
+}
+
+
+
+/**
+  * @brief 		Feeds one byte into the CRC unit
+  */
+static inline void writeCrcByte(CRC_TypeDef *crc_unit, uint8_t data)
+{
+#ifdef DS_SIMULATION
+	simulateCrcData(crc_unit, data, 1);
+#else
+	*reinterpret_cast<volatile uint8_t *>(&crc_unit->DR) = data;
+#endif
+}
+
+
+
+/**
+  * @brief 		Feeds four bytes into the CRC unit, the most significant byte first
+  */
+static inline void writeCrcWord(CRC_TypeDef *crc_unit, uint32_t data)
+{
+#ifdef DS_SIMULATION
+	simulateCrcData(crc_unit, data, 4);
+#else
+	WRITE_REG(crc_unit->DR, data);
+#endif
+}
+
+
+
+/**
+  * @brief Default constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+CRC16::CRC16():
+backend(crc16_backend_type::SLICING_BY_8), hardware_ready(false), hardware_busy(false)
+{ }
+
+
+
+/**
+  * @brief 		Sets up the CRC unit for the Modbus CRC16 and selects it. Only the CM7 uses
+  *				the unit, the CM4 keeps the slicing-by-8 backend.
+  *
+  * @param[in]  void
+  *
+  * @return 	bool	true if the hardware backend is selected
+  */
+bool CRC16::initialize(void)
+{
+#ifdef CORE_CM7
+	__HAL_RCC_CRC_CLK_ENABLE();
+
+	WRITE_REG(CRC->POL, CRC16_POLYNOMIAL);
+	WRITE_REG(CRC->CR, CRC_CR_POLYSIZE_0 | CRC_CR_REV_IN_0 | CRC_CR_REV_OUT);	///< 16 bit, input reversed by byte, output reversed
+	WRITE_REG(CRC->INIT, CRC16_INIT);
+
+	hardware_ready = true;
+	backend		   = crc16_backend_type::HARDWARE;
+#endif
+
+	return hardware_ready;
+}
+
+
+
+/**
+  * @brief 		Selects the backend of calculate
+  *
+  * @param[in]  crc16_backend_type crc_backend
+  *
+  * @return 	bool	false if the hardware backend is requested before initialize
+  */
+bool CRC16::setBackend(crc16_backend_type crc_backend)
+{
+	if( (crc_backend == crc16_backend_type::HARDWARE) && (hardware_ready == false) )
+	{
+		return false;
+	}
+
+	backend = crc_backend;
+	return true;
+}
+
+
+
+crc16_backend_type CRC16::getBackend(void) const
+{
+	return backend;
+}
+
+
+
+/**
+  * @brief 		Calculates the CRC16 with the selected backend
+  *
+  * @param[in]  const uint8_t data[]
+  * @param[in]  uint32_t length
+  * @param[in]  uint16_t crc : CRC16_INIT or the result of the previous block
+  *
+  * @return 	uint16_t crc, low byte is sent first
+  */
+uint16_t CRC16::calculate(const uint8_t data[], uint32_t length, uint16_t crc)
+{
+	return calculate(backend, data, length, crc);
+}
+
+
+
+/**
+  * @brief 		Calculates the CRC16 with the given backend, e.g. for comparisons
+  *
+  * @param[in]  crc16_backend_type crc_backend
+  * @param[in]  const uint8_t data[]
+  * @param[in]  uint32_t length
+  * @param[in]  uint16_t crc : CRC16_INIT or the result of the previous block
+  *
+  * @return 	uint16_t crc
+  */
+uint16_t CRC16::calculate(crc16_backend_type crc_backend, const uint8_t data[], uint32_t length, uint16_t crc)
+{
+	switch(crc_backend)
+	{
+		case crc16_backend_type::TABLE:
+			crc = calculateTable(data, length, crc);
+			break;
+
+		case crc16_backend_type::HARDWARE:
+			if( (hardware_ready == true) && (hardware_busy == false) )
+			{
+				hardware_busy = true;
+				crc = calculateHardware(data, length, crc);
+				hardware_busy = false;
+			}
+			else
+			{
+				hardware_fallback_counter++;
+				crc = calculateSlicingBy8(data, length, crc);
+			}
+			break;
+
+		default:
+			crc = calculateSlicingBy8(data, length, crc);
+			break;
+	}
+
+	return crc;
+}
+
+
+
+/**
+  * @brief 		Folds one byte into a running CRC, for parsers which check a frame while it
+  *				arrives. Always software, a byte is too short to pay for the hardware unit.
+  *
+  * @param[in]  uint16_t crc : CRC16_INIT at the first byte or the result of the previous one
+  * @param[in]  uint8_t data
+  *
+  * @return 	uint16_t crc
+  */
+uint16_t CRC16::update(uint16_t crc, uint8_t data)
+{
+	return (crc >> 8) ^ SLICING_TABLE.value[0][(crc ^ data) & 0xFFU];
+}
+
+
+
+/**
+  * @brief 		One byte per step, the original Modbus recipe
+  */
+uint16_t CRC16::calculateTable(const uint8_t data[], uint32_t length, uint16_t crc)
+{
+	uint8_t	 crc_hi = static_cast<uint8_t>(crc >> 8);
+	uint8_t	 crc_lo = static_cast<uint8_t>(crc);
+	uint8_t	 index	= 0;
+	uint32_t k		= 0;
+
+	for(k = 0; k < length; k++)
+	{
+		index  = crc_lo ^ data[k];
+		crc_lo = crc_hi ^ CRC_HI[index];
+		crc_hi = CRC_LO[index];
+	}
+
+	return (static_cast<uint16_t>(crc_hi) << 8) | crc_lo;
+}
+
+
+
+/**
+  * @brief 		Eight bytes per step, the eight table lookups do not depend on each other
+  */
+uint16_t CRC16::calculateSlicingBy8(const uint8_t data[], uint32_t length, uint16_t crc)
+{
+	const uint16_t (&table)[CRC16_SLICE_SIZE][256] = SLICING_TABLE.value;
+
+	while(length >= CRC16_SLICE_SIZE)
+	{
+		crc = table[7][(data[0] ^ crc) & 0xFFU] ^ table[6][(data[1] ^ (crc >> 8)) & 0xFFU] ^
+			  table[5][data[2]] ^ table[4][data[3]] ^ table[3][data[4]] ^
+			  table[2][data[5]] ^ table[1][data[6]] ^ table[0][data[7]];
+
+		data   += CRC16_SLICE_SIZE;
+		length -= CRC16_SLICE_SIZE;
+	}
+
+	while(length > 0U)
+	{
+		crc = (crc >> 8) ^ table[0][(crc ^ *data) & 0xFFU];
+		data++;
+		length--;
+	}
+
+	return crc;
+}
+
+
+
+/**
+  * @brief 		Feeds the unaligned head and tail by byte and the rest by word. The unit works
+  *				on the unreflected value, so a continued crc is reversed into INIT.
+  */
+uint16_t CRC16::calculateHardware(const uint8_t data[], uint32_t length, uint16_t crc)
+{
+	WRITE_REG(CRC->INIT, __RBIT(crc) >> 16);
+	resetCrcUnit(CRC);
+
+	while( (length > 0U) && ((reinterpret_cast<uintptr_t>(data) & 0x3U) != 0U) )
+	{
+		writeCrcByte(CRC, *data);
+		data++;
+		length--;
+	}
+
+	while(length >= sizeof(uint32_t))
+	{
+		writeCrcWord(CRC, __REV(*reinterpret_cast<const uint32_t *>(data)));	///< First byte of the stream into bits 31:24
+		data   += sizeof(uint32_t);
+		length -= sizeof(uint32_t);
+	}
+
+	while(length > 0U)
+	{
+		writeCrcByte(CRC, *data);
+		data++;
+		length--;
+	}
+
+	return static_cast<uint16_t>(READ_REG(CRC->DR));
+}
+
+
+
+/**
+  * @brief Default copy constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+CRC16::CRC16(const CRC16& orig):
+backend(crc16_backend_type::SLICING_BY_8), hardware_ready(false), hardware_busy(false)
+{ }
+
+
+
+/**
+  * @brief Default destructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+CRC16::~CRC16()
+{ }
+
+
+
+} //End of namespace Tools
@@ -0,0 +1,131 @@
+/**
+ ******************************************************************************
+  * @file		: ds_crc16.hpp
+  * @brief		: CRC16 engine header file
+  *				  This file contains the Modbus CRC16 with the table, slicing-by-8 and hardware backends
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+#ifndef DS_CRC16_HPP
+#define	DS_CRC16_HPP
+
+
+
+/*
+ * Begin of Includes
+ */
+#include <stdint.h>
+#include "main.h"
+// End of Includes
+
+
+
+namespace Tools
+{
+
+
+
+/*
+ * Begin of Macro Definitions
+ */
+const uint16_t CRC16_INIT			= 0xFFFF;	///< Modbus initial value, also the value to continue from after a block
+const uint16_t CRC16_POLYNOMIAL		= 0x8005;	///< Normal form, the reflected form is 0xA001
+const uint8_t  CRC16_SLICE_SIZE		= 8;
+//End of Macro Definitions
+
+
+
+/*
+ * Begin of Enum, Union and Struct Definitions
+ */
+/**
+ * @brief The implementations give bit identical results
+ */
+enum class crc16_backend_type : uint8_t
+{
+	TABLE			= 0x00,		///< One byte per step with the CRC_HI/CRC_LO tables
+	SLICING_BY_8	= 0x01,		///< Eight bytes per step with 8 x 256 entry tables
+	HARDWARE		= 0x02,		///< CRC unit of the D3 domain, CM7 only
+};
+// End of Enum, Union and Struct Definitions
+
+
+
+/*
+ * Begin of CRC16 Class Definition
+ */
+/**
+ * @brief Modbus CRC16 (reflected 0x8005, initial 0xFFFF, no final xor) of every telemetry link.
+ *		  A block can be continued by passing the result of the previous block as crc.
+ *		  The hardware unit is not reentrant, a call which interrupts a hardware calculation
+ *		  falls back to slicing-by-8.
+ */
+class CRC16
+{
+	public:
+		CRC16();
+
+		uint32_t hardware_fallback_counter = 0;	///< Hardware calls run in software: unit busy or not initialized
+
+		bool			   initialize	( void );
+		bool			   setBackend	( crc16_backend_type crc_backend );
+		crc16_backend_type getBackend	( void ) const;
+		uint16_t		   calculate	( const uint8_t data[], uint32_t length, uint16_t crc = CRC16_INIT );
+		uint16_t		   calculate	( crc16_backend_type crc_backend, const uint8_t data[], uint32_t length, uint16_t crc = CRC16_INIT );
+
+		static uint16_t	   update		( uint16_t crc, uint8_t data );
+
+		CRC16(const CRC16& orig);
+		virtual ~CRC16();
+
+	protected:
+
+	private:
+		crc16_backend_type backend;
+		bool			   hardware_ready;
+		volatile bool	   hardware_busy;
+
+		static uint16_t	calculateTable			( const uint8_t data[], uint32_t length, uint16_t crc );
+		static uint16_t	calculateSlicingBy8		( const uint8_t data[], uint32_t length, uint16_t crc );
+		uint16_t		calculateHardware		( const uint8_t data[], uint32_t length, uint16_t crc );
+};
+// End of CRC16 Class Definition
+
+
+
+} //End of namespace Tools
+
+
+
+/*
+ * External Linkages
+ */
+extern Tools::CRC16 crc16;
+
+#ifdef DS_SIMULATION
+extern void simulateCrcReset	( CRC_TypeDef *crc_unit );								///< Host simulation, loads INIT into the modelled CRC unit
+extern void simulateCrcData		( CRC_TypeDef *crc_unit, uint32_t data, uint8_t size );	///< Host simulation, feeds a DR write of 1, 2 or 4 bytes
+#endif
+// End of External Linkages
+
+
+#endif	/* DS_CRC16_HPP */
@@ -672,7 +672,8 @@ void DATA_LOGGER::formatDate(uint16_t input, char *output)
 
 
 /**
-  * @brief 		  TBD
+  * @brief 		  Sets the packet to be written in the storage device. The buffer is written
+  *             in place, it must stay valid until write_storage_device is cleared
   *
   * @param[in]  uint8_t buffer[]
   *             uint16_t buffer_size
@@ -681,17 +682,10 @@ void DATA_LOGGER::formatDate(uint16_t input, char *output)
   */
 void DATA_LOGGER::setPacket(uint8_t buffer[], uint16_t buffer_size)
 {
-	uint16_t k = 0;
-	uint16_t max_buffer_size = sizeof(receive_buffer);
-
-	if(buffer_size <= max_buffer_size)
+	if(buffer_size <= MAX_SIZE_WRITE)
 	{
 		error_flags.bits.set_packet_size_err = 0;
-
-		for(k = 0; k < buffer_size; k++)
-		{
-			receive_buffer[k] = buffer[k];
-		}
+		receive_buffer = buffer;
 	}
 	else
 	{
@@ -193,7 +193,7 @@ class DATA_LOGGER
 
 		uint32_t storage_free_space_kb = 0;
 		uint32_t storage_capacity_kb = 0;
-		uint8_t receive_buffer[MAX_SIZE_WRITE] = {};
+		uint8_t *receive_buffer = nullptr;   ///< Records in the shared buffer slot, owned by the serializer until written
 		uint16_t receive_buffer_size = 0;
 
 		char w_file_name[FILE_NAME_LENGHT] = "DASAL_10102020_121212.DAT";
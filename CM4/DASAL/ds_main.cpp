@@ -48,6 +48,20 @@ SCHEDULER task;
 
 
 
+/**
+  * @brief 		Data ready notification of the inter-core ring, called from the HSEM interrupt
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+static void coreDataReady( void )
+{
+	task.setCoreDataReady();
+}
+
+
+
 /**
   * @brief Default constructor
   *
@@ -57,7 +71,8 @@ SCHEDULER task;
   */
 SCHEDULER::SCHEDULER() :
 task_tick(0),
-task_counter(0)
+task_counter(0),
+core_data_ready(false)
 { }
 
 
@@ -73,6 +88,7 @@ void SCHEDULER::init( void )
 {
 	led.initialize();
 	inter_core.initialize();
+	inter_core.setDataReadyNotification(coreDataReady);
 	serializer.initialize();
 }
 
@@ -87,7 +103,11 @@ void SCHEDULER::init( void )
   */
 void SCHEDULER::task800Hz( void )
 {
-	inter_core.scheduler();
+	if(core_data_ready == true)
+	{
+		core_data_ready = false;
+		telemetry_core.parseReceivedData();
+	}
 }
 
 
@@ -130,6 +150,12 @@ void SCHEDULER::task200Hz( void )
 void SCHEDULER::task100Hz( void )
 {
 	led.scheduler();
+
+	inter_core.scheduler();
+	if(inter_core.isDataAvailable() == true)	///< Data left behind by a parser call which hit its buffer limit
+	{
+		core_data_ready = true;
+	}
 }
 
 
@@ -157,7 +183,6 @@ void SCHEDULER::task50Hz( void )
   */
 void SCHEDULER::task20Hz( void )
 {
-	telemetry_core.parseReceivedData();
 	serializer.scheduler();
 }
 
@@ -352,6 +377,20 @@ void SCHEDULER::setTick( void )
 
 
 
+/**
+  * @brief 		Wakes the core telemetry parser in the next tick
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void SCHEDULER::setCoreDataReady( void )
+{
+	core_data_ready = true;
+}
+
+
+
 /**
   * @brief 		C++ to C wrapper function for STM32
   *
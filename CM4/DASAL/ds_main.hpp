@@ -67,6 +67,7 @@ class SCHEDULER
 			void task800Hz	( void );
 			void main		( void );
 			void setTick	( void );
+			void setCoreDataReady( void );
 			
 			SCHEDULER(const SCHEDULER& orig);
 			virtual ~SCHEDULER();
@@ -74,12 +75,21 @@ class SCHEDULER
     private:
 			uint8_t 	task_tick;
 			uint64_t 	task_counter;
+			volatile bool core_data_ready;	///< Set by the HSEM interrupt when the CM7 wrote the inter-core ring
 		
 };
 // End of SCHEDULER Class Definition
 
 
 
+/*
+ * External Linkages
+ */
+extern SCHEDULER task;
+// End of External Linkages
+
+
+
 extern "C"
 {
 #endif
@@ -27,6 +27,7 @@
  * Begin of Includes
  */
 #include <string.h>
+#include <atomic>
 #include "ds_serializer.hpp"
 #include "ds_datalogger.hpp"
 #include "ds_telemetry_core.hpp"
@@ -47,6 +48,10 @@ namespace Datalogger
 
 
 
+static_assert( sizeof(gnss_date_and_time_t) == DATE_AND_TIME_SIZE, "Date and time does not fit the master state" );
+
+
+
 /**
   * @brief      Default constructor
   *
@@ -71,7 +76,9 @@ SERIALIZER::SERIALIZER()
   */
 void SERIALIZER::initialize(void)
 {
+	slave_link.initialize();
 	setSlaveSharedBufferIndex();
+	slave_link.publish();
 }
 
 
@@ -87,6 +94,8 @@ void SERIALIZER::scheduler(void)
 {
 	static serializer_state_t serializer_state = serializer_state_t::STAND_BY;
 
+	master_link.update();
+
 	if(!slave_err_flags.bits.shared_buff_err)
 	{
 		if(!datalogger.status_flags.bits.config_params_received)
@@ -101,6 +110,11 @@ void SERIALIZER::scheduler(void)
 			getDateAndTime();
 		}
 
+		if(!datalogger.status_flags.bits.write_storage_device)
+		{
+			releaseSharedSlot();
+		}
+
 		if(getMasterCommand())
 		{
 			switch(serializer_state)
@@ -148,13 +162,10 @@ void SERIALIZER::scheduler(void)
 									{
 										if(shared_buffer_status == FULL)
 										{
-											if(readFromSharedBuffer())
+											if(claimSharedSlot())
 											{
 												slave_err_flags.bits.receive_packet_err = 0;
-												shared_buffer_status = 0;
-												setSharedBufferStatus();
 												datalogger.status_flags.bits.write_storage_device = 1;
-												datalogger.setPacket(datalogger_buffer, (packet_size * packet_count_write));
 											}
 											else
 											{
@@ -196,13 +207,15 @@ void SERIALIZER::scheduler(void)
 	}
 
 	setSlaveStatus();
+	slave_link.publish();
+
 	datalogger.scheduler();
 }
 
 
 
 /**
-  * @brief 		  Receives the date and time information from the master
+  * @brief 		  Gets the date and time information from the master state
   *
   * @param[in]  void	Nothing
   *
@@ -210,15 +223,11 @@ void SERIALIZER::scheduler(void)
   */
 bool SERIALIZER::getDateAndTime(void)
 {
-	const uint16_t BUFFER_SIZE = sizeof(datalogger.gnss_date_and_time.buffer);
-		    uint8_t  get_buffer[BUFFER_SIZE] = {0};
-		    bool     success = false;
-
-	success = telemetry_core.receivePacketFromSharedBuff(DATE_AND_TIME_ADDR, get_buffer, BUFFER_SIZE);
+	bool success = master_link.isValid();
 
 	if(success == true)
 	{
-		memcpy(datalogger.gnss_date_and_time.buffer,get_buffer,BUFFER_SIZE);
+		memcpy(datalogger.gnss_date_and_time.buffer,master_link.state.date_and_time,DATE_AND_TIME_SIZE);
 		slave_err_flags.bits.get_date_time_err = 0;
 	}
 	else
@@ -233,36 +242,71 @@ bool SERIALIZER::getDateAndTime(void)
 
 
 /**
-  * @brief 		  Receives packet from the shared buffer
+  * @brief 		  Checks the records of the full slot in place and hands them to the datalogger,
+  *             the slot stays FULL until the datalogger has written it
   *
   * @param[in]  void	Nothing
   *
   * @return 	  bool	success
   */
-bool SERIALIZER::readFromSharedBuffer(void)
+bool SERIALIZER::claimSharedSlot(void)
 {
-	uint32_t destination_addr = SHARED_BUFFER_BASE_ADDR + (shared_buffer_index_slave * SHARED_BUFFER_SIZE);
+	const uint32_t slot_addr = SHARED_BUFFER_BASE_ADDR + (shared_buffer_index_slave * SHARED_BUFFER_SIZE);
+	const shared_slot_header_t *header = reinterpret_cast<const shared_slot_header_t *>(slot_addr);
+	uint8_t *records = reinterpret_cast<uint8_t *>(slot_addr + SHARED_SLOT_DATA_OFFSET);
 	bool success = false;
 	uint16_t z = 0;
 
-	for(z = 0; z<packet_count_write; z++)
+	std::atomic_thread_fence(std::memory_order_acquire); /* The FULL status is read before the slot */
+
+	if((packet_count_write <= SHARED_SLOT_MAX_PACKET)&&
+	   (header->command == static_cast<uint16_t>(cmd_type::SHARED_BUFFER))&&
+	   (header->packet_size == packet_size)&&
+	   (header->packet_count == packet_count_write))
 	{
-		success = telemetry_core.receivePacketFromSharedBuff((destination_addr + (z * (packet_size + static_cast<uint32_t>(9)))),
-				                                                 &datalogger_buffer[z * packet_size],
-															                           packet_size);
+		success = true;
 
-		if(success == false)
+		for(z = 0; (z < packet_count_write) && (success == true); z++)
 		{
-			shared_buff_err_cntr++;
-			return success;
+			success = (telemetry_core.calculatePacketCrc(&records[z * packet_size], packet_size) == header->crc[z]);
 		}
 	}
 
+	if(success == true)
+	{
+		held_slot_index = shared_buffer_index_slave;
+		slot_held = true;
+		datalogger.setPacket(records, (packet_size * packet_count_write));
+	}
+	else
+	{
+		shared_buff_err_cntr++;
+	}
+
 	return success;
 }
 
 
 
+/**
+  * @brief 		  Gives the slot written by the datalogger back to the master
+  *
+  * @param[in]  void	Nothing
+  *
+  * @return 	  void	Nothing
+  */
+void SERIALIZER::releaseSharedSlot(void)
+{
+	if(slot_held)
+	{
+		slot_held = false;
+		shared_buffer_status = EMPTY;
+		setSharedBufferStatus(held_slot_index);
+	}
+}
+
+
+
 /**
   * @brief 		  Increases the slave shared buffer index
   *
@@ -285,7 +329,7 @@ void SERIALIZER::increaseSlaveSharedBufferIndex(void)
 
 
 /**
-  * @brief 		  Sets the slave status byte(s)
+  * @brief 		  Sets the slave status byte(s) of the slave state
   *
   * @param[in]  void	Nothing
   *
@@ -293,26 +337,15 @@ void SERIALIZER::increaseSlaveSharedBufferIndex(void)
   */
 void SERIALIZER::setSlaveStatus(void)
 {
-	const uint16_t BUFFER_SIZE = sizeof(slave_status_flags.all) +
-								 sizeof(datalogger.error_flags.all) +
-								 sizeof(datalogger.datalogger_err_cntr);
-
-		    uint8_t  set_buffer[BUFFER_SIZE] = {0};
-
-	memcpy(set_buffer,&slave_status_flags.all,sizeof(slave_status_flags.all) );
-	memcpy(&set_buffer[sizeof(slave_status_flags.all)],&datalogger.error_flags.all,sizeof(datalogger.error_flags.all));
-	memcpy(&set_buffer[sizeof(slave_status_flags.all) + sizeof(datalogger.error_flags.all)],&datalogger.datalogger_err_cntr,sizeof(datalogger.datalogger_err_cntr));
-
-	telemetry_core.sendPacketToSharedBuff(SLAVE_STATUS_ADDR,
-								                        static_cast<uint16_t>(cmd_type::SLAVE_STATUS),
-								                        set_buffer,
-										                    BUFFER_SIZE);
+	slave_link.state.status_flags = slave_status_flags.all;
+	slave_link.state.datalogger_err_flags = datalogger.error_flags.all;
+	slave_link.state.datalogger_err_cntr = datalogger.datalogger_err_cntr;
 }
 
 
 
 /**
-  * @brief 		  Receives the master command byte(s)
+  * @brief 		  Gets the master command byte(s) from the master state
   *
   * @param[in]  void	Nothing
   *
@@ -320,15 +353,11 @@ void SERIALIZER::setSlaveStatus(void)
   */
 bool SERIALIZER::getMasterCommand(void)
 {
-	const uint16_t BUFFER_SIZE = sizeof(master_cmd);
-		    uint8_t  get_buffer[BUFFER_SIZE] = {0};
-		    bool     success = false;
-
-	success = telemetry_core.receivePacketFromSharedBuff(MASTER_CMD_ADDR, get_buffer, BUFFER_SIZE);
+	bool success = master_link.isValid();
 
 	if(success == true)
 	{
-		memcpy(&master_cmd,get_buffer,BUFFER_SIZE);
+		master_cmd = master_link.state.command;
 		slave_err_flags.bits.get_master_cmd_err = 0;
 	}
 	else
@@ -343,7 +372,7 @@ bool SERIALIZER::getMasterCommand(void)
 
 
 /**
-  * @brief 		  Sets the slave shared buffer index byte(s)
+  * @brief 		  Sets the slave shared buffer index byte(s) of the slave state
   *
   * @param[in]  void	Nothing
   *
@@ -351,21 +380,13 @@ bool SERIALIZER::getMasterCommand(void)
   */
 void SERIALIZER::setSlaveSharedBufferIndex(void)
 {
-	const uint16_t BUFFER_SIZE = sizeof(shared_buffer_index_slave);
-		    uint8_t  set_buffer[BUFFER_SIZE] = {0};
-
-  memcpy(set_buffer, &shared_buffer_index_slave, BUFFER_SIZE);
-
-	telemetry_core.sendPacketToSharedBuff(SLAVE_BUFF_INDEX_ADDR,
-								                        static_cast<uint16_t>(cmd_type::SLAVE_BUFFER_INDEX),
-								                        set_buffer,
-										                    BUFFER_SIZE);
+	slave_link.state.buffer_index = shared_buffer_index_slave;
 }
 
 
 
 /**
-  * @brief 		  Gets the master shared buffer index byte(s)
+  * @brief 		  Gets the master shared buffer index byte(s) from the master state
   *
   * @param[in]  void	Nothing
   *
@@ -373,15 +394,11 @@ void SERIALIZER::setSlaveSharedBufferIndex(void)
   */
 bool SERIALIZER::getMasterSharedBufferIndex(void)
 {
-	const uint16_t BUFFER_SIZE = sizeof(shared_buffer_index_master);
-		    uint8_t  get_buffer[BUFFER_SIZE] = {0};
-		    bool     success = false;
-
-  success = telemetry_core.receivePacketFromSharedBuff(MASTER_BUFF_INDEX_ADDR, get_buffer, BUFFER_SIZE);
+	bool success = master_link.isValid();
 
 	if(success == true)
 	{
-		memcpy(&shared_buffer_index_master, get_buffer, BUFFER_SIZE);
+		shared_buffer_index_master = master_link.state.buffer_index;
 
 		if(shared_buffer_index_master >= SHARED_BUFFER_COUNT)
 		{
@@ -405,7 +422,7 @@ bool SERIALIZER::getMasterSharedBufferIndex(void)
 
 
 /**
-  * @brief 		  Clears all shared buffer status byte(s)
+  * @brief 		  Clears all shared buffer status bits, the slave toggles follow the master
   *
   * @param[in]  void	Nothing
   *
@@ -413,20 +430,9 @@ bool SERIALIZER::getMasterSharedBufferIndex(void)
   */
 void SERIALIZER::clearSharedBufferStatus(void)
 {
-	const uint16_t BUFFER_SIZE = sizeof(shared_buffer_status);
-		    uint8_t  set_buffer[BUFFER_SIZE] = {0};
-		    uint8_t  i = 0;
-
 	shared_buffer_status = 0;
 
-	memcpy(set_buffer,&shared_buffer_status,BUFFER_SIZE);
-
-	for(i = 0;i < SHARED_BUFFER_COUNT;i++)
-	{
-		telemetry_core.sendPacketToSharedBuff((SHARED_BUFF_STATUS_ADDR + (i * static_cast<uint32_t>(0x10))),
-				                                  static_cast<uint16_t>(cmd_type::SHARED_BUFFER_STATUS),
-											                    set_buffer,BUFFER_SIZE);
-	}
+	slave_link.state.empty_toggle = master_link.state.full_toggle;
 }
 
 
@@ -440,16 +446,12 @@ void SERIALIZER::clearSharedBufferStatus(void)
   */
 bool SERIALIZER::getSharedBufferStatus(void)
 {
-	const uint16_t BUFFER_SIZE = sizeof(shared_buffer_status);
-		    bool     success = false;
-		    uint8_t  get_buffer[BUFFER_SIZE] = {0};
-		    uint32_t address = SHARED_BUFF_STATUS_ADDR + (shared_buffer_index_slave * static_cast<uint32_t>(0x10));
-
-  success = telemetry_core.receivePacketFromSharedBuff(address, get_buffer, BUFFER_SIZE);
+	const uint8_t slot = static_cast<uint8_t>(1U << shared_buffer_index_slave);
+	bool          success = master_link.isValid();
 
 	if(success == true)
 	{
-		memcpy(&shared_buffer_status,get_buffer,BUFFER_SIZE);
+		shared_buffer_status = (((master_link.state.full_toggle ^ slave_link.state.empty_toggle) & slot) != 0U) ? FULL : EMPTY;
 		slave_err_flags.bits.get_shared_buff_stat_err = 0;
 	}
 	else
@@ -464,26 +466,27 @@ bool SERIALIZER::getSharedBufferStatus(void)
 
 
 /**
-  * @brief 		  Sends the shared buffer status byte(s)
+  * @brief 		  Sets the shared buffer status bit, only the slave toggle is flipped
   *
-  * @param[in]  void	Nothing
+  * @param[in]  uint8_t index	Shared buffer slot
   *
   * @return 	  void	Nothing
   */
-void SERIALIZER::setSharedBufferStatus(void)
+void SERIALIZER::setSharedBufferStatus(uint8_t index)
 {
-	const uint16_t BUFFER_SIZE = sizeof(shared_buffer_status);
-		    uint8_t  set_buffer[BUFFER_SIZE] = {0};
-		    uint32_t address = SHARED_BUFF_STATUS_ADDR + (shared_buffer_index_slave * static_cast<uint32_t>(0x10));
+	const uint8_t slot = static_cast<uint8_t>(1U << index);
+	const bool    full = (((master_link.state.full_toggle ^ slave_link.state.empty_toggle) & slot) != 0U);
 
-	memcpy(set_buffer, &shared_buffer_status, BUFFER_SIZE);
-	telemetry_core.sendPacketToSharedBuff(address,static_cast<uint16_t>(cmd_type::SHARED_BUFFER_STATUS),set_buffer,BUFFER_SIZE);
+	if((shared_buffer_status == FULL) != full)
+	{
+		slave_link.state.empty_toggle ^= slot;
+	}
 }
 
 
 
 /**
-  * @brief 		  Receives the configuration parameters to the master
+  * @brief 		  Gets the configuration parameters from the master state
   *
   * @param[in]  void	Nothing
   *
@@ -491,17 +494,13 @@ void SERIALIZER::setSharedBufferStatus(void)
   */
 bool SERIALIZER::getConfigParams(void)
 {
-	const uint16_t BUFFER_SIZE = sizeof(packet_count_write) + sizeof(packet_size) + sizeof(config_reserved);
-		    uint8_t  get_buffer[BUFFER_SIZE] = {0};
-		    bool     success = false;
-
-    success = telemetry_core.receivePacketFromSharedBuff(CONFIG_PARAMS_ADDR, get_buffer, BUFFER_SIZE);
+	bool success = master_link.isValid();
 
 	if(success == true)
 	{
-		memcpy(&packet_count_write, get_buffer, sizeof(packet_count_write));
-		memcpy(&packet_size, &get_buffer[sizeof(packet_count_write)], sizeof(packet_size));
-		memcpy(&config_reserved, &get_buffer[sizeof(packet_count_write) + sizeof(packet_size)], sizeof(config_reserved));
+		packet_count_write = master_link.state.packet_count_write;
+		packet_size = master_link.state.packet_size;
+		config_reserved = master_link.state.config_reserved;
 	}
 
 	if((success == true)&&
@@ -32,6 +32,7 @@
  * Begin of Includes
  */
 #include <stdint.h>
+#include "ds_state_sync.hpp"
 // End of Includes
 
 
@@ -46,7 +47,6 @@ namespace Datalogger
  */
 const uint8_t  EMPTY  = 0;
 const uint8_t  FULL   = 1;
-const uint16_t MAX_BUFFER_SIZE = 58240;
 const uint32_t MAX_SHARED_BUFF_ERR_CNT = 100;
 
 const uint8_t  MASTER_CMD_STAND_BY = 0x00;
@@ -54,15 +54,14 @@ const uint8_t  MASTER_CMD_WRITE = 0x01;
 
 const uint32_t SHARED_BUFFER_SIZE      = 0xF000;
 const uint32_t SHARED_BUFFER_BASE_ADDR = 0x24000000;
+const uint32_t SHARED_SLOT_DATA_OFFSET = 0x100;  ///< Records follow the slot header, 32 byte aligned for the SDMMC IDMA
+const uint16_t SHARED_SLOT_MAX_PACKET  = 64;
 
 const uint8_t  SHARED_BUFFER_COUNT     = 8;
-const uint32_t SHARED_BUFF_STATUS_ADDR = 0x38007F70;
-const uint32_t SLAVE_BUFF_INDEX_ADDR   = 0x3800FF70;
-const uint32_t MASTER_BUFF_INDEX_ADDR  = 0x3800FF80;
-const uint32_t MASTER_CMD_ADDR         = 0x3800FF90;
-const uint32_t SLAVE_STATUS_ADDR       = 0x3800FFA0;
-const uint32_t DATE_AND_TIME_ADDR      = 0x3800FFC0;
-const uint32_t CONFIG_PARAMS_ADDR      = 0x38007FF0;
+const uint32_t MASTER_STATE_ADDR       = 0x38007F70;  ///< Written by the master only, lower half of the SRAM4
+const uint32_t SLAVE_STATE_ADDR        = 0x3800FF70;  ///< Written by the slave only, upper half of the SRAM4
+const uint16_t STATE_VERSION           = 1;           ///< Must match the master, increase on every change of the state blocks
+const uint8_t  DATE_AND_TIME_SIZE      = 11;
  //End of Macro Definitions
 
 
@@ -89,6 +88,8 @@ enum class cmd_type : uint16_t
 	SHARED_BUFFER        = 0x1006,
 	CONFIG_PARAMS        = 0x1007,
 	DATE_AND_TIME        = 0x1008,
+	MASTER_STATE         = 0x1009,
+	SLAVE_STATE          = 0x100A,
 };
 
 
@@ -130,6 +131,65 @@ union slave_err_flags_t
 	uint8_t all;
 };
 
+
+
+/*
+* @brief Head of a shared buffer slot written by the master, the records follow it at
+*        SHARED_SLOT_DATA_OFFSET and are written to the storage device in place
+*/
+#pragma pack(1)
+	struct shared_slot_header_t
+	{
+		uint16_t command;                        ///< cmd_type::SHARED_BUFFER
+		uint16_t packet_size;
+		uint16_t packet_count;                   ///< Records committed to the slot
+		uint16_t reserved;
+		uint16_t crc[SHARED_SLOT_MAX_PACKET];    ///< CRC16 of each record
+	};
+#pragma pack()
+
+static_assert( sizeof(shared_slot_header_t) <= SHARED_SLOT_DATA_OFFSET, "Shared slot header overlaps the records" );
+
+
+
+/*
+* @brief Control fields of the master, read once per cycle. A shared buffer slot is FULL
+*        while its bits in full_toggle and empty_toggle differ.
+*/
+#pragma pack(1)
+	struct master_state_t
+	{
+		uint8_t  command;                            ///< MASTER_CMD_STAND_BY or MASTER_CMD_WRITE
+		uint8_t  buffer_index;
+		uint8_t  full_toggle;                        ///< Bit i flipped by the master when slot i is FULL
+		uint8_t  reserved;
+		uint16_t packet_count_write;
+		uint16_t packet_size;
+		uint16_t config_reserved;
+		uint8_t  date_and_time[DATE_AND_TIME_SIZE];  ///< gnss_date_and_time_t
+		uint8_t  padding[3];
+	};
+#pragma pack()
+
+
+
+/*
+* @brief Status fields of the slave, published once per cycle
+*/
+#pragma pack(1)
+	struct slave_state_t
+	{
+		uint8_t  status_flags;                       ///< slave_status_flags_t
+		uint8_t  buffer_index;
+		uint8_t  empty_toggle;                       ///< Bit i flipped by the slave when slot i is written
+		uint8_t  reserved;
+		uint32_t datalogger_err_flags;
+		uint32_t datalogger_err_cntr;
+	};
+#pragma pack()
+
+static_assert( SHARED_BUFFER_COUNT <= 8, "Shared buffer status toggles are 8 bit" );
+
 // End of Enum, Union and Struct Definitions
 
 
@@ -152,10 +212,11 @@ class SERIALIZER
     protected:
 
     private:
-			uint8_t datalogger_buffer[MAX_BUFFER_SIZE] = {0};
 			uint8_t shared_buffer_index_slave = 0;
 			uint8_t shared_buffer_index_master = 0;
 			uint8_t shared_buffer_status = 0;
+			uint8_t held_slot_index = 0;     ///< Slot whose records are being written by the datalogger
+			bool    slot_held = false;
 
 			uint16_t packet_count_write = 8;   /* Value must be 4, 8, 16, 32 or 64 */
 			uint16_t packet_size        = 512; /* Value must be 128, 256, 384, 512, 640, 768 or 896 */
@@ -167,6 +228,9 @@ class SERIALIZER
 			slave_status_flags_t slave_status_flags;
 			slave_err_flags_t slave_err_flags;
 
+			Tools::STATE_SUBSCRIBER<master_state_t> master_link{MASTER_STATE_ADDR, static_cast<uint16_t>(cmd_type::MASTER_STATE), STATE_VERSION};
+			Tools::STATE_PUBLISHER<slave_state_t>   slave_link {SLAVE_STATE_ADDR,  static_cast<uint16_t>(cmd_type::SLAVE_STATE),  STATE_VERSION};
+
 			void increaseSlaveSharedBufferIndex ( void );
 			void setSlaveStatus                 ( void );
 			bool getMasterCommand               ( void );
@@ -174,9 +238,10 @@ class SERIALIZER
 			bool getMasterSharedBufferIndex     ( void );
 			void clearSharedBufferStatus        ( void );
 			bool getSharedBufferStatus          ( void );
-			void setSharedBufferStatus          ( void );
+			void setSharedBufferStatus          ( uint8_t index );
 			bool getDateAndTime                 ( void );
-			bool readFromSharedBuffer           ( void );
+			bool claimSharedSlot                ( void );
+			void releaseSharedSlot              ( void );
 			bool getConfigParams                ( void );
 
 };
@@ -31,6 +31,9 @@
  * Begin of Includes
  */
 #include "ds_shared_ram_h747.hpp"
+#include "main.h"
+#include <cstring>
+#include "ds_ring_buffer.hpp"
 #include "ds_debug_tools.hpp"
 // End of Includes
 
@@ -41,31 +44,38 @@ extern "C"
 {
 #endif
 
-const uint16_t SHARED_RAM_BUFFER_SIZE = 0x7F00; //32512
+const uint32_t SHARED_RAM_BUFFER_SIZE = 0x4000;	///< Must be a power of two, the ring ends below the variables at 0x38007F30
 //const uint16_t VARIABLE_MEMORY_SIZE	  = 0x0100; /* Used by Datalogger */
 
+const uint32_t SHARED_RAM_ACCESS_SIZE  = sizeof(uint64_t);	///< Shared side is written and read with aligned doublewords, only the head and the tail go byte by byte
+const uint32_t SHARED_RAM_ACCESS_MASK  = SHARED_RAM_ACCESS_SIZE - 1;
+
+typedef Tools::RING_BUFFER<uint8_t, SHARED_RAM_BUFFER_SIZE> shared_ring_type;	///< Written by one core, read by the other
+
 
 #ifdef CORE_CM7
-	volatile uint8_t  * const transmit_buffer_ptr 			= reinterpret_cast<volatile uint8_t  *>(0x38000000);	//SRAM4 64K
-	volatile uint16_t * const transmit_head_ptr				= reinterpret_cast<volatile uint16_t *>(0x38007F10);
-	volatile uint16_t * const receive_tail_ptr				= reinterpret_cast<volatile uint16_t *>(0x38007F20);
-	volatile uint32_t * const core_clock_ms_write_ptr		= reinterpret_cast<volatile uint32_t *>(0x38007F30);
+	shared_ring_type  * const transmit_ring					= reinterpret_cast<shared_ring_type  *>(0x38000000);	//SRAM4 64K
+	volatile uint32_t * const heartbeat_write_ptr			= reinterpret_cast<volatile uint32_t *>(0x38007F30);
 
-	volatile const uint8_t  * const receive_buffer_ptr 		= reinterpret_cast<volatile uint8_t  *>(0x38008000);
-	volatile const uint16_t * const receive_head_ptr		= reinterpret_cast<volatile uint16_t *>(0x3800FF10);
-	volatile const uint32_t * const core_clock_ms_check_ptr	= reinterpret_cast<volatile uint32_t *>(0x3800FF30);
+	shared_ring_type  * const receive_ring					= reinterpret_cast<shared_ring_type  *>(0x38008000);
+	volatile const uint32_t * const heartbeat_check_ptr		= reinterpret_cast<volatile uint32_t *>(0x3800FF30);
+
+	const uint32_t	transmit_semaphore	= Peripherals::Ram::HSEM_ID_CM7_TO_CM4;
+	const uint32_t	receive_semaphore	= Peripherals::Ram::HSEM_ID_CM4_TO_CM7;
+	const IRQn_Type	semaphore_irq		= HSEM1_IRQn;
 
 #endif
 
 #ifdef CORE_CM4
-	volatile uint8_t  * const transmit_buffer_ptr 		= reinterpret_cast<volatile uint8_t  *>(0x38008000);
-	volatile uint16_t * const transmit_head_ptr			= reinterpret_cast<volatile uint16_t *>(0x3800FF10);
-	volatile uint16_t * const receive_tail_ptr			= reinterpret_cast<volatile uint16_t *>(0x3800FF20);
-	volatile uint32_t * const core_clock_ms_write_ptr	= reinterpret_cast<volatile uint32_t *>(0x3800FF30);
+	shared_ring_type  * const transmit_ring					= reinterpret_cast<shared_ring_type  *>(0x38008000);
+	volatile uint32_t * const heartbeat_write_ptr			= reinterpret_cast<volatile uint32_t *>(0x3800FF30);
+
+	shared_ring_type  * const receive_ring					= reinterpret_cast<shared_ring_type  *>(0x38000000);
+	volatile const uint32_t * const heartbeat_check_ptr		= reinterpret_cast<volatile uint32_t *>(0x38007F30);
 
-	volatile const uint8_t  * const receive_buffer_ptr 		= reinterpret_cast<volatile uint8_t  *>(0x38000000);
-	volatile const uint16_t * const receive_head_ptr		= reinterpret_cast<volatile uint16_t *>(0x38007F10);
-	volatile const uint32_t * const core_clock_ms_check_ptr	= reinterpret_cast<volatile uint32_t *>(0x38007F30);
+	const uint32_t	transmit_semaphore	= Peripherals::Ram::HSEM_ID_CM4_TO_CM7;
+	const uint32_t	receive_semaphore	= Peripherals::Ram::HSEM_ID_CM7_TO_CM4;
+	const IRQn_Type	semaphore_irq		= HSEM2_IRQn;
 
 #endif
 
@@ -85,6 +95,35 @@ Peripherals::Ram::H747_SHARED_RAM inter_core;
 
 
 
+/*
+ * Begin of Private Interrupt Callback Functions
+ */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/**
+  * @brief		HSEM interrupt of this core: HAL_HSEM_IRQHandler -> HAL_HSEM_FreeCallback
+  *
+  * @param[in]  uint32_t SemMask : Semaphores freed by the other core
+  *
+  * @return 	void	Nothing
+  */
+void HAL_HSEM_FreeCallback(uint32_t SemMask)
+{
+	inter_core.notificationHandler(SemMask);
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+// End of Private Interrupt Callback Functions
+
+
+
 namespace Peripherals
 {
 
@@ -116,15 +155,12 @@ H747_SHARED_RAM::H747_SHARED_RAM()
   */
 void H747_SHARED_RAM::initialize( void )
 {
-	uint16_t k = 0;
+	transmit_ring->reset();		///< The other core reads it after the synchronization
 
-	for(k=0;k<(SHARED_RAM_BUFFER_SIZE);k++)
-	{
-		*(transmit_buffer_ptr + k)= 0x00;
-	}
-
-	*transmit_head_ptr = 0;
-	*receive_tail_ptr  = 0;
+	__HAL_RCC_HSEM_CLK_ENABLE();
+	HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(receive_semaphore));
+	HAL_NVIC_SetPriority(semaphore_irq, 0, 0);
+	HAL_NVIC_EnableIRQ(semaphore_irq);
 }
 
 
@@ -138,102 +174,103 @@ void H747_SHARED_RAM::initialize( void )
   */
 void H747_SHARED_RAM::scheduler( void )
 {
-	*core_clock_ms_write_ptr = monitor.getMillis();
+	*heartbeat_write_ptr = *heartbeat_write_ptr + 1;	///< Only this core writes it
+	checkHeartbeat();
 }
 
 
 
 /**
-  * @brief		Checks the other core activity
+  * @brief		Follows the heartbeat sequence number of the other core. The core is active while
+  *				the number keeps changing and lost after HEARTBEAT_MISS_LIMIT calls without a change.
+  *				The receive ring is flushed once when the other core becomes active.
   *
   * @param[in]  void	Nothing
   *
-  * @return 	bool Result
+  * @return 	void	Nothing
   */
-bool H747_SHARED_RAM::isOtherCoreActive( void )
+void H747_SHARED_RAM::checkHeartbeat( void )
 {
-	const uint32_t DT_WRAP_LIMIT_MS = 1000000;
-	const uint32_t DT_LIMIT_MS 		= 200;
+	const uint32_t heartbeat = *heartbeat_check_ptr;
 
-	uint32_t dt_ms 	= 0;
-
-	if(*core_clock_ms_write_ptr >= *core_clock_ms_check_ptr)
+	if(heartbeat != last_heartbeat)
 	{
-		dt_ms = *core_clock_ms_write_ptr - *core_clock_ms_check_ptr;
+		last_heartbeat			 = heartbeat;
+		missed_heartbeat_counter = 0;
+
+		if(synchronization_complete == false)
+		{
+			receive_ring->flush();
+			synchronization_complete = true;
+		}
 	}
-	else
+	else if(missed_heartbeat_counter < HEARTBEAT_MISS_LIMIT)
 	{
-		dt_ms = *core_clock_ms_check_ptr - *core_clock_ms_write_ptr;
+		missed_heartbeat_counter++;
 	}
-
-	if(dt_ms < DT_WRAP_LIMIT_MS)
+	else if(synchronization_complete == true)
 	{
-		if(dt_ms <= DT_LIMIT_MS)
-		{
-			if(synchronization_complete == false)
-			{
-				*receive_tail_ptr = *receive_head_ptr;
-				synchronization_complete = true;
-			}
-			else
-			{
-				//synchronization completed
-			}
-		}
-		else
-		{
-			if(synchronization_complete == true)
-			{
-				synchronization_complete = false;
-			}
-			else
-			{
-				//other core is not active
-			}
-		}
+		synchronization_complete = false;
+		heartbeat_loss_counter++;
 	}
 	else
 	{
-		//wrap around, return last state
+		//other core is not active
 	}
+}
+
 
+
+/**
+  * @brief		Checks the other core activity, updated by scheduler()
+  *
+  * @param[in]  void	Nothing
+  *
+  * @return 	bool Result
+  */
+bool H747_SHARED_RAM::isOtherCoreActive( void )
+{
 	return synchronization_complete;
 }
 
 
 
+/**
+  * @brief		Interrupts the other core by taking and freeing the transmit semaphore
+  *
+  * @param[in]  void	Nothing
+  *
+  * @return 	void	Nothing
+  */
+void H747_SHARED_RAM::notifyOtherCore( void )
+{
+	if(HAL_HSEM_FastTake(transmit_semaphore) == HAL_OK)
+	{
+		HAL_HSEM_Release(transmit_semaphore, 0);
+	}
+}
+
+
+
 /**
   * @brief		Send data to other core
   *
   * @param[in]  uint8_t  buffer[]
   * @param[in]  uint16_t size
   *
-  * @return 	uint16_t size
+  * @return 	uint16_t : Bytes written, 0 if the packet does not fit or the other core is not active
   */
 uint16_t H747_SHARED_RAM::sendData(uint8_t buffer[], uint16_t size)
 {
-	uint16_t k = 0;
-	uint16_t transmit_head = *transmit_head_ptr;
-
-	if(size > SHARED_RAM_BUFFER_SIZE/2)
-	{
-		size = SHARED_RAM_BUFFER_SIZE/2;
-	}
+	uint16_t sent_size = 0;
 
-	if(isOtherCoreActive() == true)
+	if( (isOtherCoreActive() == true) && (size <= transmit_ring->getSpace()) )
 	{
-		for(k=0;k<size;k++)
-		{
-			*(transmit_buffer_ptr + transmit_head++) = buffer[k];
-			if(transmit_head >= SHARED_RAM_BUFFER_SIZE)
-			{
-				transmit_head = 0;
-			}
-		}
+		sent_size = static_cast<uint16_t>(transmit_ring->pushBulk(buffer, size));
+		notifyOtherCore();
 	}
 
-	*transmit_head_ptr = transmit_head;
-	return size;
+	return sent_size;
 }
 
 
@@ -249,25 +286,68 @@ uint16_t H747_SHARED_RAM::sendData(uint8_t buffer[], uint16_t size)
 uint16_t H747_SHARED_RAM::getDataFromBuffer(uint8_t buffer[], uint16_t size_limit)
 {
 	uint16_t size = 0;
-	uint16_t receive_tail = *receive_tail_ptr;
 
 	if(isOtherCoreActive() == true)
 	{
-		while( receive_tail != *receive_head_ptr )
+		size = static_cast<uint16_t>(receive_ring->popBulk(buffer, size_limit));
+	}
+
+	return size;
+}
+
+
+
+/**
+  * @brief		Checks the receive buffer without reading it
+  *
+  * @param[in]  void	Nothing
+  *
+  * @return 	bool true if the other core wrote data which is not read yet
+  */
+bool H747_SHARED_RAM::isDataAvailable( void )
+{
+	return ( receive_ring->getSize() != 0 );
+}
+
+
+
+/**
+  * @brief		Sets the function which is called from the HSEM interrupt when the other core
+  *				wrote the ring, e.g. to wake the parser task
+  *
+  * @param[in]  void (*notify)(void)
+  *
+  * @return 	void	Nothing
+  */
+void H747_SHARED_RAM::setDataReadyNotification( void (*notify)(void) )
+{
+	data_ready_notify = notify;
+}
+
+
+
+/**
+  * @brief		Handles the semaphores freed by the other core. HAL_HSEM_IRQHandler disables the
+  *				notification of a freed semaphore, so it is activated again here.
+  *
+  * @param[in]  uint32_t semaphore_mask
+  *
+  * @return 	void	Nothing
+  */
+void H747_SHARED_RAM::notificationHandler( uint32_t semaphore_mask )
+{
+	const uint32_t RECEIVE_MASK = __HAL_HSEM_SEMID_TO_MASK(receive_semaphore);
+
+	if( (semaphore_mask & RECEIVE_MASK) != 0 )
+	{
+		notification_counter++;
+		HAL_HSEM_ActivateNotification(RECEIVE_MASK);
+
+		if(data_ready_notify != nullptr)
 		{
-			buffer[size++] = *(receive_buffer_ptr + receive_tail++);
-			if(receive_tail >= SHARED_RAM_BUFFER_SIZE)
-			{
-				receive_tail = 0;
-			}
-			if(size >= size_limit)
-			{
-				break;
-			}
+			data_ready_notify();
 		}
 	}
-	*receive_tail_ptr = receive_tail;
-	return size;
 }
 
 
@@ -284,9 +364,21 @@ uint16_t H747_SHARED_RAM::getDataFromBuffer(uint8_t buffer[], uint16_t size_limi
 void H747_SHARED_RAM::sendDataToSharedRam(uint32_t ram_address, uint8_t buffer[], uint16_t size)
 {
 	volatile uint8_t * const transmit_buff_ptr = reinterpret_cast<volatile uint8_t *>(ram_address);
+	uint64_t word = 0;
 	uint16_t k = 0;
 
-	for(k = 0; k<size; k++)
+	for(k = 0; (k < size) && ( ((ram_address + k) & SHARED_RAM_ACCESS_MASK) != 0 ); k++)
+	{
+		*(transmit_buff_ptr + k) = buffer[k];
+	}
+
+	for(; static_cast<uint16_t>(size - k) >= SHARED_RAM_ACCESS_SIZE; k += SHARED_RAM_ACCESS_SIZE)
+	{
+		std::memcpy(&word, &buffer[k], SHARED_RAM_ACCESS_SIZE);		///< The local buffer may be unaligned, e.g. a packet at an odd offset
+		*reinterpret_cast<volatile uint64_t *>(ram_address + k) = word;
+	}
+
+	for(; k < size; k++)
 	{
 		*(transmit_buff_ptr + k) = buffer[k];
 	}
@@ -306,9 +398,21 @@ void H747_SHARED_RAM::sendDataToSharedRam(uint32_t ram_address, uint8_t buffer[]
 void H747_SHARED_RAM::getDataFromSharedRam(uint32_t ram_address, uint8_t buffer[], uint16_t size)
 {
 	volatile const uint8_t  * const receive_buff_ptr = reinterpret_cast<volatile uint8_t *>(ram_address);
+	uint64_t word = 0;
 	uint16_t k = 0;
 
-	for(k = 0; k<size;k++)
+	for(k = 0; (k < size) && ( ((ram_address + k) & SHARED_RAM_ACCESS_MASK) != 0 ); k++)
+	{
+		buffer[k] = *(receive_buff_ptr + k);
+	}
+
+	for(; static_cast<uint16_t>(size - k) >= SHARED_RAM_ACCESS_SIZE; k += SHARED_RAM_ACCESS_SIZE)
+	{
+		word = *reinterpret_cast<volatile const uint64_t *>(ram_address + k);
+		std::memcpy(&buffer[k], &word, SHARED_RAM_ACCESS_SIZE);
+	}
+
+	for(; k < size; k++)
 	{
 		buffer[k] = *(receive_buff_ptr + k);
 	}
@@ -49,6 +49,9 @@ namespace Ram
  * Begin of Macro Definitions
  */
 const uint16_t MAXIMUM_BUFFER_SIZE	= 512;
+const uint32_t HSEM_ID_CM7_TO_CM4	= 1;	///< Freed by the CM7 after it wrote the ring, interrupts the CM4
+const uint32_t HSEM_ID_CM4_TO_CM7	= 2;	///< Freed by the CM4 after it wrote the ring, interrupts the CM7
+const uint8_t  HEARTBEAT_MISS_LIMIT	= 20;	///< scheduler() calls without a new heartbeat of the other core, 200 ms at 100 Hz
  //End of Macro Definitions
 
 
@@ -74,6 +77,9 @@ class H747_SHARED_RAM
 									          uint16_t size);
 		uint16_t getDataFromBuffer  ( uint8_t buffer[],
 									                uint16_t size_limit = MAXIMUM_BUFFER_SIZE);
+		bool	 isDataAvailable	( void );
+		void	 setDataReadyNotification( void (*notify)(void) );
+		void	 notificationHandler( uint32_t semaphore_mask );
 
 		void     sendDataToSharedRam ( uint32_t ram_address,
 											             uint8_t buffer[],
@@ -82,6 +88,9 @@ class H747_SHARED_RAM
 											             uint8_t buffer[],
 											             uint16_t size);
 
+		uint32_t notification_counter	= 0;	///< HSEM interrupts of the other core, one per sendData call
+		uint32_t heartbeat_loss_counter	= 0;	///< The other core stopped its heartbeat after the synchronization
+
 		H747_SHARED_RAM(const H747_SHARED_RAM& orig);
 		virtual ~H747_SHARED_RAM();
 
@@ -90,6 +99,12 @@ class H747_SHARED_RAM
 	private:
 		bool synchronization_complete;
 		bool isOtherCoreActive	( void );
+		uint32_t last_heartbeat				= 0;
+		uint8_t	 missed_heartbeat_counter	= 0;
+		void	 (*data_ready_notify)(void)	= nullptr;	///< Called from the HSEM interrupt when the other core wrote the ring
+
+		void checkHeartbeat		( void );
+		void notifyOtherCore	( void );
 
 };
 // End of H747_SHARED_RAM Class Definition
@@ -0,0 +1,277 @@
+/**
+ ******************************************************************************
+  * @file		: ds_state_sync.hpp
+  * @brief		: Inter-core state mirror header file
+  *				  This file contains the publisher and subscriber of a typed state block in the shared RAM
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+#ifndef DS_STATE_SYNC_HPP
+#define	DS_STATE_SYNC_HPP
+
+
+
+/*
+ * Begin of Includes
+ */
+#include <stdint.h>
+#include <cstring>
+#include <atomic>
+// End of Includes
+
+
+
+namespace Tools
+{
+
+
+
+/*
+ * Begin of Enum, Union and Struct Definitions
+ */
+/**
+ * @brief State block at a fixed shared RAM address, written by one core only. sequence is odd
+ *		  while the writer updates the words, a reader which sees it change retries later.
+ */
+template <typename state_type>
+struct shared_state_type
+{
+	std::atomic<uint32_t> sequence;
+	volatile uint16_t	  command;		///< Telemetry command ID of the block
+	volatile uint16_t	  version;		///< Layout version, both cores must be built with the same one
+	volatile uint32_t	  word[sizeof(state_type) / sizeof(uint32_t)];
+};
+// End of Enum, Union and Struct Definitions
+
+
+
+/*
+ * Begin of STATE_PUBLISHER Class Definition
+ */
+/**
+ * @brief Writer side of a state block. The owner edits state and calls publish once per cycle,
+ *		  only the words which differ from the last published copy are written.
+ */
+template <typename state_type>
+class STATE_PUBLISHER
+{
+	static_assert( (sizeof(state_type) % sizeof(uint32_t)) == 0, "STATE_PUBLISHER state must be padded to whole words" );
+
+	public:
+		static const uint32_t WORD_COUNT = sizeof(state_type) / sizeof(uint32_t);
+
+		STATE_PUBLISHER(uint32_t address, uint16_t command_id, uint16_t layout_version) :
+			state(), publish_counter(0), word_counter(0),
+			shared(reinterpret_cast<shared_state_type<state_type> *>(address)),
+			command(command_id), version(layout_version), sequence(0), published(false), mirror{}
+		{
+		}
+
+		STATE_PUBLISHER(const STATE_PUBLISHER &orig) = delete;
+
+		state_type state;			///< Edited by the owner, copied to the shared block by publish
+		uint32_t   publish_counter;	///< publish calls which found a change
+		uint32_t   word_counter;	///< Words written to the shared block
+
+
+
+		/**
+		  * @brief 		Continues the sequence of the shared block, e.g. after a reset of this core
+		  */
+		void initialize(void)
+		{
+			sequence  = shared->sequence.load(std::memory_order_acquire) & ~static_cast<uint32_t>(1);
+			published = false;
+		}
+
+
+
+		/**
+		  * @brief 		Writes the changed words of state to the shared block
+		  *
+		  * @return 	bool : false if nothing has changed since the last call
+		  */
+		bool publish(void)
+		{
+			uint32_t words[WORD_COUNT];
+			uint32_t index	 = 0;
+			bool	 changed = !published;
+
+			std::memcpy(words, &state, sizeof(words));
+			for(index = 0; (index < WORD_COUNT) && (changed == false); index++)
+			{
+				changed = (words[index] != mirror[index]);
+			}
+
+			if(changed == false)
+			{
+				return false;
+			}
+
+			shared->sequence.store(sequence + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+
+			if(published == false)
+			{
+				shared->command = command;
+				shared->version = version;
+			}
+
+			for(index = 0; index < WORD_COUNT; index++)
+			{
+				if((published == false) || (words[index] != mirror[index]))
+				{
+					shared->word[index] = words[index];
+					mirror[index]		= words[index];
+					word_counter++;
+				}
+			}
+
+			sequence += 2;
+			shared->sequence.store(sequence, std::memory_order_release);
+			published = true;
+			publish_counter++;
+
+			return true;
+		}
+
+	protected:
+
+	private:
+		shared_state_type<state_type> * const shared;
+		const uint16_t						  command;
+		const uint16_t						  version;
+		uint32_t							  sequence;
+		bool								  published;
+		uint32_t							  mirror[WORD_COUNT];	///< Last published words, the shared RAM is not read back
+};
+// End of STATE_PUBLISHER Class Definition
+
+
+
+/*
+ * Begin of STATE_SUBSCRIBER Class Definition
+ */
+/**
+ * @brief Reader side of a state block. update costs one load of the sequence when the block
+ *		  has not changed, state keeps the last consistent copy.
+ */
+template <typename state_type>
+class STATE_SUBSCRIBER
+{
+	static_assert( (sizeof(state_type) % sizeof(uint32_t)) == 0, "STATE_SUBSCRIBER state must be padded to whole words" );
+
+	public:
+		static const uint32_t WORD_COUNT = sizeof(state_type) / sizeof(uint32_t);
+
+		STATE_SUBSCRIBER(uint32_t address, uint16_t command_id, uint16_t layout_version) :
+			state(), update_counter(0), retry_counter(0), mismatch_counter(0),
+			shared(reinterpret_cast<const shared_state_type<state_type> *>(address)),
+			command(command_id), version(layout_version), sequence(0), valid(false)
+		{
+		}
+
+		STATE_SUBSCRIBER(const STATE_SUBSCRIBER &orig) = delete;
+
+		state_type state;				///< Last consistent copy of the shared block
+		uint32_t   update_counter;
+		uint32_t   retry_counter;		///< Reads which overlapped a publish and were dropped
+		uint32_t   mismatch_counter;	///< Reads of a block with an other command ID or version
+
+
+
+		/**
+		  * @brief 		Copies the shared block into state if it has changed
+		  *
+		  * @return 	bool : true if state holds a new copy
+		  */
+		bool update(void)
+		{
+			const uint32_t begin = shared->sequence.load(std::memory_order_acquire);
+			uint32_t	   words[WORD_COUNT];
+			uint32_t	   index = 0;
+
+			if((valid == true) && (begin == sequence))
+			{
+				return false;
+			}
+
+			if((begin & static_cast<uint32_t>(1)) != 0U)
+			{
+				retry_counter++;
+				return false;
+			}
+
+			if((shared->command != command) || (shared->version != version))
+			{
+				mismatch_counter++;
+				valid = false;
+				return false;
+			}
+
+			for(index = 0; index < WORD_COUNT; index++)
+			{
+				words[index] = shared->word[index];
+			}
+
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if(shared->sequence.load(std::memory_order_relaxed) != begin)
+			{
+				retry_counter++;
+				return false;
+			}
+
+			std::memcpy(&state, words, sizeof(words));
+			sequence = begin;
+			valid	 = true;
+			update_counter++;
+
+			return true;
+		}
+
+
+
+		/**
+		  * @brief 		Checks whether a consistent block of the expected layout has been read
+		  */
+		bool isValid(void) const
+		{
+			return valid;
+		}
+
+	protected:
+
+	private:
+		const shared_state_type<state_type> * const shared;
+		const uint16_t								command;
+		const uint16_t								version;
+		uint32_t									sequence;	///< Sequence of the copy in state
+		bool										valid;
+};
+// End of STATE_SUBSCRIBER Class Definition
+
+
+
+} //End of namespace Tools
+
+
+#endif	/* DS_STATE_SYNC_HPP */
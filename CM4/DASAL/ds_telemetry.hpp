@@ -69,6 +69,7 @@ class BASE
 		bool calculateCrc16(uint8_t *aBuffer, uint16_t aLength, uint16_t command, bool aCheck);
 		uint16_t calculateCrc16(const uint8_t *aBuffer, uint16_t aLength);
 		bool checkCrc16(const uint8_t *aBuffer, uint16_t aLength);
+		bool checkCrc16(uint16_t crc, uint8_t crc_low, uint8_t crc_high) const;
 
 	private:
 
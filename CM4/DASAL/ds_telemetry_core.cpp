@@ -30,6 +30,7 @@
 #include "ds_telemetry_core.hpp"
 #include <cstring>
 #include "ds_shared_ram_h747.hpp"
+#include "ds_crc16.hpp"
 #include "ds_debug_tools.hpp"
 // End of Includes
 
@@ -111,12 +112,15 @@ void CORE_TELEMETRY::parseReceivedData(void)
 	uint8_t buffer[512] = { 0 };
 	uint16_t size = 0;
 	uint16_t k = 0;
+	uint16_t run = 0;
 
 	static parser_state_type state = parser_state_type::HEADER_1;
 	static uint8_t payload[1024] = { 0 };
-	static uint8_t counter = 0;
+	static uint16_t counter = 0;
 	static uint16_t length = 0;
 	static uint16_t command = 0;
+	static uint16_t crc = Tools::CRC16_INIT;	///< Folded in while the bytes arrive, covers COMMAND to PAYLOAD
+	static uint8_t crc_low = 0;
 
 	/*
 	 * | HEADER	 		 | COMMAND		| LENGTH			| PAYLOAD	   | CRC16			| FOOTER	|
@@ -137,6 +141,7 @@ void CORE_TELEMETRY::parseReceivedData(void)
 						length = 0;
 						command = 0;
 						counter = 0;
+						crc = Tools::CRC16_INIT;
 						state = parser_state_type::HEADER_2;
 					}
 					break;
@@ -154,26 +159,46 @@ void CORE_TELEMETRY::parseReceivedData(void)
 
 				case parser_state_type::COMMAND_1:
 					command = (static_cast<uint16_t>(buffer[k]));
+					crc = Tools::CRC16::update(crc, buffer[k]);
 					state = parser_state_type::COMMAND_2;
 					break;
 
 				case parser_state_type::COMMAND_2:
 					command += (static_cast<uint16_t>(buffer[k]) << 8);
+					crc = Tools::CRC16::update(crc, buffer[k]);
 					state = parser_state_type::LENGTH_1;
 					break;
 
 				case parser_state_type::LENGTH_1:
 					length = (static_cast<uint16_t>(buffer[k]));
+					crc = Tools::CRC16::update(crc, buffer[k]);
 					state = parser_state_type::LENGTH_2;
 					break;
 
 				case parser_state_type::LENGTH_2:
 					length += (static_cast<uint16_t>(buffer[k]) << 8);
-					state = parser_state_type::PAYLOAD;
+					crc = Tools::CRC16::update(crc, buffer[k]);
+					if (length > sizeof(payload))
+					{
+						parse_error_counter++;
+						state = parser_state_type::HEADER_1;
+					}
+					else if (length == 0)
+					{
+						state = parser_state_type::CRC_1;
+					}
+					else
+					{
+						state = parser_state_type::PAYLOAD;
+					}
 					break;
 
 				case parser_state_type::PAYLOAD:
-					payload[counter++] = buffer[k];
+					run = ((length - counter) < (size - k)) ? (length - counter) : (size - k);	///< Rest of the field which is in this buffer
+					std::memcpy(&payload[counter], &buffer[k], run);
+					crc = crc16.calculate(&buffer[k], run, crc);
+					counter += run;
+					k += run - 1;
 					if (counter >= length)
 					{
 						state = parser_state_type::CRC_1;
@@ -181,13 +206,12 @@ void CORE_TELEMETRY::parseReceivedData(void)
 					break;
 
 				case parser_state_type::CRC_1:
-					payload[counter] = buffer[k];
+					crc_low = buffer[k];
 					state = parser_state_type::CRC_2;
 					break;
 
 				case parser_state_type::CRC_2:
-					payload[counter + 1] = buffer[k];
-					if (calculateCrc16(payload, counter, command, true) == true)
+					if (checkCrc16(crc, crc_low, buffer[k]) == true)
 					{
 						state = parser_state_type::FOOTER;
 					}
@@ -283,16 +307,17 @@ bool CORE_TELEMETRY::receivePacketFromSharedBuff(uint32_t address, uint8_t paylo
 {
 	const uint16_t PACKET_SIZE_WITHOUT_PAYLOAD = 9;
 	uint8_t buffer[1024] = {0};
-	uint8_t crc_data[1024] = {0};
 	uint16_t size	= 0;
 	uint16_t k = 0;
-	uint16_t t = 0;
+	uint16_t run = 0;
 	bool packet_received = false;
 
 	static parser_state_type state = parser_state_type::HEADER_1;
 	static uint16_t counter =  0;
 	static uint16_t length  =  0;
 	static uint16_t command	=  0;
+	static uint16_t crc = Tools::CRC16_INIT;	///< Folded in while the bytes arrive, covers COMMAND to PAYLOAD
+	static uint8_t crc_low = 0;
 
 	/*
 	 * | HEADER	 		 | COMMAND		| LENGTH			| PAYLOAD	   | CRC16			| FOOTER	|
@@ -312,6 +337,7 @@ bool CORE_TELEMETRY::receivePacketFromSharedBuff(uint32_t address, uint8_t paylo
 					length          = 0;
 					command         = 0;
 					counter         = 0;
+					crc = Tools::CRC16_INIT;
 					state = parser_state_type::HEADER_2;
 				}
 				break;
@@ -331,30 +357,50 @@ bool CORE_TELEMETRY::receivePacketFromSharedBuff(uint32_t address, uint8_t paylo
 
 			case parser_state_type::COMMAND_1 :
 				command = (static_cast<uint16_t>(buffer[k]) );
+				crc = Tools::CRC16::update(crc, buffer[k]);
 				state = parser_state_type::COMMAND_2;
 				break;
 
 
 			case parser_state_type::COMMAND_2 :
 				command += (static_cast<uint16_t>(buffer[k]) << 8 );
+				crc = Tools::CRC16::update(crc, buffer[k]);
 				state = parser_state_type::LENGTH_1;
 				break;
 
 
 			case parser_state_type::LENGTH_1 :
 				length = ( static_cast<uint16_t>(buffer[k]) );
+				crc = Tools::CRC16::update(crc, buffer[k]);
 				state = parser_state_type::LENGTH_2;
 				break;
 
 
 			case parser_state_type::LENGTH_2 :
 				length += (static_cast<uint16_t>(buffer[k]) << 8 );
-				state = parser_state_type::PAYLOAD;
+				crc = Tools::CRC16::update(crc, buffer[k]);
+				if(length > payload_size)
+				{
+					shared_buff_parse_err_cntr++;
+					state = parser_state_type::HEADER_1;
+				}
+				else if(length == 0)
+				{
+					state = parser_state_type::CRC_1;
+				}
+				else
+				{
+					state = parser_state_type::PAYLOAD;
+				}
 				break;
 
 
 			case parser_state_type::PAYLOAD :
-				crc_data[counter++] = buffer[k];
+				run = ((length - counter) < (size - k)) ? (length - counter) : (size - k);	///< Rest of the field which is in this buffer
+				std::memcpy(&payload[counter], &buffer[k], run);
+				crc = crc16.calculate(&buffer[k], run, crc);
+				counter += run;
+				k += run - 1;
 				if(counter >= length)
 				{
 					state = parser_state_type::CRC_1;
@@ -363,14 +409,13 @@ bool CORE_TELEMETRY::receivePacketFromSharedBuff(uint32_t address, uint8_t paylo
 
 
 			case parser_state_type::CRC_1 :
-				crc_data[counter] = buffer[k];
+				crc_low = buffer[k];
 				state = parser_state_type::CRC_2;
 				break;
 
 
 			case parser_state_type::CRC_2 :
-				crc_data[counter+1] = buffer[k];
-				if(calculateCrc16(crc_data, counter, command, true) == true  )
+				if(checkCrc16(crc, crc_low, buffer[k]) == true)
 				{
 					state = parser_state_type::FOOTER;
 				}
@@ -386,10 +431,6 @@ bool CORE_TELEMETRY::receivePacketFromSharedBuff(uint32_t address, uint8_t paylo
 				if(buffer[k] == FTR)
 				{
 					packet_received = true;
-					for(t=0;t<length;t++)
-					{
-						payload[t] = crc_data[t];
-					}
 				}
 				else
 				{
@@ -422,8 +463,7 @@ bool CORE_TELEMETRY::receivePacketFromSharedBuff(uint32_t address, uint8_t paylo
 void CORE_TELEMETRY::sendPacketToSharedBuff(uint32_t address, uint16_t command, uint8_t data[], uint16_t length)
 {
   uint16_t k = 0;
-  uint16_t t = 0;
-  uint8_t  buffer[1024] = {0};
+  uint8_t  buffer[1024];	///< Every byte up to k is written below, no need to clear it
 
   buffer[k++] = HDR_1;
   buffer[k++] = HDR_2;
@@ -434,10 +474,8 @@ void CORE_TELEMETRY::sendPacketToSharedBuff(uint32_t address, uint16_t command,
   buffer[k++] = (uint8_t)(length%256);
   buffer[k++] = (uint8_t)(length/256);
 
-  for(t = 0; t < length; t++)
-  {
-      buffer[k++] = data[t];
-  }
+  std::memcpy(&buffer[k], data, length);
+  k += length;
 
   calculateCrc16(&buffer[2], k-2, 0, false);
   k += 2;
@@ -446,6 +484,19 @@ void CORE_TELEMETRY::sendPacketToSharedBuff(uint32_t address, uint16_t command,
   inter_core.sendDataToSharedRam(address,buffer, k);
 }
 
+/**
+  * @brief 		CRC16 of a record which is written in place, e.g. into a shared buffer slot
+  *
+  * @param[in]	const uint8_t data[]
+  * @param[in]	uint16_t length
+  *
+  * @return 		uint16_t crc
+  */
+uint16_t CORE_TELEMETRY::calculatePacketCrc(const uint8_t data[], uint16_t length)
+{
+	return calculateCrc16(data, length);
+}
+
 /**
  * @brief		Processes the received packet
  *
@@ -101,6 +101,7 @@ class CORE_TELEMETRY: public BASE
 
 		bool receivePacketFromSharedBuff(uint32_t address, uint8_t payload[], uint16_t payload_size);
 		void sendPacketToSharedBuff(uint32_t address, uint16_t command, uint8_t data[], uint16_t length);
+		uint16_t calculatePacketCrc(const uint8_t data[], uint16_t length);
 
 		CORE_TELEMETRY(const CORE_TELEMETRY &orig);
 		virtual ~CORE_TELEMETRY();
@@ -39,6 +39,7 @@ extern I2C_HandleTypeDef hi2c4;
 void MX_I2C4_Init(void);
 
 /* USER CODE BEGIN Prototypes */
+void DS_I2C_ErrorInterruptHandler(I2C_HandleTypeDef *hi2c);
 
 /* USER CODE END Prototypes */
 
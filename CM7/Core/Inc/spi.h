@@ -39,6 +39,7 @@ extern SPI_HandleTypeDef hspi2;
 void MX_SPI2_Init(void);
 
 /* USER CODE BEGIN Prototypes */
+void DS_SPI_DmaInterruptHandler(SPI_HandleTypeDef *hspi);
 
 /* USER CODE END Prototypes */
 
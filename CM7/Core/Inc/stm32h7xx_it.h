@@ -71,7 +71,7 @@ void I2C4_EV_IRQHandler(void);
 void I2C4_ER_IRQHandler(void);
 void LPUART1_IRQHandler(void);
 /* USER CODE BEGIN EFP */
-
+void HSEM1_IRQHandler(void);
 /* USER CODE END EFP */
 
 #ifdef __cplusplus
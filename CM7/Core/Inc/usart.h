@@ -55,6 +55,7 @@ void MX_USART3_UART_Init(void);
 void MX_USART6_UART_Init(void);
 
 /* USER CODE BEGIN Prototypes */
+void DS_UART_DmaInterruptHandler(UART_HandleTypeDef *huart);
 
 /* USER CODE END Prototypes */
 
@@ -0,0 +1,250 @@
+/**
+ ******************************************************************************
+  * @file		: ds_cache_h747.cpp
+  * @brief		: Cache and MPU source file
+  *				  This file contains the MPU region map and the L1 cache maintenance of the CM7
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+
+/*
+ * Begin of Includes
+ */
+#include "ds_cache_h747.hpp"
+#include "main.h"
+// End of Includes
+
+
+
+/*
+ * Begin of Object Definitions
+ */
+Peripherals::Cache::H747_CACHE cache;
+//End of Object Definitions
+
+
+
+namespace Peripherals
+{
+
+namespace Cache
+{
+
+
+
+/*
+ * Begin of Local Constant Definitions
+ */
+static const uint32_t DTCM_SIZE		  = 0x00020000;
+static const uint32_t AXI_SRAM_SIZE	  = 0x00080000;
+static const uint32_t SRAM4_SIZE	  = 0x00010000;
+
+/**
+ * @brief MPU regions in ascending priority, the last matching region wins
+ */
+static const mpu_region_type MPU_REGION[] =
+{
+	/* Background: the FMC, QSPI and reserved space from 0x60000000 to 0xDFFFFFFF can not be read speculatively */
+	{ 0x00000000,	   MPU_REGION_SIZE_4GB,	  0x87, MPU_TEX_LEVEL0, MPU_REGION_NO_ACCESS,	MPU_INSTRUCTION_ACCESS_DISABLE, MPU_ACCESS_SHAREABLE, MPU_ACCESS_NOT_CACHEABLE, MPU_ACCESS_NOT_BUFFERABLE },
+	/* AXI SRAM: serializer slots read by the CM4, UART and SPI DMA buffers. Executable for the RAM linker script */
+	{ D1_AXISRAM_BASE, MPU_REGION_SIZE_512KB, 0x00, MPU_TEX_LEVEL1, MPU_REGION_FULL_ACCESS, MPU_INSTRUCTION_ACCESS_ENABLE,	MPU_ACCESS_SHAREABLE, MPU_ACCESS_NOT_CACHEABLE, MPU_ACCESS_NOT_BUFFERABLE },
+	/* SRAM4: inter-core rings, heartbeats and serializer handshake variables */
+	{ D3_SRAM_BASE,	   MPU_REGION_SIZE_64KB,  0x00, MPU_TEX_LEVEL1, MPU_REGION_FULL_ACCESS, MPU_INSTRUCTION_ACCESS_DISABLE, MPU_ACCESS_SHAREABLE, MPU_ACCESS_NOT_CACHEABLE, MPU_ACCESS_NOT_BUFFERABLE },
+};
+static const uint8_t MPU_REGION_COUNT = sizeof(MPU_REGION) / sizeof(MPU_REGION[0]);
+//End of Local Constant Definitions
+
+
+
+/**
+  * @brief Default constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+H747_CACHE::H747_CACHE():
+data_cache_enabled(false)
+{ }
+
+
+
+/**
+  * @brief 		Programs the MPU regions and enables the instruction and data caches. It must
+  *				run before any DMA or inter-core transfer is started.
+  *
+  * @param[in]  void
+  *
+  * @return 	bool	true
+  */
+bool H747_CACHE::initialize(void)
+{
+	MPU_Region_InitTypeDef region = {};
+	uint8_t				   index  = 0;
+
+	HAL_MPU_Disable();
+
+	for(index = 0; index < MPU_REGION_COUNT; index++)
+	{
+		region.Enable			= MPU_REGION_ENABLE;
+		region.Number			= index;
+		region.BaseAddress		= MPU_REGION[index].base;
+		region.Size				= MPU_REGION[index].size;
+		region.SubRegionDisable = MPU_REGION[index].subregion_disable;
+		region.TypeExtField		= MPU_REGION[index].type_extension;
+		region.AccessPermission = MPU_REGION[index].access;
+		region.DisableExec		= MPU_REGION[index].execute_never;
+		region.IsShareable		= MPU_REGION[index].shareable;
+		region.IsCacheable		= MPU_REGION[index].cacheable;
+		region.IsBufferable		= MPU_REGION[index].bufferable;
+		HAL_MPU_ConfigRegion(&region);
+	}
+
+	HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+
+#ifndef DS_SIMULATION
+	SCB_EnableICache();
+	SCB_EnableDCache();
+#endif
+	data_cache_enabled = true;
+
+	return true;
+}
+
+
+
+/**
+  * @brief 		Checks whether a buffer is held in the data cache
+  *
+  * @param[in]  const void *address
+  *
+  * @return 	bool	false : data cache disabled, DTCM, AXI SRAM or SRAM4
+  */
+bool H747_CACHE::isCacheable(const void *address) const
+{
+	const uintptr_t location = reinterpret_cast<uintptr_t>(address);
+
+	if((data_cache_enabled == false) || (address == nullptr))
+	{
+		return false;
+	}
+
+	return !(((location >= D1_DTCMRAM_BASE) && (location < (D1_DTCMRAM_BASE + DTCM_SIZE))) ||
+			 ((location >= D1_AXISRAM_BASE) && (location < (D1_AXISRAM_BASE + AXI_SRAM_SIZE))) ||
+			 ((location >= D3_SRAM_BASE) && (location < (D3_SRAM_BASE + SRAM4_SIZE))));
+}
+
+
+
+/**
+  * @brief 		Checks whether a DMA may write into a buffer. A cached receive buffer must cover
+  *				whole cache lines, the invalidation would drop the neighbouring data otherwise.
+  *
+  * @param[in]  const void *address
+  * @param[in]  uint32_t size
+  *
+  * @return 	bool
+  */
+bool H747_CACHE::isReceiveBufferValid(const void *address, uint32_t size) const
+{
+	return (isCacheable(address) == false) ||
+		   (((reinterpret_cast<uintptr_t>(address) & CACHE_LINE_MASK) == 0U) && ((size & CACHE_LINE_MASK) == 0U));
+}
+
+
+
+/**
+  * @brief 		Writes the cached data of a buffer back to the memory before a DMA reads it
+  *
+  * @param[in]  const void *address
+  * @param[in]  uint32_t size
+  *
+  * @return 	void
+  */
+void H747_CACHE::cleanRange(const void *address, uint32_t size) const
+{
+	if((isCacheable(address) == false) || (size == 0U))
+	{
+		return;
+	}
+
+#ifndef DS_SIMULATION	/* The host memory is coherent */
+	const uintptr_t start = reinterpret_cast<uintptr_t>(address) & ~static_cast<uintptr_t>(CACHE_LINE_MASK);
+
+	SCB_CleanDCache_by_Addr(reinterpret_cast<uint32_t *>(start),
+							static_cast<int32_t>(reinterpret_cast<uintptr_t>(address) + size - start));
+#endif
+}
+
+
+
+/**
+  * @brief 		Drops the cached lines of a buffer, before a DMA writes it and again after the
+  *				transfer, the lines may be fetched speculatively in between
+  *
+  * @param[in]  void *address		: Cache line aligned, see isReceiveBufferValid
+  * @param[in]  uint32_t size
+  *
+  * @return 	void
+  */
+void H747_CACHE::invalidateRange(void *address, uint32_t size) const
+{
+	if((isCacheable(address) == false) || (size == 0U))
+	{
+		return;
+	}
+
+#ifndef DS_SIMULATION
+	SCB_InvalidateDCache_by_Addr(reinterpret_cast<uint32_t *>(address), static_cast<int32_t>(size));
+#endif
+}
+
+
+
+/**
+  * @brief      Default copy constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+H747_CACHE::H747_CACHE(const H747_CACHE& orig):
+data_cache_enabled(orig.data_cache_enabled)
+{ }
+
+
+
+/**
+  * @brief      Default destructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+H747_CACHE::~H747_CACHE()
+{ }
+
+
+
+} //End of namespace Cache
+
+} //End of namespace Peripherals
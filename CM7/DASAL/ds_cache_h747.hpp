@@ -0,0 +1,125 @@
+/**
+ ******************************************************************************
+  * @file		: ds_cache_h747.hpp
+  * @brief		: Cache and MPU header file
+  *				  This file contains the MPU region map and the L1 cache maintenance of the CM7
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+#ifndef DS_CACHE_H747_HPP
+#define	DS_CACHE_H747_HPP
+
+
+
+/*
+ * Begin of Includes
+ */
+#include <stdint.h>
+// End of Includes
+
+
+
+namespace Peripherals
+{
+
+namespace Cache
+{
+
+
+
+/*
+ * Begin of Macro Definitions
+ */
+const uint32_t CACHE_LINE_SIZE		= 32;		///< Cortex-M7 L1 data cache line
+const uint32_t CACHE_LINE_MASK		= CACHE_LINE_SIZE - 1;
+//End of Macro Definitions
+
+
+
+/*
+ * Begin of Enum, Union and Struct Definitions
+ */
+/**
+ * @brief One MPU region of the CM7 memory map
+ */
+struct mpu_region_type
+{
+	uint32_t base;
+	uint8_t	 size;					///< MPU_REGION_SIZE_xxx
+	uint8_t	 subregion_disable;
+	uint8_t	 type_extension;		///< MPU_TEX_LEVELx
+	uint8_t	 access;				///< MPU_REGION_FULL_ACCESS or MPU_REGION_NO_ACCESS
+	uint8_t	 execute_never;
+	uint8_t	 shareable;
+	uint8_t	 cacheable;
+	uint8_t	 bufferable;
+};
+// End of Enum, Union and Struct Definitions
+
+
+
+/*
+ * Begin of H747_CACHE Class Definition
+ */
+/**
+ * @brief Sets up the MPU and enables the L1 caches. The AXI SRAM and the SRAM4 carry the
+ *		  inter-core data and the DMA1/2 buffers and are not cacheable. The DTCM is never
+ *		  cached. The flash and the D2 SRAM are cached, so a DMA buffer in the D2 SRAM has to
+ *		  be cleaned before and invalidated after the transfer with the helpers below.
+ */
+class H747_CACHE
+{
+	public:
+		H747_CACHE();
+
+		bool initialize				( void );
+		bool isCacheable			( const void *address ) const;
+		bool isReceiveBufferValid	( const void *address, uint32_t size ) const;
+		void cleanRange				( const void *address, uint32_t size ) const;
+		void invalidateRange		( void *address, uint32_t size ) const;
+
+		H747_CACHE(const H747_CACHE& orig);
+		virtual ~H747_CACHE();
+
+	protected:
+
+	private:
+		bool data_cache_enabled;
+};
+// End of H747_CACHE Class Definition
+
+
+
+} //End of namespace Cache
+
+} //End of namespace Peripherals
+
+
+
+/*
+ * External Linkages
+ */
+extern Peripherals::Cache::H747_CACHE cache;
+// End of External Linkages
+
+
+#endif	/* DS_CACHE_H747_HPP */
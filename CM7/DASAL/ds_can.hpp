@@ -72,7 +72,6 @@ class BASE
 		virtual void 	 sendData			(uint8_t buffer[], uint16_t size) = 0;
 		virtual uint16_t getDataFromBuffer	(uint8_t buffer[]) = 0;
 
-		virtual void receiveByte	(uint8_t byte)=0;
 		virtual bool transmit		(void)=0;
 
 		BASE(const BASE& orig);
@@ -29,11 +29,47 @@
 /*
  * Begin of Includes
  */
+#include <cstring>
 #include "ds_can_h747.hpp"
 // End of Includes
 
 
 
+/*
+ * Begin of Macro Definitions
+ */
+/**
+ * @brief Message RAM layout of one FDCAN in words, FDCAN2 follows FDCAN1 in the shared 10KB SRAMCAN
+ */
+static const uint32_t CAN_STANDARD_FILTER_OFFSET	= 0;
+static const uint32_t CAN_EXTENDED_FILTER_OFFSET	= CAN_STANDARD_FILTER_OFFSET + Peripherals::Can::CAN_STANDARD_FILTER_NUMBER;
+static const uint32_t CAN_RX_FIFO0_OFFSET			= CAN_EXTENDED_FILTER_OFFSET + (Peripherals::Can::CAN_EXTENDED_FILTER_NUMBER * 2);
+static const uint32_t CAN_RX_FIFO1_OFFSET			= CAN_RX_FIFO0_OFFSET + (Peripherals::Can::CAN_RX_FIFO0_SIZE * Peripherals::Can::CAN_ELEMENT_WORDS);
+static const uint32_t CAN_TX_BUFFER_OFFSET			= CAN_RX_FIFO1_OFFSET + (Peripherals::Can::CAN_RX_FIFO1_SIZE * Peripherals::Can::CAN_ELEMENT_WORDS);
+static const uint32_t CAN_MESSAGE_RAM_WORDS			= CAN_TX_BUFFER_OFFSET + (Peripherals::Can::CAN_TX_QUEUE_SIZE * Peripherals::Can::CAN_ELEMENT_WORDS);
+
+/**
+ * @brief Fields of the message RAM elements, RM0399 FDCAN message RAM chapter
+ */
+static const uint32_t CAN_ELEMENT_XTD				= 0x40000000;	///< T0/R0 extended identifier
+static const uint32_t CAN_ELEMENT_STANDARD_ID_POS	= 18;
+static const uint32_t CAN_ELEMENT_EXTENDED_ID_MASK	= 0x1FFFFFFF;
+static const uint32_t CAN_ELEMENT_STANDARD_ID_MASK	= 0x7FF;
+static const uint32_t CAN_ELEMENT_FDF				= 0x00200000;	///< T1/R1 FD format
+static const uint32_t CAN_ELEMENT_BRS				= 0x00100000;	///< T1/R1 bit rate switch
+static const uint32_t CAN_ELEMENT_DLC_POS			= 16;
+static const uint32_t CAN_FILTER_TYPE_CLASSIC		= 2;			///< Id and mask
+static const uint32_t CAN_FILTER_STORE_FIFO0		= 1;
+static const uint32_t CAN_FILTER_STORE_FIFO1		= 2;
+static const uint32_t CAN_ELEMENT_SIZE_64_BYTE		= 7;			///< RXESC and TXESC data field size code
+static const uint32_t CAN_GFC_REJECT				= 2;			///< Non-matching frames are dropped by the hardware
+
+static const uint8_t  CAN_CLASSIC_PAYLOAD_SIZE		= 8;
+static const uint8_t  CAN_DLC_SIZE[16]				= { 0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64 };
+//End of Macro Definitions
+
+
+
 /*
  * Begin of Object Definitions
  */
@@ -42,6 +78,110 @@ Peripherals::Can::H747_CAN can1(Peripherals::Can::can_module_type::H747_FDCAN1);
 
 
 
+/**
+  * @brief 		Smallest data length code which holds size bytes
+  *
+  * @param[in]  uint8_t size
+  *
+  * @return 	uint8_t
+  */
+static uint8_t sizeToDlc(uint8_t size)
+{
+	uint8_t dlc = 0;
+
+	while( (dlc < 15) && (CAN_DLC_SIZE[dlc] < size) )
+	{
+		dlc++;
+	}
+
+	return dlc;
+}
+
+
+
+/**
+  * @brief 		View of a frame, its data is the payload of the frame
+  *
+  * @param[in]  const Peripherals::Can::can_frame_type &frame
+  *
+  * @return 	can_frame_view_type
+  */
+static inline Peripherals::Can::can_frame_view_type getFrameView(const Peripherals::Can::can_frame_type &frame)
+{
+	Peripherals::Can::can_frame_view_type view = {};
+
+	view.id				 = frame.id;
+	view.extended		 = frame.extended;
+	view.fd				 = frame.fd;
+	view.bit_rate_switch = frame.bit_rate_switch;
+	view.data			 = frame.data;
+	view.data_size		 = frame.size;
+
+	return view;
+}
+
+
+
+/**
+  * @brief 		Start address field of the configuration registers, byte offset in the SRAMCAN
+  *
+  * @param[in]  const uint32_t *element
+  *
+  * @return 	uint32_t
+  */
+static inline uint32_t getRamAddressField(const uint32_t *element)
+{
+	return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(element) - SRAMCAN_BASE) & FDCAN_SIDFC_FLSSA_Msk;
+}
+
+
+
+/**
+  * @brief 		Queues the transmit buffers, the peripheral sends them in identifier order
+  *
+  * @param[in]  FDCAN_GlobalTypeDef *fdcan
+  * @param[in]  uint32_t buffers : One bit per transmit buffer
+  *
+  * @return 	void
+  */
+static inline void requestTransmission(FDCAN_GlobalTypeDef *fdcan, uint32_t buffers)
+{
+#ifdef DS_SIMULATION
+	simulateCanTransmitRequest(fdcan, buffers);
+#else
+	WRITE_REG(fdcan->TXBAR, buffers);
+#endif
+}
+
+
+
+/**
+  * @brief 		Frees a receive FIFO up to and including index
+  *
+  * @param[in]  FDCAN_GlobalTypeDef *fdcan
+  * @param[in]  can_fifo_type fifo
+  * @param[in]  uint32_t index : Last read element
+  *
+  * @return 	void
+  */
+static inline void acknowledgeReceive(FDCAN_GlobalTypeDef *fdcan, Peripherals::Can::can_fifo_type fifo, uint32_t index)
+{
+#ifdef DS_SIMULATION
+	simulateCanAcknowledge(fdcan, static_cast<uint8_t>(fifo), index);
+#else
+	if(fifo == Peripherals::Can::can_fifo_type::FIFO0)
+	{
+		WRITE_REG(fdcan->RXF0A, index);
+	}
+	else
+	{
+		WRITE_REG(fdcan->RXF1A, index);
+	}
+#endif
+}
+
+
+
 namespace Peripherals
 {
 
@@ -64,7 +204,10 @@ can_number(can_number)
 
 
 /**
-  * @brief 		TBD
+  * @brief 		Configures the pins, the kernel clock, the bit timings and the message RAM and
+  *				starts the peripheral. FD frames with bit rate switching are enabled, frames
+  *				which do not pass a filter are dropped by the hardware. Reception is polled
+  *				with receiveFrames, no interrupt is enabled.
   *
   * @param[in]  void	Nothing
   *
@@ -72,70 +215,732 @@ can_number(can_number)
   */
 void H747_CAN::initialize(void)
 {
-
+	FDCAN_GlobalTypeDef *fdcan = getInstance();
+	uint32_t			*ram   = getMessageRam();
+	GPIO_InitTypeDef	 gpio  = {0};
+	GPIO_TypeDef		*port  = GPIOD;
+	uint32_t			 index = 0;
+
+	initialized = false;
+
+	if(can_number == can_module_type::H747_FDCAN1)
+	{
+		__HAL_RCC_GPIOD_CLK_ENABLE();
+		gpio.Pin	   = GPIO_PIN_0 | GPIO_PIN_1;	///< PD0 RX, PD1 TX
+		gpio.Alternate = GPIO_AF9_FDCAN1;
+		port		   = GPIOD;
+	}
+	else
+	{
+		__HAL_RCC_GPIOB_CLK_ENABLE();
+		gpio.Pin	   = GPIO_PIN_12 | GPIO_PIN_13;	///< PB12 RX, PB13 TX
+		gpio.Alternate = GPIO_AF9_FDCAN2;
+		port		   = GPIOB;
+	}
+	gpio.Mode  = GPIO_MODE_AF_PP;
+	gpio.Pull  = GPIO_NOPULL;
+	gpio.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+	HAL_GPIO_Init(port, &gpio);
+
+	__HAL_RCC_FDCAN_CONFIG(RCC_FDCANCLKSOURCE_HSE);
+	__HAL_RCC_FDCAN_CLK_ENABLE();
+
+	if(enterConfiguration() == false)
+	{
+		return;
+	}
+
+	MODIFY_REG(fdcan->CCCR, FDCAN_CCCR_DAR | FDCAN_CCCR_MON | FDCAN_CCCR_TEST | FDCAN_CCCR_ASM,
+			   FDCAN_CCCR_FDOE | FDCAN_CCCR_BRSE);
+	WRITE_REG(fdcan->NBTP, ( static_cast<uint32_t>(nominal_timing.jump_width - 1) << FDCAN_NBTP_NSJW_Pos )  |
+						   ( static_cast<uint32_t>(nominal_timing.prescaler - 1)  << FDCAN_NBTP_NBRP_Pos )  |
+						   ( static_cast<uint32_t>(nominal_timing.segment1 - 1)   << FDCAN_NBTP_NTSEG1_Pos )|
+						   ( static_cast<uint32_t>(nominal_timing.segment2 - 1)   << FDCAN_NBTP_NTSEG2_Pos ));
+	WRITE_REG(fdcan->DBTP, FDCAN_DBTP_TDC |
+						   ( static_cast<uint32_t>(data_timing.prescaler - 1)  << FDCAN_DBTP_DBRP_Pos )  |
+						   ( static_cast<uint32_t>(data_timing.segment1 - 1)   << FDCAN_DBTP_DTSEG1_Pos )|
+						   ( static_cast<uint32_t>(data_timing.segment2 - 1)   << FDCAN_DBTP_DTSEG2_Pos )|
+						   ( static_cast<uint32_t>(data_timing.jump_width - 1) << FDCAN_DBTP_DSJW_Pos ));
+	/* Secondary sample point at the data sample point, in kernel clock periods */
+	WRITE_REG(fdcan->TDCR, ( static_cast<uint32_t>(data_timing.prescaler * (data_timing.segment1 + 1)) << FDCAN_TDCR_TDCO_Pos ) & FDCAN_TDCR_TDCO_Msk);
+
+	for(index = 0; index < CAN_MESSAGE_RAM_WORDS; index++)
+	{
+		ram[index] = 0;
+	}
+
+	WRITE_REG(fdcan->XIDAM, CAN_ELEMENT_EXTENDED_ID_MASK);
+	WRITE_REG(fdcan->RXF0C, getRamAddressField(&ram[CAN_RX_FIFO0_OFFSET]) | ( static_cast<uint32_t>(CAN_RX_FIFO0_SIZE) << FDCAN_RXF0C_F0S_Pos ));
+	WRITE_REG(fdcan->RXF1C, getRamAddressField(&ram[CAN_RX_FIFO1_OFFSET]) | ( static_cast<uint32_t>(CAN_RX_FIFO1_SIZE) << FDCAN_RXF1C_F1S_Pos ));
+	WRITE_REG(fdcan->RXBC,	0);
+	WRITE_REG(fdcan->RXESC, ( CAN_ELEMENT_SIZE_64_BYTE << FDCAN_RXESC_F0DS_Pos ) |
+							( CAN_ELEMENT_SIZE_64_BYTE << FDCAN_RXESC_F1DS_Pos ) |
+							( CAN_ELEMENT_SIZE_64_BYTE << FDCAN_RXESC_RBDS_Pos ));
+	WRITE_REG(fdcan->TXBC,	getRamAddressField(&ram[CAN_TX_BUFFER_OFFSET]) | FDCAN_TXBC_TFQM |
+							( static_cast<uint32_t>(CAN_TX_QUEUE_SIZE) << FDCAN_TXBC_TFQS_Pos ));
+	WRITE_REG(fdcan->TXESC, CAN_ELEMENT_SIZE_64_BYTE << FDCAN_TXESC_TBDS_Pos);
+	WRITE_REG(fdcan->TXEFC, 0);
+	WRITE_REG(fdcan->GFC,	( CAN_GFC_REJECT << FDCAN_GFC_ANFS_Pos ) | ( CAN_GFC_REJECT << FDCAN_GFC_ANFE_Pos ) |
+							FDCAN_GFC_RRFS | FDCAN_GFC_RRFE);
+	WRITE_REG(fdcan->IE,	0);
+	WRITE_REG(fdcan->ILE,	0);
+	writeFilters();
+
+	initialized = leaveConfiguration();
 }
 
 
 
 /**
-  * @brief 		TBD
+  * @brief 		Sends a byte stream as 64 byte FD frames on the transmit id
   *
-  * @param[in]  uint8_t buffer[]: TBD
-  * @param[in]  uint16_t size   : TBD
+  * @param[in]  uint8_t buffer[]: Data
+  * @param[in]  uint16_t size   : Number of bytes
   *
   * @return 	void	Nothing
   */
 void H747_CAN::sendData(uint8_t buffer[], uint16_t size)
 {
-
+	can_frame_type frame = {};
+	uint16_t	   offset = 0;
+
+	frame.id			  = transmit_id;
+	frame.extended		  = transmit_id_extended;
+	frame.fd			  = true;
+	frame.bit_rate_switch = true;
+
+	while(offset < size)
+	{
+		frame.size = static_cast<uint8_t>( (size - offset) < CAN_MAXIMUM_PAYLOAD_SIZE ? (size - offset) : CAN_MAXIMUM_PAYLOAD_SIZE );
+		std::memcpy(frame.data, &buffer[offset], frame.size);
+		if(sendFrame(frame) == false)
+		{
+			break;
+		}
+		offset += frame.size;
+	}
 }
 
 
 
 /**
-  * @brief 		TBD
+  * @brief 		Takes the payload of the oldest frame of FIFO1. FIFO0 carries the flight critical
+  *				traffic and is drained by its owner, e.g. the telemetry transport.
   *
-  * @param[out]  uint8_t buffer[] : TBD
-  * @param[out]  uint16_t &size   : TBD
+  * @param[out]  uint8_t buffer[] : At least CAN_MAXIMUM_PAYLOAD_SIZE bytes
   *
-  * @return 	void	Nothing
+  * @return 	uint16_t : Number of bytes, 0 if FIFO1 is empty
   */
 uint16_t H747_CAN::getDataFromBuffer(uint8_t buffer[])
 {
-	return 0;
+	can_element_type element = {};
+
+	if(peekFrames(can_fifo_type::FIFO1, &element, 1) == 0)
+	{
+		return 0;
+	}
+	readPayload(element, 0, buffer, element.size);
+	releaseFrames(can_fifo_type::FIFO1, 1);
+
+	return element.size;
 }
 
 
 
 
 /**
-  * @brief 		TBD
+  * @brief 		The transmit queue is run by the peripheral
   *
-  * @param[in]  uint8_t temp_byte : TBD
+  * @return 	bool : true while frames wait in the transmit queue
+  */
+bool H747_CAN::transmit(void)
+{
+	return (getPendingFrames() != 0);
+}
+
+
+
+/**
+  * @brief 		Adds a hardware filter, frames matching it are stored in the given FIFO.
+  *				A running peripheral is stopped for a moment to take the new filter list.
   *
-  * @return 	void	Nothing
+  * @param[in]  uint32_t id			: Identifier to match
+  * @param[in]  uint32_t mask		: Identifier bits which must match, all ones for one id
+  * @param[in]  bool extended		: 29 bit filter
+  * @param[in]  can_fifo_type fifo	: FIFO0 for flight critical, FIFO1 for low priority traffic
+  *
+  * @return 	bool : false if the filter bank is full or the peripheral did not restart
   */
-void H747_CAN::receiveByte(uint8_t temp_byte)
+bool H747_CAN::addFilter(uint32_t id, uint32_t mask, bool extended, can_fifo_type fifo)
 {
+	bool result = true;
+
+	if( ( (extended == true)  && (extended_filter_number >= CAN_EXTENDED_FILTER_NUMBER) ) ||
+		( (extended == false) && (standard_filter_number >= CAN_STANDARD_FILTER_NUMBER) ) )
+	{
+		return false;
+	}
+
+	filter[standard_filter_number + extended_filter_number] = { id, mask, extended, fifo };
+	if(extended == true)
+	{
+		extended_filter_number++;
+	}
+	else
+	{
+		standard_filter_number++;
+	}
+
+	if(initialized == true)
+	{
+		result = enterConfiguration();
+		if(result == true)
+		{
+			writeFilters();
+		}
+		initialized = leaveConfiguration();
+		result		= result && initialized;
+	}
+
+	return result;
+}
+
 
+
+/**
+  * @brief 		Changes the bit timings, they are taken by the next initialize
+  *
+  * @param[in]  const can_bit_timing_type &nominal : Arbitration phase
+  * @param[in]  const can_bit_timing_type &data	   : Data phase of the frames with bit rate switching
+  *
+  * @return 	void
+  */
+void H747_CAN::setBitTiming(const can_bit_timing_type &nominal, const can_bit_timing_type &data)
+{
+	nominal_timing = nominal;
+	data_timing	   = data;
 }
 
 
 
 /**
-  * @brief 		TBD
+  * @brief 		Sets the identifier of the frames sent by sendData
   *
-  * @param[in]  uint8_t temp_byte : TBD
+  * @param[in]  uint32_t id
+  * @param[in]  bool extended
   *
-  * @return 	bool result
+  * @return 	void
   */
-bool H747_CAN::transmit(void)
+void H747_CAN::setTransmitId(uint32_t id, bool extended)
+{
+	transmit_id			 = id;
+	transmit_id_extended = extended;
+}
+
+
+
+/**
+  * @brief 		Writes a frame into the free transmit buffer given by the queue and requests it
+  *
+  * @param[in]  const can_frame_type &frame
+  *
+  * @return 	bool : false if the queue is full, the node is bus-off or the size is not valid
+  */
+bool H747_CAN::sendFrame(const can_frame_type &frame)
+{
+	FDCAN_GlobalTypeDef		  *fdcan = getInstance();
+	const can_frame_view_type  view	 = getFrameView(frame);
+	uint32_t				   index = 0;
+
+	if( (isTransmitAllowed(view) == false) || ( READ_BIT(fdcan->TXFQS, FDCAN_TXFQS_TFQF) != 0U ) )
+	{
+		transmit_reject_counter++;
+		return false;
+	}
+
+	index = ( READ_REG(fdcan->TXFQS) & FDCAN_TXFQS_TFQPI_Msk ) >> FDCAN_TXFQS_TFQPI_Pos;
+	writeFrame(index, view);
+	requestTransmission(fdcan, 1U << index);
+	transmit_counter++;
+
+	return true;
+}
+
+
+
+/**
+  * @brief 		Writes the frames into free transmit buffers in ascending order and requests
+  *				them with one write, see the sendFrames of the frame views
+  *
+  * @param[in]  const can_frame_type frames[]
+  * @param[in]  uint8_t count
+  *
+  * @return 	uint32_t : Buffers used, one bit each, 0 if the frames do not fit or one is not valid
+  */
+uint32_t H747_CAN::sendFrames(const can_frame_type frames[], uint8_t count)
+{
+	can_frame_view_type view[CAN_TX_QUEUE_SIZE];
+	uint8_t				frame = 0;
+
+	if(count > CAN_TX_QUEUE_SIZE)
+	{
+		transmit_reject_counter += count;
+		return 0;
+	}
+
+	for(frame = 0; frame < count; frame++)
+	{
+		view[frame] = getFrameView(frames[frame]);
+	}
+
+	return sendFrames(view, count);
+}
+
+
+
+/**
+  * @brief 		Writes the frames into free transmit buffers in ascending order and requests
+  *				them with one write. The queue sends the lowest identifier first and, for the
+  *				same identifier, the lowest buffer, so the frames of one call leave in order.
+  *				A free buffer below a pending frame with the same identifier would overtake it:
+  *				the caller must wait with the next frames of an identifier until the buffers
+  *				returned for the previous ones are sent, see isTransmitPending.
+  *
+  * @param[in]  const can_frame_view_type frames[]
+  * @param[in]  uint8_t count
+  *
+  * @return 	uint32_t : Buffers used, one bit each, 0 if the frames do not fit or one is not valid
+  */
+uint32_t H747_CAN::sendFrames(const can_frame_view_type frames[], uint8_t count)
+{
+	FDCAN_GlobalTypeDef *fdcan	 = getInstance();
+	const uint32_t		 pending = READ_REG(fdcan->TXBRP);
+	uint32_t			 buffers = 0;
+	uint32_t			 index	 = 0;
+	uint8_t				 frame	 = 0;
+
+	for(frame = 0; frame < count; frame++)
+	{
+		if(isTransmitAllowed(frames[frame]) == false)
+		{
+			transmit_reject_counter += count;
+			return 0;
+		}
+	}
+	if( (count == 0) || ( (CAN_TX_QUEUE_SIZE - getPendingFrames()) < count ) )
+	{
+		transmit_reject_counter += count;
+		return 0;
+	}
+
+	for(frame = 0; frame < count; frame++)
+	{
+		while( (pending & (1U << index)) != 0U )
+		{
+			index++;
+		}
+		writeFrame(index, frames[frame]);
+		buffers |= (1U << index);
+		index++;
+	}
+	requestTransmission(fdcan, buffers);
+	transmit_counter += count;
+
+	return buffers;
+}
+
+
+
+/**
+  * @brief 		Drains up to limit frames of a receive FIFO and frees them with one acknowledge
+  *
+  * @param[in]  can_fifo_type fifo
+  * @param[out] can_frame_type frames[]
+  * @param[in]  uint8_t limit : Size of frames
+  *
+  * @return 	uint8_t : Number of frames read
+  */
+uint8_t H747_CAN::receiveFrames(can_fifo_type fifo, can_frame_type frames[], uint8_t limit)
 {
+	can_element_type element = {};
+	uint8_t			 count	 = 0;
+	uint8_t			 index	 = 0;
+
+	/* One element at a time, the caller gives the room for the copies */
+	for(index = 0; (index < limit) && (peekFrames(fifo, &element, 1) == 1); index++)
+	{
+		frames[index].id			  = element.id;
+		frames[index].extended		  = element.extended;
+		frames[index].fd			  = element.fd;
+		frames[index].bit_rate_switch = element.bit_rate_switch;
+		frames[index].size			  = element.size;
+		readPayload(element, 0, frames[index].data, element.size);
+		releaseFrames(fifo, 1);
+		count++;
+	}
+
+	return count;
+}
+
+
+
+/**
+  * @brief 		Gives the oldest frames of a receive FIFO where they are in the message RAM.
+  *				They stay valid until releaseFrames, the peripheral does not overwrite them.
+  *
+  * @param[in]  can_fifo_type fifo
+  * @param[out] can_element_type elements[]
+  * @param[in]  uint8_t limit : Size of elements
+  *
+  * @return 	uint8_t : Number of frames given
+  */
+uint8_t H747_CAN::peekFrames(can_fifo_type fifo, can_element_type elements[], uint8_t limit)
+{
+	FDCAN_GlobalTypeDef *fdcan	   = getInstance();
+	const bool			 first	   = (fifo == can_fifo_type::FIFO0);
+	const uint32_t		 status	   = (first == true) ? READ_REG(fdcan->RXF0S) : READ_REG(fdcan->RXF1S);	///< Same layout for both FIFOs
+	const uint32_t		 lost_flag = (first == true) ? FDCAN_IR_RF0L : FDCAN_IR_RF1L;
+	const uint32_t		 size	   = (first == true) ? CAN_RX_FIFO0_SIZE : CAN_RX_FIFO1_SIZE;
+	const uint32_t		*ram	   = &getMessageRam()[(first == true) ? CAN_RX_FIFO0_OFFSET : CAN_RX_FIFO1_OFFSET];
+	const uint32_t		 get_index = (status & FDCAN_RXF0S_F0GI_Msk) >> FDCAN_RXF0S_F0GI_Pos;
+	uint32_t			 count	   = (status & FDCAN_RXF0S_F0FL_Msk) >> FDCAN_RXF0S_F0FL_Pos;
+	uint32_t			 index	   = 0;
+
+	if(initialized == false)
+	{
+		return 0;
+	}
+
+	if( READ_BIT(fdcan->IR, lost_flag) != 0U )
+	{
+		receive_lost_counter++;
+		WRITE_REG(fdcan->IR, lost_flag);
+	}
+
+	if(count > limit)
+	{
+		count = limit;
+	}
+	for(index = 0; index < count; index++)
+	{
+		const uint32_t *element = &ram[( (get_index + index) % size ) * CAN_ELEMENT_WORDS];
+
+		elements[index].extended		= ( (element[0] & CAN_ELEMENT_XTD) != 0U );
+		elements[index].id				= (elements[index].extended == true) ? (element[0] & CAN_ELEMENT_EXTENDED_ID_MASK) :
+																			  ( (element[0] >> CAN_ELEMENT_STANDARD_ID_POS) & CAN_ELEMENT_STANDARD_ID_MASK );
+		elements[index].fd				= ( (element[1] & CAN_ELEMENT_FDF) != 0U );
+		elements[index].bit_rate_switch = ( (element[1] & CAN_ELEMENT_BRS) != 0U );
+		elements[index].size			= CAN_DLC_SIZE[(element[1] >> CAN_ELEMENT_DLC_POS) & 0x0FU];
+		elements[index].payload			= &element[2];
+		if( (elements[index].fd == false) && (elements[index].size > CAN_CLASSIC_PAYLOAD_SIZE) )
+		{
+			elements[index].size = CAN_CLASSIC_PAYLOAD_SIZE;
+		}
+	}
+
+	return static_cast<uint8_t>(count);
+}
+
+
+
+/**
+  * @brief 		Frees the oldest frames of a receive FIFO given by peekFrames with one acknowledge
+  *
+  * @param[in]  can_fifo_type fifo
+  * @param[in]  uint8_t count : At most the number given by peekFrames
+  *
+  * @return 	void
+  */
+void H747_CAN::releaseFrames(can_fifo_type fifo, uint8_t count)
+{
+	FDCAN_GlobalTypeDef *fdcan	   = getInstance();
+	const bool			 first	   = (fifo == can_fifo_type::FIFO0);
+	const uint32_t		 status	   = (first == true) ? READ_REG(fdcan->RXF0S) : READ_REG(fdcan->RXF1S);
+	const uint32_t		 size	   = (first == true) ? CAN_RX_FIFO0_SIZE : CAN_RX_FIFO1_SIZE;
+	const uint32_t		 get_index = (status & FDCAN_RXF0S_F0GI_Msk) >> FDCAN_RXF0S_F0GI_Pos;
+
+	if(count != 0)
+	{
+		acknowledgeReceive(fdcan, fifo, (get_index + count - 1) % size);
+		receive_counter += count;
+	}
+}
+
+
+
+/**
+  * @brief 		Copies a part of the payload of a receive element out of the message RAM, which
+  *				is read in words
+  *
+  * @param[in]  const can_element_type &element
+  * @param[in]  uint8_t offset			: First payload byte
+  * @param[out] uint8_t destination[]
+  * @param[in]  uint8_t size			: offset + size is at most element.size
+  *
+  * @return 	void
+  */
+void H747_CAN::readPayload(const can_element_type &element, uint8_t offset, uint8_t destination[], uint8_t size)
+{
+	uint32_t value = 0;
+	uint8_t	 index = 0;
+
+	for(index = 0; index < size; index++)
+	{
+		const uint8_t position = offset + index;
+
+		if( (index == 0) || ( (position & 3U) == 0U ) )
+		{
+			value = element.payload[position / 4U];
+		}
+		destination[index] = static_cast<uint8_t>( value >> ( (position & 3U) * 8U ) );
+	}
+}
+
+
+
+/**
+  * @brief 		Starts the bus-off recovery, the peripheral leaves bus-off after 128 x 11 recessive bits
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void H747_CAN::service(void)
+{
+	FDCAN_GlobalTypeDef *fdcan = getInstance();
+
+	if( (initialized == true) && ( READ_BIT(fdcan->PSR, FDCAN_PSR_BO) != 0U ) && ( READ_BIT(fdcan->CCCR, FDCAN_CCCR_INIT) != 0U ) )
+	{
+		bus_off_counter++;
+		CLEAR_BIT(fdcan->CCCR, FDCAN_CCCR_INIT);
+	}
+}
+
+
+
+/**
+  * @brief 		Tells if initialize started the peripheral
+  *
+  * @return 	bool
+  */
+bool H747_CAN::isInitialized(void) const
+{
+	return initialized;
+}
+
+
+
+/**
+  * @brief 		Number of frames requested and not yet sent
+  *
+  * @return 	uint8_t
+  */
+uint8_t H747_CAN::getPendingFrames(void) const
+{
+	return static_cast<uint8_t>(__builtin_popcount(READ_REG(getInstance()->TXBRP)));
+}
+
+
+
+/**
+  * @brief 		Tells if any of the buffers given by sendFrames is not sent yet
+  *
+  * @param[in]  uint32_t buffers
+  *
+  * @return 	bool
+  */
+bool H747_CAN::isTransmitPending(uint32_t buffers) const
+{
+	return ( (READ_REG(getInstance()->TXBRP) & buffers) != 0U );
+}
+
+
+
+/**
+  * @brief 		Register block of the module
+  *
+  * @return 	FDCAN_GlobalTypeDef*
+  */
+FDCAN_GlobalTypeDef* H747_CAN::getInstance(void) const
+{
+	return (can_number == can_module_type::H747_FDCAN1) ? FDCAN1 : FDCAN2;
+}
+
+
+
+/**
+  * @brief 		First word of the message RAM part of the module
+  *
+  * @return 	uint32_t*
+  */
+uint32_t* H747_CAN::getMessageRam(void) const
+{
+	return reinterpret_cast<uint32_t *>(SRAMCAN_BASE) + ( (can_number == can_module_type::H747_FDCAN1) ? 0 : CAN_MESSAGE_RAM_WORDS );
+}
+
+
+
+/**
+  * @brief 		Stops the peripheral and unlocks the configuration registers
+  *
+  * @return 	bool : false if the peripheral did not stop in CAN_INIT_TIMEOUT_MS
+  */
+bool H747_CAN::enterConfiguration(void)
+{
+	FDCAN_GlobalTypeDef *fdcan = getInstance();
+	const uint32_t		 start = HAL_GetTick();
+
+	CLEAR_BIT(fdcan->CCCR, FDCAN_CCCR_CSR);
+	SET_BIT(fdcan->CCCR, FDCAN_CCCR_INIT);
+	while( ( READ_BIT(fdcan->CCCR, FDCAN_CCCR_INIT) == 0U ) || ( READ_BIT(fdcan->CCCR, FDCAN_CCCR_CSA) != 0U ) )
+	{
+		if( (HAL_GetTick() - start) > CAN_INIT_TIMEOUT_MS )
+		{
+			return false;
+		}
+	}
+	SET_BIT(fdcan->CCCR, FDCAN_CCCR_CCE);
+
 	return true;
 }
 
 
 
+/**
+  * @brief 		Locks the configuration registers and joins the bus after 11 recessive bits
+  *
+  * @return 	bool : false if the peripheral did not start in CAN_INIT_TIMEOUT_MS
+  */
+bool H747_CAN::leaveConfiguration(void)
+{
+	FDCAN_GlobalTypeDef *fdcan = getInstance();
+	const uint32_t		 start = HAL_GetTick();
+
+	CLEAR_BIT(fdcan->CCCR, FDCAN_CCCR_INIT | FDCAN_CCCR_CCE);
+	while( READ_BIT(fdcan->CCCR, FDCAN_CCCR_INIT) != 0U )
+	{
+		if( (HAL_GetTick() - start) > CAN_INIT_TIMEOUT_MS )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+
+/**
+  * @brief 		Writes the filter copies into the message RAM as classic id and mask elements,
+  *				only while the configuration registers are unlocked
+  *
+  * @return 	void
+  */
+void H747_CAN::writeFilters(void)
+{
+	FDCAN_GlobalTypeDef *fdcan	  = getInstance();
+	uint32_t			*ram	  = getMessageRam();
+	uint32_t			 standard = 0;
+	uint32_t			 extended = 0;
+	uint32_t			 index	  = 0;
+
+	for(index = 0; index < static_cast<uint32_t>(standard_filter_number + extended_filter_number); index++)
+	{
+		const uint32_t store = (filter[index].fifo == can_fifo_type::FIFO0) ? CAN_FILTER_STORE_FIFO0 : CAN_FILTER_STORE_FIFO1;
+
+		if(filter[index].extended == true)
+		{
+			ram[CAN_EXTENDED_FILTER_OFFSET + (extended * 2)]	 = (store << 29) | (filter[index].id & CAN_ELEMENT_EXTENDED_ID_MASK);
+			ram[CAN_EXTENDED_FILTER_OFFSET + (extended * 2) + 1] = (CAN_FILTER_TYPE_CLASSIC << 30) | (filter[index].mask & CAN_ELEMENT_EXTENDED_ID_MASK);
+			extended++;
+		}
+		else
+		{
+			ram[CAN_STANDARD_FILTER_OFFSET + standard] = (CAN_FILTER_TYPE_CLASSIC << 30) | (store << 27) |
+														 ( (filter[index].id & CAN_ELEMENT_STANDARD_ID_MASK) << 16 ) |
+														 (filter[index].mask & CAN_ELEMENT_STANDARD_ID_MASK);
+			standard++;
+		}
+	}
+
+	WRITE_REG(fdcan->SIDFC, getRamAddressField(&ram[CAN_STANDARD_FILTER_OFFSET]) | (standard << FDCAN_SIDFC_LSS_Pos));
+	WRITE_REG(fdcan->XIDFC, getRamAddressField(&ram[CAN_EXTENDED_FILTER_OFFSET]) | (extended << FDCAN_XIDFC_LSE_Pos));
+}
+
+
+
+/**
+  * @brief 		Checks the node state and the payload size of a frame to send
+  *
+  * @param[in]  const can_frame_view_type &frame
+  *
+  * @return 	bool : false if the node is not started or bus-off, or the size is not valid
+  */
+bool H747_CAN::isTransmitAllowed(const can_frame_view_type &frame) const
+{
+	const uint16_t size = static_cast<uint16_t>(frame.prefix_size) + frame.data_size;
+
+	return ( (initialized == true) && ( READ_BIT(getInstance()->PSR, FDCAN_PSR_BO) == 0U ) && (frame.prefix_size <= CAN_FRAME_PREFIX_SIZE) &&
+			 ( size <= ( (frame.fd == true) ? CAN_MAXIMUM_PAYLOAD_SIZE : CAN_CLASSIC_PAYLOAD_SIZE ) ) );
+}
+
+
+
+/**
+  * @brief 		Writes a frame into a transmit buffer straight from its prefix and data, the
+  *				payload is padded with zeros up to the next DLC size
+  *
+  * @param[in]  uint32_t index
+  * @param[in]  const can_frame_view_type &frame
+  *
+  * @return 	void
+  */
+void H747_CAN::writeFrame(uint32_t index, const can_frame_view_type &frame)
+{
+	uint32_t	  *element = &getMessageRam()[CAN_TX_BUFFER_OFFSET + (index * CAN_ELEMENT_WORDS)];
+	const uint8_t  size	   = frame.prefix_size + frame.data_size;
+	const uint8_t  dlc	   = sizeToDlc(size);
+	uint32_t	   value   = 0;
+	uint8_t		   data	   = 0;
+	uint8_t		   position = 0;
+
+	element[0] = (frame.extended == true) ? ( CAN_ELEMENT_XTD | (frame.id & CAN_ELEMENT_EXTENDED_ID_MASK) ) :
+											( (frame.id & CAN_ELEMENT_STANDARD_ID_MASK) << CAN_ELEMENT_STANDARD_ID_POS );
+	element[1] = ( static_cast<uint32_t>(dlc) << CAN_ELEMENT_DLC_POS ) |
+				 ( (frame.fd == true) ? CAN_ELEMENT_FDF : 0U ) |
+				 ( ( (frame.fd == true) && (frame.bit_rate_switch == true) ) ? CAN_ELEMENT_BRS : 0U );
+
+	/* The message RAM is written in words */
+	for(position = 0; position < CAN_DLC_SIZE[dlc]; position++)
+	{
+		if(position < frame.prefix_size)
+		{
+			data = frame.prefix[position];
+		}
+		else if(position < size)
+		{
+			data = frame.data[position - frame.prefix_size];
+		}
+		else
+		{
+			data = 0;
+		}
+
+		value |= static_cast<uint32_t>(data) << ( (position & 3U) * 8U );
+		if( (position & 3U) == 3U )
+		{
+			element[2 + (position / 4U)] = value;
+			value						 = 0;
+		}
+	}
+	if( (position & 3U) != 0U )
+	{
+		element[2 + (position / 4U)] = value;
+	}
+}
+
+
+
 
 /**
   * @brief Default copy constructor
@@ -168,4 +973,3 @@ H747_CAN::~H747_CAN()
 } //End of namespace Can
 
 } //End of namespace Peripherals
-
@@ -24,6 +24,7 @@
  ******************************************************************************
   */
 
+
 #ifndef DS_CAN_H747_HPP
 #define	DS_CAN_H747_HPP
 
@@ -33,6 +34,7 @@
  * Begin of Includes
  */
 #include <stdint.h>
+#include "main.h"
 #include "ds_can.hpp"
 // End of Includes
 
@@ -48,7 +50,16 @@ namespace Can
 /*
  * Begin of Macro Definitions
  */
-
+const uint8_t  CAN_MAXIMUM_PAYLOAD_SIZE		= 64;		///< CAN-FD, classic frames carry up to 8 bytes
+const uint8_t  CAN_STANDARD_FILTER_NUMBER	= 28;		///< Hardware filter elements in the message RAM
+const uint8_t  CAN_EXTENDED_FILTER_NUMBER	= 8;
+const uint8_t  CAN_RX_FIFO0_SIZE			= 32;		///< Elements of 64 byte payload
+const uint8_t  CAN_RX_FIFO1_SIZE			= 16;
+const uint8_t  CAN_TX_QUEUE_SIZE			= 16;		///< Sent in identifier order, lowest id first
+const uint8_t  CAN_ELEMENT_WORDS			= 18;		///< Two header words and 64 data bytes
+const uint8_t  CAN_FRAME_PREFIX_SIZE		= 4;		///< Protocol bytes written in front of the data of a frame view
+const uint32_t CAN_INIT_TIMEOUT_MS			= 10;
+const uint32_t CAN_DEFAULT_TRANSMIT_ID		= 0x100;	///< Standard id of the frames sent by sendData
  //End of Macro Definitions
 
 
@@ -56,14 +67,85 @@ namespace Can
 /*
  * Begin of Enum, Union and Struct Definitions
  */
-
-// End of Enum, Union and Struct Definitions
 enum class can_module_type : uint8_t
 {
-	H747_FDCAN1 = 0,	/*!<LPUART handle*/
-	H747_FDCAN2 = 1,	/*!<USART1 handle*/
+	H747_FDCAN1 = 0,	/*!<FDCAN1 handle*/
+	H747_FDCAN2 = 1,	/*!<FDCAN2 handle*/
+};
+
+enum class can_fifo_type : uint8_t
+{
+	FIFO0 = 0,			/*!<Flight critical traffic, drained first*/
+	FIFO1 = 1,			/*!<Low priority traffic*/
+};
+
+/**
+ * @brief One classic or FD frame as it is written to and read from the message RAM
+ */
+struct can_frame_type
+{
+	uint32_t id;
+	bool	 extended;					///< 29 bit identifier
+	bool	 fd;						///< FD format, payload up to 64 bytes
+	bool	 bit_rate_switch;			///< Data phase at the data bit rate, FD only
+	uint8_t	 size;						///< Rounded up to the next DLC size on transmit
+	uint8_t	 data[CAN_MAXIMUM_PAYLOAD_SIZE];
+};
+
+/**
+ * @brief Receive element which stays in the message RAM until it is released, readPayload
+ *		  copies its data straight to the place where the reader needs it
+ */
+struct can_element_type
+{
+	uint32_t		id;
+	bool			extended;
+	bool			fd;
+	bool			bit_rate_switch;
+	uint8_t			size;
+	const uint32_t *payload;			///< Data words of the element in the message RAM
+};
+
+/**
+ * @brief Frame to send whose data is a few protocol bytes followed by caller memory, both are
+ *		  written to the message RAM without a staging copy
+ */
+struct can_frame_view_type
+{
+	uint32_t	   id;
+	bool		   extended;
+	bool		   fd;
+	bool		   bit_rate_switch;
+	uint8_t		   prefix_size;
+	uint8_t		   prefix[CAN_FRAME_PREFIX_SIZE];
+	const uint8_t *data;
+	uint8_t		   data_size;
 };
 
+/**
+ * @brief Bit timing in time quanta of the prescaled FDCAN kernel clock
+ */
+struct can_bit_timing_type
+{
+	uint16_t prescaler;
+	uint16_t segment1;					///< Propagation and phase 1 segments
+	uint8_t	 segment2;
+	uint8_t	 jump_width;
+};
+
+/**
+ * @brief Copy of a hardware filter, the message RAM is rewritten from it on every configuration
+ */
+struct can_filter_type
+{
+	uint32_t	  id;
+	uint32_t	  mask;					///< Set bits must match id
+	bool		  extended;
+	can_fifo_type fifo;
+};
+// End of Enum, Union and Struct Definitions
+
+
 
 /*
  * Begin of H747_CAN Class Definition
@@ -77,9 +159,29 @@ class H747_CAN: public BASE
 		void 	 sendData			(uint8_t buffer[], uint16_t size) override;
 		uint16_t getDataFromBuffer	(uint8_t buffer[]) override;
 
-        void receiveByte	(uint8_t byte) override;
         bool transmit		(void) override;
 
+		bool	 addFilter			(uint32_t id, uint32_t mask, bool extended, can_fifo_type fifo);
+		void	 setBitTiming		(const can_bit_timing_type &nominal, const can_bit_timing_type &data);
+		void	 setTransmitId		(uint32_t id, bool extended);
+		bool	 sendFrame			(const can_frame_type &frame);
+		uint32_t sendFrames			(const can_frame_type frames[], uint8_t count);
+		uint32_t sendFrames			(const can_frame_view_type frames[], uint8_t count);
+		uint8_t	 receiveFrames		(can_fifo_type fifo, can_frame_type frames[], uint8_t limit);
+		uint8_t	 peekFrames			(can_fifo_type fifo, can_element_type elements[], uint8_t limit);
+		void	 releaseFrames		(can_fifo_type fifo, uint8_t count);
+		static void readPayload		(const can_element_type &element, uint8_t offset, uint8_t destination[], uint8_t size);
+		void	 service			(void);
+		bool	 isInitialized		(void) const;
+		uint8_t	 getPendingFrames	(void) const;
+		bool	 isTransmitPending	(uint32_t buffers) const;
+
+		uint32_t transmit_counter		 = 0;
+		uint32_t transmit_reject_counter = 0;	///< Frames refused because of a full queue, bus-off or a bad size
+		uint32_t receive_counter		 = 0;
+		uint32_t receive_lost_counter	 = 0;	///< FIFO overflows reported by the peripheral
+		uint32_t bus_off_counter		 = 0;
+
 		H747_CAN(const H747_CAN& orig);
         virtual ~H747_CAN();
 
@@ -88,14 +190,22 @@ class H747_CAN: public BASE
     private:
         can_module_type  can_number	= can_module_type::H747_FDCAN1;
 
-        uint8_t  receive_buffer[2048] = {0};
-        uint16_t receive_head 		  =  0;
-        uint16_t receive_tail 		  =  0;
-        bool	 buffer_overrun 	  = false;
-
-        uint8_t  transmit_buffer[2048] = {0};
-        uint16_t transmit_head 		   =  0;
-        uint16_t transmit_tail 		   =  0;
+		FDCAN_GlobalTypeDef *getInstance		(void) const;
+		uint32_t			*getMessageRam		(void) const;
+		bool				 enterConfiguration	(void);
+		bool				 leaveConfiguration	(void);
+		void				 writeFilters		(void);
+		bool				 isTransmitAllowed	(const can_frame_view_type &frame) const;
+		void				 writeFrame			(uint32_t index, const can_frame_view_type &frame);
+
+		can_bit_timing_type nominal_timing		= { 1, 19, 5, 5 };	///< 1 Mbit/s at 25 MHz HSE, 80% sample point
+		can_bit_timing_type data_timing			= { 1,  3, 1, 1 };	///< 5 Mbit/s at 25 MHz HSE, 80% sample point
+		can_filter_type		filter[CAN_STANDARD_FILTER_NUMBER + CAN_EXTENDED_FILTER_NUMBER] = {};
+		uint8_t				standard_filter_number	= 0;
+		uint8_t				extended_filter_number	= 0;
+		uint32_t			transmit_id				= CAN_DEFAULT_TRANSMIT_ID;
+		bool				transmit_id_extended	= false;
+		bool				initialized				= false;
 };
 // End of H747_CAN Class Definition
 
@@ -110,8 +220,12 @@ class H747_CAN: public BASE
  * External Linkages
  */
 extern Peripherals::Can::H747_CAN can1;
+
+#ifdef DS_SIMULATION
+extern void simulateCanTransmitRequest	( FDCAN_GlobalTypeDef *fdcan, uint32_t buffers );		///< Host simulation, TXBAR write which queues the frames
+extern void simulateCanAcknowledge		( FDCAN_GlobalTypeDef *fdcan, uint8_t fifo, uint32_t index );	///< Host simulation, RXFnA write which frees the elements
+#endif
 // End of External Linkages
 
 
 #endif	/* DS_CAN_H747_HPP */
-
@@ -116,6 +116,7 @@ enum class time_measure_channel_map_type: uint8_t
 	LOOP_5_HZ						=  9,
 	LOOP_2_HZ						= 10,
 	LOOP_1_HZ						= 11,
+	I2C_BATCH						= 12,	///< Register read batches of the I2C job queue
 };
 
 
@@ -82,7 +82,7 @@ ZEDF9P::ZEDF9P(const ZEDF9P& orig)
  * crc = calculateCRC(buffer,size);
  * @endcode
  */
-uint16_t ZEDF9P::calculateCRC(uint8_t data[],uint16_t length)
+uint16_t ZEDF9P::calculateCRC(const Peripherals::Uart::receive_span_type &data,uint16_t length)
 {
 	uint16_t i;
 	uint8_t ck_a = 0;
@@ -101,20 +101,21 @@ uint16_t ZEDF9P::calculateCRC(uint8_t data[],uint16_t length)
 
 
 /*
- * @brief
+ * @brief Parses the received bytes in place in the uart ring.
  *
  * @return void	Nothing
  */
 void ZEDF9P::getByte(void)
 {
 	uint16_t size = 0;
-	uint8_t buffer[2048] = {0};
+	Peripherals::Uart::receive_span_type buffer;
 
-	size = uart->getDataFromBuffer(buffer);
+	size = uart->peek(buffer);
 
 	if (size > 0)
 	{
 		getData(buffer,size);
+		uart->consume(size);
 	}
 }
 
@@ -127,7 +128,7 @@ void ZEDF9P::getByte(void)
  * @param[in]	size  :	Incoming packet byte size.
  * @return void	Nothing
  */
-void ZEDF9P::getData(uint8_t buffer[],uint16_t size)
+void ZEDF9P::getData(const Peripherals::Uart::receive_span_type &buffer,uint16_t size)
 {
 	static zedf9p_parse_status_type parse_status = zedf9p_parse_status_type::PREAMBLE1;
 	static uint16_t read_incoming_index = 0;
@@ -250,7 +251,7 @@ void ZEDF9P::getData(uint8_t buffer[],uint16_t size)
 
 					if (parse_message_type == zedf9_parse_message_type::UBX_NAV_HPPOSLLH)
 					{
-						std::memcpy(&high_preision_geodic_pos.buffer[0],&buffer[read_incoming_index],UBX_NAV_HPPOSLLH_LENGTH);
+						buffer.copy(&high_preision_geodic_pos.buffer[0],read_incoming_index,UBX_NAV_HPPOSLLH_LENGTH);
 						//read_incoming_index = read_incoming_index + UBX_NAV_HPPOSLLH_LENGTH;
 						read_incoming_index = read_incoming_index + payload_length;
 
@@ -262,7 +263,7 @@ void ZEDF9P::getData(uint8_t buffer[],uint16_t size)
 					}
 					else if (parse_message_type == zedf9_parse_message_type::UBX_NAV_PVT)
 					{
-						std::memcpy(&navigation_position_velocity_time.buffer[0],&buffer[read_incoming_index],UBX_NAV_PVT_LENGTH);
+						buffer.copy(&navigation_position_velocity_time.buffer[0],read_incoming_index,UBX_NAV_PVT_LENGTH);
 						read_incoming_index = read_incoming_index + payload_length;//UBX_NAV_PVT_LENGTH;
 
 						parse_status = zedf9p_parse_status_type::PREAMBLE1;
@@ -274,7 +275,7 @@ void ZEDF9P::getData(uint8_t buffer[],uint16_t size)
 					}
 					else if (parse_message_type == zedf9_parse_message_type::UBX_NAV_RELPOSNED)
 					{
-						std::memcpy(&relative_pos_information.buffer[0],&buffer[read_incoming_index],UBX_NAV_RELPOSNED_LENGTH);
+						buffer.copy(&relative_pos_information.buffer[0],read_incoming_index,UBX_NAV_RELPOSNED_LENGTH);
 						read_incoming_index = read_incoming_index + payload_length;
 						parse_status = zedf9p_parse_status_type::PREAMBLE1;
 						size = 0;
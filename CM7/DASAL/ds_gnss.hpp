@@ -204,8 +204,8 @@ class ZEDF9P
 
 	private:
 
-		void getData(uint8_t buffer[],uint16_t size);
-		uint16_t calculateCRC(uint8_t data[],uint16_t length);
+		void getData(const Peripherals::Uart::receive_span_type &buffer,uint16_t size);
+		uint16_t calculateCRC(const Peripherals::Uart::receive_span_type &data,uint16_t length);
 
 		uint16_t calculated_crc 			= 0;	///< The variable where the crc value of the related package is kept.
 		uint16_t incoming_crc 				= 0;	///< CRC information from the sensor.
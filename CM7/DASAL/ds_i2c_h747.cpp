@@ -26,6 +26,7 @@
  */
 // Begin of Includes
 #include "ds_i2c_h747.hpp"
+#include "ds_debug_tools.hpp"
 
 // End of Includes
 
@@ -56,6 +57,10 @@ extern "C"
 static HAL_StatusTypeDef DS_I2C1__InterruptCallback(I2C_HandleTypeDef *hi2c_ptr,
 		uint32_t it_flags, uint32_t it_sources)
 {
+	UNUSED(hi2c_ptr);
+	UNUSED(it_flags);
+	UNUSED(it_sources);
+
 	return HAL_OK;
 }
 /**
@@ -70,6 +75,10 @@ static HAL_StatusTypeDef DS_I2C1__InterruptCallback(I2C_HandleTypeDef *hi2c_ptr,
 static HAL_StatusTypeDef DS_I2C2__InterruptCallback(I2C_HandleTypeDef *hi2c_ptr,
 		uint32_t it_flags, uint32_t it_sources)
 {
+	UNUSED(hi2c_ptr);
+	UNUSED(it_flags);
+	UNUSED(it_sources);
+
 	return HAL_OK;
 }
 /**
@@ -84,6 +93,10 @@ static HAL_StatusTypeDef DS_I2C2__InterruptCallback(I2C_HandleTypeDef *hi2c_ptr,
 static HAL_StatusTypeDef DS_I2C3__InterruptCallback(I2C_HandleTypeDef *hi2c_ptr,
 		uint32_t it_flags, uint32_t it_sources)
 {
+	UNUSED(hi2c_ptr);
+	UNUSED(it_flags);
+	UNUSED(it_sources);
+
 	return HAL_OK;
 
 }
@@ -101,6 +114,13 @@ static HAL_StatusTypeDef DS_I2C4__InterruptCallback(I2C_HandleTypeDef *hi2c_ptr,
 {
 
 	uint32_t tmpit_flags = it_flags;
+
+	/* Register read batches are chained by the job queue */
+	if (i2c4.isBatchActive() == true)
+	{
+		i2c4.batchInterruptHandler(it_flags, it_sources);
+		return HAL_OK;
+	}
 	/* I2C events treatment -------------------------------------*/
 
 	if ((I2C_CHECK_FLAG(tmpit_flags, I2C_FLAG_AF) != RESET)
@@ -256,6 +276,23 @@ static HAL_StatusTypeDef DS_I2C4__InterruptCallback(I2C_HandleTypeDef *hi2c_ptr,
 
 }
 
+/**
+ * @brief 		Bus error, arbitration loss and overrun of a register read batch. It is called
+ * 				from the I2C error IRQ handlers before HAL_I2C_ER_IRQHandler. The batch clears
+ * 				the flags, so HAL_I2C_ER_IRQHandler finds nothing to do.
+ *
+ * @param[in]  I2C_HandleTypeDef *hi2c : i2C Instance
+ *
+ * @return 		void
+ */
+void DS_I2C_ErrorInterruptHandler(I2C_HandleTypeDef *hi2c)
+{
+	if ((hi2c == &hi2c4) && (i2c4.isBatchActive() == true))
+	{
+		i2c4.batchInterruptHandler(READ_REG(hi2c->Instance->ISR), READ_REG(hi2c->Instance->CR1));
+	}
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -339,21 +376,29 @@ void H747_I2C::initialize()
 	case Peripherals::I2c::i2c_module_type::H747_I2C1:
 
 		i2c_handle_ptr->XferISR = DS_I2C1__InterruptCallback;
+		event_irq_number		= I2C1_EV_IRQn;
+		error_irq_number		= I2C1_ER_IRQn;
 
 		break;
 	case Peripherals::I2c::i2c_module_type::H747_I2C2:
 
 		i2c_handle_ptr->XferISR = DS_I2C2__InterruptCallback;
+		event_irq_number		= I2C2_EV_IRQn;
+		error_irq_number		= I2C2_ER_IRQn;
 
 		break;
 	case Peripherals::I2c::i2c_module_type::H747_I2C3:
 
 		i2c_handle_ptr->XferISR = DS_I2C3__InterruptCallback;
+		event_irq_number		= I2C3_EV_IRQn;
+		error_irq_number		= I2C3_ER_IRQn;
 
 		break;
 	case Peripherals::I2c::i2c_module_type::H747_I2C4:
 
 		i2c_handle_ptr->XferISR = DS_I2C4__InterruptCallback;
+		event_irq_number		= I2C4_EV_IRQn;
+		error_irq_number		= I2C4_ER_IRQn;
 
 		break;
 	default:
@@ -396,7 +441,7 @@ void H747_I2C::reset()
  */
 void H747_I2C::sendSinlgeByte(const uint8_t data)
 {
-	transmit_buffer[(transmit_head++) & I2C_BUFFER_SIZE_MASK] = data;
+	transmit_ring.push(data);
 
 }
 
@@ -415,11 +460,7 @@ void H747_I2C::sendSinlgeByte(const uint8_t data)
  */
 void H747_I2C::sendMultiByte(const uint8_t buffer[], const uint16_t size)
 {
-	uint16_t k = 0U;
-	for (k = 0; k < size; k++)
-	{
-		transmit_buffer[(transmit_head++) & I2C_BUFFER_SIZE_MASK] = buffer[k];
-	}
+	transmit_ring.pushBulk(buffer, size);
 
 }
 
@@ -432,10 +473,11 @@ bool H747_I2C::transmitFromBuffer(void) //TODO: Fix it later
 {
 
 	bool transmit_in_progress = false;
+	uint8_t data = 0;
 
-	if ((transmit_tail & I2C_BUFFER_SIZE_MASK)!= (transmit_head & I2C_BUFFER_SIZE_MASK))
+	if (transmit_ring.pop(data) == true)
 	{
-		i2c_handle_ptr->Instance->TXDR = transmit_buffer[(transmit_tail++) & I2C_BUFFER_SIZE_MASK];
+		i2c_handle_ptr->Instance->TXDR = data;
 		transmit_in_progress = true;
 
 	}
@@ -457,11 +499,7 @@ bool H747_I2C::transmitFromBuffer(void) //TODO: Fix it later
  */
 void H747_I2C::receiveByteToBuffer(const uint8_t buffer)
 {
-	receive_buffer[ (receive_head++) & I2C_BUFFER_SIZE_MASK ] = buffer;
-	if(receive_head == receive_tail)
-	{
-		receive_buffer_overrun = true;
-	}
+	receive_ring.push(buffer);
 
 }
 
@@ -479,14 +517,7 @@ void H747_I2C::receiveByteToBuffer(const uint8_t buffer)
  */
 uint16_t H747_I2C::getDataFromBuffer(uint8_t buffer[])
 {
-	uint16_t size = 0;
-
-	while ((receive_tail & I2C_BUFFER_SIZE_MASK)!= (receive_head & I2C_BUFFER_SIZE_MASK))
-	{
-		buffer[size++] = receive_buffer[(receive_tail++) & I2C_BUFFER_SIZE_MASK];
-	}
-
-	return size;
+	return static_cast<uint16_t>(receive_ring.popBulk(buffer, I2C_BUFFER_SIZE));
 }
 
 /**
@@ -596,10 +627,10 @@ bool H747_I2C::transmit(const uint16_t dev_address, const uint16_t mem_address,c
 	if (i2c_state != i2c_state_type::I2C_STATE_READY)
 	{
 		++i2c_write_error;
-		if (i2c_write_error > 50U) // Do not get stuck in!
+		if (i2c_write_error > I2C_ERROR_RESET_LIMIT) // Do not get stuck in!
 		{
 			i2c_write_error = 0;
-			reset();
+			reset_pending 	= true;	// service() resets the peripheral between the batches
 		}
 		return false;
 	}
@@ -803,11 +834,10 @@ bool H747_I2C::readRegister(const uint16_t devAddress,
 	{
 		i2c_read_error++;
 
-		if (i2c_read_error > 50U) // Do not get stuck in!
+		if (i2c_read_error > I2C_ERROR_RESET_LIMIT) // Do not get stuck in!
 		{
 			i2c_read_error 	= 0;
-			reset();
-			i2c_state 			= i2c_state_type::I2C_STATE_READY;
+			reset_pending 	= true;	// service() resets the peripheral between the batches
 		}
 		return false;
 	}
@@ -850,6 +880,251 @@ bool H747_I2C::readRegister(const uint16_t devAddress,
 
 }
 
+/**
+ * @brief The function that queues a batch of register reads. The reads are chained by the
+ * 		  event interrupt, the destinations are filled in place and the callback reports the
+ * 		  whole batch once. Batches are submitted from one context only, the main loop or the callbacks.
+ *
+ * @param   batch[in]    :   Reads, budget and completion callback
+ *
+ * @return	bool			  :  success: queued
+ * 								 fail 	: empty or invalid read, or full queue
+ *
+ * Example:
+ * @code
+ * static const i2c_register_read_type reads[] = { { 0x3C, 0x03, 6, field }, { 0x3C, 0x09, 1, &status } };
+ * i2c4.submitBatch({ reads, 2, 500, compassReady, nullptr });
+ * @endcode
+ */
+bool H747_I2C::submitBatch(const i2c_batch_type &batch)
+{
+	bool valid = (batch.reads != nullptr) && (batch.read_number != 0);
+
+	for (uint8_t k = 0; (valid == true) && (k < batch.read_number); k++)
+	{
+		valid = (batch.reads[k].size != 0) && (batch.reads[k].destination != nullptr);
+	}
+
+	if ((valid == false) || (batch_queue.push(batch) == false))
+	{
+		batch_reject_counter++;
+		return false;
+	}
+
+	startNextBatch();
+
+	return true;
+}
+
+/**
+ * @brief The function that keeps the job queue alive without blocking: it aborts a batch which
+ * 		  exceeds I2C_BATCH_TIMEOUT_US, resets the peripheral after I2C_ERROR_RESET_LIMIT errors in
+ * 		  a row or on request of the blocking calls, and restarts the queue after the reset.
+ * 		  The abort masks the interrupts of the port, so the batch queue keeps a single consumer.
+ *
+ * @return	void
+ */
+void H747_I2C::service(void)
+{
+	if ((batch_active == true) && (monitor.getElapsedTime_us(Tools::time_measure_channel_map_type::I2C_BATCH) > I2C_BATCH_TIMEOUT_US))
+	{
+		HAL_NVIC_DisableIRQ(event_irq_number);
+		HAL_NVIC_DisableIRQ(error_irq_number);
+
+		/* The interrupt may have finished the batch after the check */
+		if (batch_active == true)
+		{
+			CLEAR_BIT(i2c_handle_ptr->Instance->CR1,(I2C_CR1_ERRIE | I2C_CR1_TCIE | I2C_CR1_STOPIE | I2C_CR1_NACKIE | I2C_CR1_TXIE | I2C_CR1_RXIE));
+			i2c_handle_ptr->Instance->CR2 |= I2C_CR2_STOP;
+			i2c_timeout_error++;
+			reset_pending = true;
+			finishBatch(false);
+		}
+
+		HAL_NVIC_EnableIRQ(event_irq_number);
+		HAL_NVIC_EnableIRQ(error_irq_number);
+	}
+
+	if ((batch_active == false) && ((reset_pending == true) || (consecutive_error_counter >= I2C_ERROR_RESET_LIMIT)))
+	{
+		reset();
+		reset_pending 				= false;
+		consecutive_error_counter 	= 0;
+	}
+
+	startNextBatch();
+}
+
+/**
+ * @brief The function that runs the active batch, called by the event and error interrupts of
+ * 		  the port. Every read is a register address write in software end mode and, on TC, a
+ * 		  repeated start read in automatic end mode. The STOP of the read starts the next read.
+ * 		  A bus error, an arbitration loss or an overrun fails the batch at once.
+ *
+ * @param   it_flags[in]    :   Interrupt flags bit status(ISR register)
+ * @param   it_sources[in]  :   Flags of Source register (CR1 register)
+ *
+ * @return	void
+ */
+void H747_I2C::batchInterruptHandler(uint32_t it_flags, uint32_t it_sources)
+{
+	const i2c_register_read_type &read = active_batch.reads[read_index];
+
+	if (((it_flags & (I2C_FLAG_BERR | I2C_FLAG_ARLO | I2C_FLAG_OVR)) != 0U) && (I2C_CHECK_IT_SOURCE(it_sources, I2C_IT_ERRI) != RESET))
+	{
+		/* The master may have lost the bus and no STOP follows, service() resets the peripheral before the next batch */
+		__HAL_I2C_CLEAR_FLAG(i2c_handle_ptr, I2C_FLAG_BERR | I2C_FLAG_ARLO | I2C_FLAG_OVR);
+		reset_pending = true;
+		finishBatch(false);
+		return;
+	}
+
+	if ((I2C_CHECK_FLAG(it_flags, I2C_FLAG_AF) != RESET) && (I2C_CHECK_IT_SOURCE(it_sources, I2C_IT_NACKI) != RESET))
+	{
+		/* The device did not answer, the master sends the STOP by itself */
+		__HAL_I2C_CLEAR_FLAG(i2c_handle_ptr, I2C_FLAG_AF);
+		batch_failed = true;
+	}
+
+	if ((I2C_CHECK_FLAG(it_flags, I2C_FLAG_RXNE) != RESET) && (I2C_CHECK_IT_SOURCE(it_sources, I2C_IT_RXI) != RESET))
+	{
+		uint8_t received_data = (uint8_t) i2c_handle_ptr->Instance->RXDR;
+
+		if (receive_index < read.size)
+		{
+			read.destination[receive_index++] = received_data;
+		}
+	}
+
+	if ((I2C_CHECK_FLAG(it_flags, I2C_FLAG_TXIS) != RESET) && (I2C_CHECK_IT_SOURCE(it_sources, I2C_IT_TXI) != RESET))
+	{
+		i2c_handle_ptr->Instance->TXDR = I2C_MEM_ADD_LSB(read.register_address);
+	}
+
+	if ((I2C_CHECK_FLAG(it_flags, I2C_FLAG_TC) != RESET) && (I2C_CHECK_IT_SOURCE(it_sources, I2C_IT_TCI) != RESET))
+	{
+		if (batch_failed == true)
+		{
+			i2c_handle_ptr->Instance->CR2 |= I2C_CR2_STOP;
+		}
+		else
+		{
+			/* Repeated start for the read action*/
+			configTransfer(read.device_address, read.size, I2C_AUTOEND_MODE, I2C_GENERATE_START_READ);
+		}
+	}
+
+	if ((I2C_CHECK_FLAG(it_flags, I2C_FLAG_STOPF) != RESET) && (I2C_CHECK_IT_SOURCE(it_sources, I2C_IT_STOPI) != RESET))
+	{
+		__HAL_I2C_CLEAR_FLAG(i2c_handle_ptr, I2C_FLAG_STOPF);
+		I2C_RESET_CR2(i2c_handle_ptr);
+
+		if ((batch_failed == true) || (receive_index != read.size))
+		{
+			finishBatch(false);
+		}
+		else if (++read_index < active_batch.read_number)
+		{
+			startBatchRead();
+		}
+		else
+		{
+			finishBatch(true);
+		}
+	}
+}
+
+/**
+ * @brief The function that tells whether a batch owns the bus
+ *
+ * @return	bool
+ */
+bool H747_I2C::isBatchActive(void) const
+{
+	return batch_active;
+}
+
+/**
+ * @brief The private function that starts the oldest queued batch. It waits while a batch or a
+ * 		  blocking call owns the bus and while a reset is due, service() calls it again.
+ *
+ * @return	void
+ */
+void H747_I2C::startNextBatch(void)
+{
+	Tools::ring_span_type<i2c_batch_type> span;
+
+	if ((batch_active == true) || (i2c_state != i2c_state_type::I2C_STATE_READY) || (reset_pending == true) ||
+		(consecutive_error_counter >= I2C_ERROR_RESET_LIMIT) || (batch_queue.peek(span) == 0U))
+	{
+		return;
+	}
+
+	active_batch 	= span[0];
+	read_index 		= 0;
+	batch_failed 	= false;
+	batch_active 	= true;
+	i2c_state 		= i2c_state_type::I2C_STATE_BUSY;
+
+	monitor.startElapsedTimeMeasure(Tools::time_measure_channel_map_type::I2C_BATCH);
+	startBatchRead();
+
+	/*  Error, Transfer Completed, Stop, Acknowledge, Tx and Rx interrupt enabled*/
+	SET_BIT(i2c_handle_ptr->Instance->CR1,(I2C_CR1_ERRIE | I2C_CR1_TCIE | I2C_CR1_STOPIE | I2C_CR1_NACKIE | I2C_CR1_TXIE | I2C_CR1_RXIE));
+}
+
+/**
+ * @brief The private function that sends the register address of the current read, the TXIS
+ * 		  interrupt writes it and the TC interrupt turns the bus around
+ *
+ * @return	void
+ */
+void H747_I2C::startBatchRead(void)
+{
+	receive_index = 0;
+	configTransfer(active_batch.reads[read_index].device_address, I2C_MEMADD_SIZE_8BIT, I2C_SOFTEND_MODE, I2C_GENERATE_START_WRITE);
+}
+
+/**
+ * @brief The private function that closes the active batch, records its time and reports it
+ *
+ * @param   success[in]    :   false if a read failed or the batch timed out
+ *
+ * @return	void
+ */
+void H747_I2C::finishBatch(const bool success)
+{
+	CLEAR_BIT(i2c_handle_ptr->Instance->CR1,(I2C_CR1_ERRIE | I2C_CR1_TCIE | I2C_CR1_STOPIE | I2C_CR1_NACKIE | I2C_CR1_TXIE | I2C_CR1_RXIE));
+
+	batch_time_us = monitor.getElapsedTime_us(Tools::time_measure_channel_map_type::I2C_BATCH);
+	if ((active_batch.budget_us != 0) && (batch_time_us > active_batch.budget_us))
+	{
+		batch_overrun_counter++;
+	}
+
+	batch_counter++;
+	if (success == true)
+	{
+		consecutive_error_counter = 0;
+	}
+	else
+	{
+		batch_error_counter++;
+		consecutive_error_counter++;
+	}
+
+	batch_queue.consume(1);
+	i2c_state 	 = i2c_state_type::I2C_STATE_READY;
+	batch_active = false;
+
+	if (active_batch.complete != nullptr)
+	{
+		active_batch.complete(active_batch.context, success);
+	}
+
+	startNextBatch();
+}
+
 
 } //End of namespace i2c
 
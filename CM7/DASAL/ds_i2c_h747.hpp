@@ -41,6 +41,7 @@
 #include <stdint.h>
 #include <i2c.h>
 #include <ds_i2c.hpp>
+#include "ds_ring_buffer.hpp"
 
 
 
@@ -55,7 +56,9 @@ namespace I2c  // if i2c library must be changed , it prevents us to change the
 /*
  * Begin of Macro and Literals Definitions
  */
-
+const uint8_t  I2C_BATCH_QUEUE_SIZE		= 4;		///< Must be a power of two
+const uint16_t I2C_ERROR_RESET_LIMIT	= 50;		///< Errors in a row before the peripheral is reset
+const uint32_t I2C_BATCH_TIMEOUT_US		= 5000;		///< A batch which runs longer is aborted by service()
  //End of Macro and Literals Definitions
 
 
@@ -81,6 +84,29 @@ enum class i2c_state_type : uint8_t
 	I2C_STATE_ERROR 	    = 0x05, /*!<I2C  error state                                     */
 	I2C_STATE_ABORT 	    = 0x06 /*!< I2C abort is ongoing                                 */
 
+};
+
+/**
+ * @brief One register read of a batch: register address write, repeated start, size bytes read
+ */
+struct i2c_register_read_type
+{
+	uint16_t	 device_address;		///< 7 bit address shifted left, as for readRegister
+	uint8_t		 register_address;
+	uint8_t		 size;					///< 1..255 bytes
+	uint8_t		*destination;
+};
+
+/**
+ * @brief Register reads which are chained by the interrupt and reported once
+ */
+struct i2c_batch_type
+{
+	const i2c_register_read_type *reads;	///< Must stay valid until the callback
+	uint8_t		 read_number;
+	uint32_t	 budget_us;					///< Expected duration, longer batches are counted as overruns, 0 disables it
+	void		(*complete)(void *context, bool success);	///< Called from the I2C interrupt or from service(), may be nullptr
+	void		*context;
 };
  // End of Enum, Union and Struct Definitions
 
@@ -111,6 +137,13 @@ public:
 	bool readRegister (const uint16_t devAddress,const uint16_t memAddress,const uint8_t memAddSize, uint8_t *p_Data,uint16_t data_Size);
 	/* setHighSpeed: change the i2c speed*/
 	bool setHighSpeed	(const bool active);
+	/* submitBatch: queue register reads, the call does not wait for the bus */
+	bool submitBatch	(const i2c_batch_type &batch);
+	/* service: batch timeout and deferred reset, called by a scheduler task */
+	void service		(void);
+	/* batchInterruptHandler: runs the active batch, called by the event and error interrupts */
+	void batchInterruptHandler(uint32_t it_flags, uint32_t it_sources);
+	bool isBatchActive	(void) const;
 	H747_I2C(const H747_I2C &orig);
 	virtual ~H747_I2C(); // Indeed if the derived class is chosen as polymorphic class, it is useful
 
@@ -121,6 +154,11 @@ public:
 	uint8_t 				  	i2c_timeout_error;
 	bool 				    		i2c_transfer_completed;
 	bool 				    		i2c_receive_completed;
+	uint32_t						batch_counter			= 0;
+	uint32_t						batch_error_counter		= 0;	///< NACK, bus error, arbitration loss, short read or timeout
+	uint32_t						batch_overrun_counter	= 0;	///< Batches longer than their budget_us
+	uint32_t						batch_reject_counter	= 0;	///< Invalid batches or full queue
+	uint32_t						batch_time_us			= 0;	///< Duration of the last batch, the maximum is kept by PERF_MONITOR
 
 private:
 
@@ -146,22 +184,33 @@ private:
 	/* getDataFromBuffer: get value from receive buffer*/
 	uint16_t getDataFromBuffer(uint8_t buffer[]) override;
 
-	static constexpr uint16_t I2C_BUFFER_SIZE 			= 256; // Configure later according to sensor data rate values
-	static constexpr uint16_t I2C_BUFFER_SIZE_MASK 	= I2C_BUFFER_SIZE - 1;
+	static constexpr uint16_t I2C_BUFFER_SIZE 			= 256; // Configure later according to sensor data rate values, must be a power of two
 
 
 	i2c_module_type 			i2c_number;
 	uint16_t 							i2c_device_adress;
 	I2C_HandleTypeDef 		*i2c_handle_ptr;
-
-	uint8_t 				receive_buffer[I2C_BUFFER_SIZE] = { 0 };
-	uint16_t 				receive_head 							= 0;
-	uint16_t 				receive_tail 							= 0;
-	bool 					receive_buffer_overrun 			= false;
-
-	uint8_t 				transmit_buffer[I2C_BUFFER_SIZE] = { 0 };
-	uint16_t 				transmit_head 				 	 = 0;
-	uint16_t 				transmit_tail 				 	 = 0;
+	IRQn_Type				event_irq_number			= I2C4_EV_IRQn;	///< Masked by service() while it aborts a batch
+	IRQn_Type				error_irq_number			= I2C4_ER_IRQn;
+
+	Tools::RING_BUFFER<uint8_t, I2C_BUFFER_SIZE> receive_ring;
+	Tools::RING_BUFFER<uint8_t, I2C_BUFFER_SIZE> transmit_ring;
+
+	/* startNextBatch: start the oldest queued batch if the bus is free*/
+	void startNextBatch(void);
+	/* startBatchRead: send the register address of the current read*/
+	void startBatchRead(void);
+	/* finishBatch: report the active batch and start the next one*/
+	void finishBatch(const bool success);
+
+	Tools::RING_BUFFER<i2c_batch_type, I2C_BATCH_QUEUE_SIZE> batch_queue;
+	i2c_batch_type			active_batch				= {};	///< Copy of the queue head while it is on the bus
+	volatile bool			batch_active				= false;
+	bool					batch_failed				= false;
+	uint8_t					read_index					= 0;
+	uint8_t					receive_index				= 0;
+	uint16_t				consecutive_error_counter	= 0;
+	volatile bool			reset_pending				= false;	///< Requested by the blocking calls, done by service() between batches
 };
 
 
@@ -269,6 +269,33 @@ lw20_status_t LIGHTWARE_LW20::setStream(parameter_t *parameter, uint8_t stream_n
 *			LW20_ERROR 	 	-> ERROR
 */
 lw20_status_t LIGHTWARE_LW20::checkProductName()
+{
+	lw20_status_t status		= lw20_status_t::LW20_ERROR;
+	uint16_t coming_data_size	= 0;
+	Peripherals::Uart::receive_span_type cbuffer;
+
+	coming_data_size = init_def.uart_source->peek(cbuffer);
+	if(coming_data_size > Peripherals::Uart::UART_BUFFER_TRANSFER_LIMIT)
+	{
+		coming_data_size = Peripherals::Uart::UART_BUFFER_TRANSFER_LIMIT;
+	}
+
+	status = parseProductName(cbuffer, coming_data_size);
+	init_def.uart_source->consume(coming_data_size);	///< After the parse, the producer may overwrite the consumed bytes. Unparsed bytes are dropped as before
+
+	return status;
+}
+
+/**
+* @brief	Parses the product name response in the received bytes
+*
+* @param 	cbuffer 			-> Received bytes, still in the receive ring
+* 				coming_data_size 	-> Number of bytes to parse
+*
+* @return	LW20_OK 	-> Product name is correct
+*			LW20_ERROR 	 	-> ERROR
+*/
+lw20_status_t LIGHTWARE_LW20::parseProductName(const Peripherals::Uart::receive_span_type &cbuffer, uint16_t coming_data_size)
 {
 	static look_product_name_state_t look_state	= look_product_name_state_t::PARAMETER;
 	static uint8_t product_name_character_size	= sizeof(product_name);
@@ -276,10 +303,6 @@ lw20_status_t LIGHTWARE_LW20::checkProductName()
 	static uint8_t parameter_character_count 		= 0;
 
 	static uint16_t cbuffer_index 		= 0;
-	static uint16_t coming_data_size 	= 0;
-	static uint8_t cbuffer[2048] 			= {0};
-
-	coming_data_size = init_def.uart_source->getDataFromBuffer(cbuffer);
 
 	for (cbuffer_index = 0; cbuffer_index < coming_data_size; cbuffer_index++)
 	{
@@ -555,16 +578,37 @@ void LIGHTWARE_LW20::scheduler()
 */
 lw20_status_t LIGHTWARE_LW20::response(parameter_t &parameter, float &response_data)
 {
-	static uint16_t coming_data_size = 0;
+	lw20_status_t status		= lw20_status_t::LW20_ERROR;
+	uint16_t coming_data_size	= 0;
+	Peripherals::Uart::receive_span_type cbuffer;
+
+	coming_data_size = init_def.uart_source->peek(cbuffer);
+	status			 = parseResponse(cbuffer, coming_data_size, parameter, response_data);
+	init_def.uart_source->consume(coming_data_size);
+
+	return status;
+}
+
+/**
+* @brief	Parses a parameter response in the received bytes
+*
+* @param	cbuffer 			-> Received bytes, still in the receive ring
+* 				coming_data_size 	-> Number of bytes to parse
+* 				parameter 			-> Responsed parameter address
+* 				response_data 		-> Parameter value address that coming from lightware lw20 lidar.
+*
+* @return	LW20_OK 			-> OK
+*					LW20_ERROR 	 	-> ERROR
+*/
+lw20_status_t LIGHTWARE_LW20::parseResponse(const Peripherals::Uart::receive_span_type &cbuffer, uint16_t coming_data_size, parameter_t &parameter, float &response_data)
+{
 	static uint8_t parameter_character_count = 0;
 	static uint8_t number_value_count = 0;
 	static char number_value_buf[10] = {0};
 
 	static uint16_t cbuffer_index = 0;
-	static uint8_t cbuffer[2048] = {0};
 	static lw20_response_state_t response_state = lw20_response_state_t::PARAMETER_CASE;
 
-	coming_data_size = init_def.uart_source->getDataFromBuffer(cbuffer,2048);
 	for (cbuffer_index = 0; cbuffer_index < coming_data_size; cbuffer_index++)
 	{
 		switch (response_state)
@@ -668,13 +712,9 @@ lw20_status_t LIGHTWARE_LW20::response(parameter_t &parameter, float &response_d
 */
 lw20_status_t LIGHTWARE_LW20::readDistanceStream()
 {
-	static distance_stream_state_t read_distance_stream_state = distance_stream_state_t::STREAM_SIGN;
-	static uint8_t parameter_character_count 		= 0;
-	static uint8_t number_value_count 					= 0;
-	static uint8_t cbuffer[2048]								= {0};
-	static char number_value_buf[10] 						= {0};
-	static uint16_t coming_data_size 						= 0;
-	static uint16_t cbuffer_index 							= 0;
+	lw20_status_t status		= lw20_status_t::LW20_ERROR;
+	uint16_t coming_data_size	= 0;
+	Peripherals::Uart::receive_span_type cbuffer;
 	static float communication_timeout_delay 		= 0;
 
 	float dt_s = 0;
@@ -684,124 +724,148 @@ lw20_status_t LIGHTWARE_LW20::readDistanceStream()
 
 	new_stream_detected = false;
 
-	coming_data_size = init_def.uart_source->getDataFromBuffer(cbuffer,2048);
+	coming_data_size = init_def.uart_source->peek(cbuffer);
 
 	if(coming_data_size > 0)
 	{
 		communication_timeout_delay = 0;
 
-		for (cbuffer_index = 0; cbuffer_index < coming_data_size; cbuffer_index++)
+		status = parseDistanceStream(cbuffer, coming_data_size);
+		init_def.uart_source->consume(coming_data_size);
+
+		return status;
+	}
+	else
+	{
+		communication_timeout_delay += dt_s;
+		if(communication_timeout_delay >= max_communication_timeout_delay)
 		{
-			switch (read_distance_stream_state)
-			{
+			communication_timeout_delay = max_communication_timeout_delay;
+			return lw20_status_t::LW20_TIMEOUT;
+		}
+	}
+	return lw20_status_t::LW20_ERROR;
+}
 
-				case distance_stream_state_t::STREAM_SIGN:
-					if(cbuffer[cbuffer_index] == (uint8_t)'$')
-					{
-						number_value_count 					= 0;
-						parameter_character_count 	= 0;
-						read_distance_stream_state	= distance_stream_state_t::PARAMETER_CASE;
-					}
-					break;
+/**
+* @brief 	Parses the distance stream in the received bytes
+*
+* @param	cbuffer 			-> Received bytes, still in the receive ring
+* 				coming_data_size 	-> Number of bytes to parse
+*
+* @return	LW20_OK 			-> OK
+*					LW20_ERROR 	 	-> ERROR
+*/
+lw20_status_t LIGHTWARE_LW20::parseDistanceStream(const Peripherals::Uart::receive_span_type &cbuffer, uint16_t coming_data_size)
+{
+	static distance_stream_state_t read_distance_stream_state = distance_stream_state_t::STREAM_SIGN;
+	static uint8_t parameter_character_count 		= 0;
+	static uint8_t number_value_count 					= 0;
+	static char number_value_buf[10] 						= {0};
+	static uint16_t cbuffer_index 							= 0;
 
-				case distance_stream_state_t::PARAMETER_CASE:
-					if(cbuffer[cbuffer_index] == (uint8_t)(parameter_table.median_distance_first_return.param_case[parameter_character_count])+lower_case_offset || (uint8_t)(parameter_table.median_distance_first_return.param_case[parameter_character_count]))
-					{
-						parameter_character_count++;
-						if(parameter_character_count > max_parameter_character_size)
-						{
-							read_distance_stream_state 	= distance_stream_state_t::STREAM_SIGN;
-							parameter_character_count 	= 0;
-							number_value_count 					= 0;
-							return lw20_status_t::LW20_ERROR;
-						}
-					}
-					else
+	for (cbuffer_index = 0; cbuffer_index < coming_data_size; cbuffer_index++)
+	{
+		switch (read_distance_stream_state)
+		{
+
+			case distance_stream_state_t::STREAM_SIGN:
+				if(cbuffer[cbuffer_index] == (uint8_t)'$')
+				{
+					number_value_count 					= 0;
+					parameter_character_count 	= 0;
+					read_distance_stream_state	= distance_stream_state_t::PARAMETER_CASE;
+				}
+				break;
+
+			case distance_stream_state_t::PARAMETER_CASE:
+				if(cbuffer[cbuffer_index] == (uint8_t)(parameter_table.median_distance_first_return.param_case[parameter_character_count])+lower_case_offset || (uint8_t)(parameter_table.median_distance_first_return.param_case[parameter_character_count]))
+				{
+					parameter_character_count++;
+					if(parameter_character_count > max_parameter_character_size)
 					{
 						read_distance_stream_state 	= distance_stream_state_t::STREAM_SIGN;
 						parameter_character_count 	= 0;
+						number_value_count 					= 0;
 						return lw20_status_t::LW20_ERROR;
 					}
-					if(parameter_character_count == parameter_table.median_distance_first_return.param_size)
-					{
-						read_distance_stream_state = distance_stream_state_t::COLON;
-					}
-					break;
-
-				case distance_stream_state_t::COLON:
-					if(cbuffer[cbuffer_index] == (uint8_t)':')
-					{
-						read_distance_stream_state = distance_stream_state_t::VALUE;
-					}
-					else
-					{
-						read_distance_stream_state = distance_stream_state_t::STREAM_SIGN;
-						parameter_character_count = 0;
-						number_value_count = 0;
-						return lw20_status_t::LW20_ERROR;
-					}
-					break;
+				}
+				else
+				{
+					read_distance_stream_state 	= distance_stream_state_t::STREAM_SIGN;
+					parameter_character_count 	= 0;
+					return lw20_status_t::LW20_ERROR;
+				}
+				if(parameter_character_count == parameter_table.median_distance_first_return.param_size)
+				{
+					read_distance_stream_state = distance_stream_state_t::COLON;
+				}
+				break;
 
-				case distance_stream_state_t::VALUE:
-					if(cbuffer[cbuffer_index] == (uint8_t)' ')
-					{
-						read_distance_stream_state = distance_stream_state_t::CARRIAGE_RETURN;
-					}
-					else
-					{
-						number_value_buf[number_value_count++] = (char)cbuffer[cbuffer_index];
-						if(number_value_count > max_float_ascii_size)
-						{
-							read_distance_stream_state = distance_stream_state_t::STREAM_SIGN;
-							parameter_character_count = 0;
-							number_value_count = 0;
-							return lw20_status_t::LW20_ERROR;
-						}
-					}
-					break;
+			case distance_stream_state_t::COLON:
+				if(cbuffer[cbuffer_index] == (uint8_t)':')
+				{
+					read_distance_stream_state = distance_stream_state_t::VALUE;
+				}
+				else
+				{
+					read_distance_stream_state = distance_stream_state_t::STREAM_SIGN;
+					parameter_character_count = 0;
+					number_value_count = 0;
+					return lw20_status_t::LW20_ERROR;
+				}
+				break;
 
-				case distance_stream_state_t::CARRIAGE_RETURN:
-					if(cbuffer[cbuffer_index] == (uint8_t)'\r')
-					{
-						read_distance_stream_state = distance_stream_state_t::LINE_FEED;
-					}
-					else
+			case distance_stream_state_t::VALUE:
+				if(cbuffer[cbuffer_index] == (uint8_t)' ')
+				{
+					read_distance_stream_state = distance_stream_state_t::CARRIAGE_RETURN;
+				}
+				else
+				{
+					number_value_buf[number_value_count++] = (char)cbuffer[cbuffer_index];
+					if(number_value_count > max_float_ascii_size)
 					{
 						read_distance_stream_state = distance_stream_state_t::STREAM_SIGN;
 						parameter_character_count = 0;
 						number_value_count = 0;
 						return lw20_status_t::LW20_ERROR;
 					}
-					break;
+				}
+				break;
 
-				case distance_stream_state_t::LINE_FEED:
-					if(cbuffer[cbuffer_index] == (uint8_t)'\n')
-					{
-						sscanf(number_value_buf, "%f", &distance);
-						read_distance_stream_state = distance_stream_state_t::STREAM_SIGN;
-						parameter_character_count = 0;
-						number_value_count = 0;
-						new_stream_detected = true;
-						return lw20_status_t::LW20_OK;
-					}
-					else
-					{
-						read_distance_stream_state = distance_stream_state_t::STREAM_SIGN;
-						parameter_character_count = 0;
-						number_value_count = 0;
-						return lw20_status_t::LW20_ERROR;
-					}
-					break;
-			}
-		}
-	}
-	else
-	{
-		communication_timeout_delay += dt_s;
-		if(communication_timeout_delay >= max_communication_timeout_delay)
-		{
-			communication_timeout_delay = max_communication_timeout_delay;
-			return lw20_status_t::LW20_TIMEOUT;
+			case distance_stream_state_t::CARRIAGE_RETURN:
+				if(cbuffer[cbuffer_index] == (uint8_t)'\r')
+				{
+					read_distance_stream_state = distance_stream_state_t::LINE_FEED;
+				}
+				else
+				{
+					read_distance_stream_state = distance_stream_state_t::STREAM_SIGN;
+					parameter_character_count = 0;
+					number_value_count = 0;
+					return lw20_status_t::LW20_ERROR;
+				}
+				break;
+
+			case distance_stream_state_t::LINE_FEED:
+				if(cbuffer[cbuffer_index] == (uint8_t)'\n')
+				{
+					sscanf(number_value_buf, "%f", &distance);
+					read_distance_stream_state = distance_stream_state_t::STREAM_SIGN;
+					parameter_character_count = 0;
+					number_value_count = 0;
+					new_stream_detected = true;
+					return lw20_status_t::LW20_OK;
+				}
+				else
+				{
+					read_distance_stream_state = distance_stream_state_t::STREAM_SIGN;
+					parameter_character_count = 0;
+					number_value_count = 0;
+					return lw20_status_t::LW20_ERROR;
+				}
+				break;
 		}
 	}
 	return lw20_status_t::LW20_ERROR;
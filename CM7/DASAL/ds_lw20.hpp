@@ -253,8 +253,14 @@ private:
 
 	lw20_status_t readDistanceStream();
 
+	lw20_status_t parseDistanceStream(const Peripherals::Uart::receive_span_type &cbuffer, uint16_t coming_data_size);
+
 	lw20_status_t response(parameter_t &parameter, float &response_data);
 
+	lw20_status_t parseResponse(const Peripherals::Uart::receive_span_type &cbuffer, uint16_t coming_data_size, parameter_t &parameter, float &response_data);
+
+	lw20_status_t parseProductName(const Peripherals::Uart::receive_span_type &cbuffer, uint16_t coming_data_size);
+
 	void setDistanceStream();
 
 };
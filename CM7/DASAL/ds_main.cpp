@@ -32,14 +32,25 @@
 #include "ds_main.hpp"
 #include "tim.h"
 #include "ds_debug_tools.hpp"
+#include "ds_cache_h747.hpp"
+#include "ds_crc16.hpp"
 #include "ds_uart_h747.hpp"
+#include "ds_spi_h747.hpp"
+#include "ds_i2c_h747.hpp"
 #include "ds_can_h747.hpp"
 #include "ds_led_h747.hpp"
 #include "ds_shared_ram_h747.hpp"
 #include "ds_telemetry_core.hpp"
+#include "ds_telemetry_router.hpp"
+#include "ds_telemetry_scheduler.hpp"
+#include "ds_telemetry_ins.hpp"
+#include "ds_telemetry_mc.hpp"
+#include "ds_telemetry_radar.hpp"
 #include "ds_sbus2.hpp"
 #include "ds_serializer.hpp"
 #include "ds_lw20.hpp"
+#include "ds_tasks.hpp"
+#include "ds_work_queue.hpp"
 // End of Includes
 
 
@@ -61,13 +72,20 @@ SCHEDULER task;
   */
 SCHEDULER::SCHEDULER() :
 task_tick(0),
-task_counter(0)
+task_counter(0),
+task_table{},
+task_number(0),
+tick_budget_us{},
+event_table{},
+event_number(0),
+event_pending{},
+event_deferred{}
 { }
 
 
 
 /**
-  * @brief One time init task for peripherals
+  * @brief One time init task for peripherals, the tasks are registered by the vehicle task set
   *
   * @param[in]  void
   *
@@ -75,6 +93,8 @@ task_counter(0)
   */
 void SCHEDULER::init( void )
 {
+	cache.initialize();		///< Before the first DMA or inter-core transfer
+	crc16.initialize();		///< Hardware CRC16 for every telemetry frame
 	uart8.initialize();
 	sbus.initialize();
 	led.initialize();
@@ -82,268 +102,510 @@ void SCHEDULER::init( void )
 	inter_core.initialize();
 	serializer.initialize();
 	uart2.initialize();
+	uart2.enableDmaReception(DMA1_Stream0, DMA_REQUEST_USART2_RX);
+	uart6.initialize();
+	uart6.enableDmaReception(DMA1_Stream1, DMA_REQUEST_USART6_RX);		///< VN100 at 921600 baud
+	uart3.initialize();
+	uart3.enableDmaTransmission(DMA1_Stream2, DMA_REQUEST_USART3_TX);	///< GCS telemetry
+	uart3_router.registerEndpoint(&gcs_telemetry);
+	uart3_router.registerEndpoint(&ins_telemetry);
+	uart3_router.registerEndpoint(&mc_telemetry);
+	uart3_router.registerEndpoint(&radar_telemetry);
+	gcs_telemetry.registerStreams(&uart3_telemetry_scheduler);
+	/* A peer with a CAN-FD link moves off uart3 with can1_transport.registerEndpoint instead of uart3_router */
+	spi_2.initialize();
+	spi_2.enableDma(DMA1_Stream3, DMA_REQUEST_SPI2_RX, DMA1_Stream4, DMA_REQUEST_SPI2_TX);
+	i2c4.initialize();
+	can1.initialize();
 	lw20.initialize();
+
+	Tasks::registerVehicleTasks(*this);
 }
 
 
 
 /**
-  * @brief 		800Hz loop function
+  * @brief 		Adds a task to the rate monotonic task table. The table is kept sorted by rate
+  *				and priority, and the phases of the auto phase tasks are balanced again.
   *
-  * @param[in]  void
+  * @param[in]  const char *name				: Task name for monitoring
+  * @param[in]  void (*function)( void )		: Task function
+  * @param[in]  uint16_t rate_hz				: Task rate, it must divide SCHEDULER_TICK_HZ
+  * @param[in]  uint16_t budget_us				: Worst case execution time
+  * @param[in]  uint8_t priority				: Order among the tasks of the same rate, 0 runs first
+  * @param[in]  uint16_t phase					: Tick offset in the task period or TASK_PHASE_AUTO
+  *
+  * @return 	bool : false if the table is full or the rate or phase is not valid
+  */
+bool SCHEDULER::addTask( const char *name, void (*function)( void ), uint16_t rate_hz,
+						 uint16_t budget_us, uint8_t priority, uint16_t phase )
+{
+	task_type entry = {};
+	uint8_t	  index = 0;
+
+	if( (task_number >= MAXIMUM_TASK_NUMBER) || (function == nullptr) || (rate_hz == 0) ||
+		(rate_hz > SCHEDULER_TICK_HZ) || ( (SCHEDULER_TICK_HZ % rate_hz) != 0 ) )
+	{
+		return false;
+	}
+
+	entry.name		  = name;
+	entry.function	  = function;
+	entry.rate_hz	  = rate_hz;
+	entry.prescaler	  = SCHEDULER_TICK_HZ / rate_hz;
+	entry.phase_fixed = ( phase != TASK_PHASE_AUTO );
+	entry.phase		  = ( entry.phase_fixed == true ) ? phase : 0;
+	entry.budget_us	  = budget_us;
+	entry.priority	  = priority;
+
+	if(entry.phase >= entry.prescaler)
+	{
+		return false;
+	}
+
+	index = task_number;
+	while( (index > 0) &&
+		   ( (task_table[index - 1].rate_hz < rate_hz) ||
+			 ( (task_table[index - 1].rate_hz == rate_hz) && (task_table[index - 1].priority > priority) ) ) )
+	{
+		task_table[index] = task_table[index - 1];
+		index--;
+	}
+	task_table[index] = entry;
+	task_number++;
+
+	balancePhases();
+
+	return true;
+}
+
+
+
+/**
+  * @brief 		Adds a data ready task. It is not planned on the ticks, it runs once after
+  *				the periodic tasks of the tick in which signalEvent is called for it.
+  *
+  * @param[in]  const char *name				: Task name for monitoring
+  * @param[in]  void (*function)( void )		: Task function
+  * @param[in]  uint16_t budget_us				: Worst case execution time
+  *
+  * @return 	uint8_t : Event id for signalEvent, EVENT_ID_NONE if the table is full
+  */
+uint8_t SCHEDULER::addEventTask( const char *name, void (*function)( void ), uint16_t budget_us )
+{
+	task_type entry = {};
+
+	if( (event_number >= MAXIMUM_EVENT_NUMBER) || (function == nullptr) )
+	{
+		return EVENT_ID_NONE;
+	}
+
+	entry.name		= name;
+	entry.function	= function;
+	entry.budget_us	= budget_us;
+	event_table[event_number] = entry;
+
+	return event_number++;
+}
+
+
+
+/**
+  * @brief 		Marks an event task to run in the current or the next tick. It only writes
+  *				a flag, so it may be called from interrupts.
+  *
+  * @param[in]  uint8_t event_id : Id returned by addEventTask
   *
   * @return 	void
   */
-void SCHEDULER::task800Hz( void )
+void SCHEDULER::signalEvent( uint8_t event_id )
 {
-	inter_core.scheduler();
+	if(event_id < event_number)
+	{
+		event_pending[event_id] = true;
+	}
 }
 
 
 
 /**
-  * @brief 		400Hz loop function
+  * @brief 		Returns the number of registered periodic and event tasks
   *
   * @param[in]  void
   *
-  * @return 	void
+  * @return 	uint8_t
   */
-void SCHEDULER::task400Hz( void )
+uint8_t SCHEDULER::getTaskNumber( void ) const
 {
+	return task_number + event_number;
+}
+
 
+
+/**
+  * @brief 		Returns a task table entry with its phase and run time statistics
+  *
+  * @param[in]  uint8_t index : Periodic tasks in execution order, then the event tasks
+  *
+  * @return 	const task_type* : nullptr if index is out of the tables
+  */
+const task_type* SCHEDULER::getTask( uint8_t index ) const
+{
+	if(index < task_number)
+	{
+		return &task_table[index];
+	}
+
+	return ( index < (task_number + event_number) ) ? &event_table[index - task_number] : nullptr;
 }
 
 
 
 /**
-  * @brief 		200Hz loop function
+  * @brief 		Replaces the function of a task, e.g. with a wrapper which measures or traces it
   *
-  * @param[in]  void
+  * @param[in]  uint8_t index				 : Index of getTask
+  * @param[in]  void (*function)( void )	 : New task function
   *
-  * @return 	void
+  * @return 	bool : false if index is out of the tables or function is nullptr
   */
-void SCHEDULER::task200Hz( void )
+bool SCHEDULER::setTaskFunction( uint8_t index, void (*function)( void ) )
 {
+	if( (index >= (task_number + event_number)) || (function == nullptr) )
+	{
+		return false;
+	}
+
+	if(index < task_number)
+	{
+		task_table[index].function = function;
+	}
+	else
+	{
+		event_table[index - task_number].function = function;
+	}
 
+	return true;
 }
 
 
 
 /**
-  * @brief 		100Hz loop function
+  * @brief 		Returns the highest planned budget among the ticks, it must stay below the tick period
   *
   * @param[in]  void
   *
-  * @return 	void
+  * @return 	uint32_t
   */
-void SCHEDULER::task100Hz( void )
+uint32_t SCHEDULER::getMaximumTickBudget_us( void ) const
 {
-	led.scheduler();
-	sbus.scheduler();
-	serializer.scheduler();
+	uint32_t result = 0;
+	uint16_t tick	= 0;
+
+	for(tick = 0; tick < SCHEDULER_TICK_HZ; tick++)
+	{
+		if(tick_budget_us[tick] > result)
+		{
+			result = tick_budget_us[tick];
+		}
+	}
+
+	return result;
 }
 
 
 
 /**
-  * @brief 		50Hz loop function
+  * @brief 		Cpu main function
   *
   * @param[in]  void
   *
   * @return 	void
   */
-void SCHEDULER::task50Hz( void )
+void SCHEDULER::main( void )
 {
-	lw20.scheduler();
+	init();
+	while(true)
+	{
+		step();
+	}
 }
 
 
 
 /**
-  * @brief 		20Hz loop function
+  * @brief 		Runs one 800Hz frame if the tick is set. Every task whose phase matches
+  *				the frame counter is executed in table order, the interrupt work posted
+  *				to work_queue is drained after every task.
   *
   * @param[in]  void
   *
-  * @return 	void
+  * @return 	bool : true if a frame was executed
   */
-void SCHEDULER::task20Hz( void )
+bool SCHEDULER::step( void )
 {
-	telemetry_core.parseReceivedData();
+	uint8_t	 index		   = 0;
+	uint16_t measured_rate = 0;		///< Rate of the task group on its PERF_MONITOR loop channel
+
+	if( task_tick != 1 )
+	{
+		return false;
+	}
+
+	task_tick = 0;
+	task_counter++;
+	monitor.idle_time_us += monitor.getElapsedTime_us(Tools::time_measure_channel_map_type::MAIN_TASK_IDLE_TIME);
+	monitor.startElapsedTimeMeasure(Tools::time_measure_channel_map_type::LOOP_ALL);
+
+	for(index = 0; index < task_number; index++)
+	{
+		if( (task_counter % task_table[index].prescaler) == task_table[index].phase )
+		{
+			if(task_table[index].rate_hz != measured_rate)
+			{
+				finishLoopMeasure(measured_rate);
+				measured_rate = task_table[index].rate_hz;
+				startLoopMeasure(measured_rate);
+			}
+			runTask(index);
+			work_queue.drain(Tools::WORK_DRAIN_LIMIT_US);
+		}
+	}
+	finishLoopMeasure(measured_rate);
+
+	runEvents();
+
+	if( (task_counter % SCHEDULER_TICK_HZ ) == (SCHEDULER_TICK_HZ - 1) )
+	{
+		monitor.measureCpuLoad();
+	}
+
+	monitor.getElapsedTime_us(Tools::time_measure_channel_map_type::LOOP_ALL);
+	monitor.startElapsedTimeMeasure(Tools::time_measure_channel_map_type::MAIN_TASK_IDLE_TIME);
+
+	return true;
 }
 
 
 
 /**
-  * @brief 		10Hz loop function
+  * @brief 		Starts the PERF_MONITOR loop channel of a rate, the tasks of one rate in a
+  *				frame are measured together as the fixed loops were
   *
-  * @param[in]  void
+  * @param[in]  uint16_t rate_hz
   *
   * @return 	void
   */
-void SCHEDULER::task10Hz( void )
+void SCHEDULER::startLoopMeasure( uint16_t rate_hz )
 {
-	telemetry_core.sendPeriodicPacket();
+	Tools::time_measure_channel_map_type channel = Tools::time_measure_channel_map_type::LOOP_ALL;
+
+	if(getLoopChannel(rate_hz, channel) == true)
+	{
+		monitor.startElapsedTimeMeasure(channel);
+	}
 }
 
 
 
 /**
-  * @brief 		5Hz loop function
+  * @brief 		Stops the PERF_MONITOR loop channel of a rate, its maximum is kept for measureCpuLoad
   *
-  * @param[in]  void
+  * @param[in]  uint16_t rate_hz
   *
   * @return 	void
   */
-void SCHEDULER::task5Hz( void )
+void SCHEDULER::finishLoopMeasure( uint16_t rate_hz )
+{
+	Tools::time_measure_channel_map_type channel = Tools::time_measure_channel_map_type::LOOP_ALL;
+
+	if(getLoopChannel(rate_hz, channel) == true)
+	{
+		monitor.getElapsedTime_us(channel);
+	}
+}
+
+
+
+/**
+  * @brief 		Returns the PERF_MONITOR loop channel of a task rate
+  *
+  * @param[in]  uint16_t rate_hz
+  * @param[out] Tools::time_measure_channel_map_type &channel
+  *
+  * @return 	bool : false if the rate has no loop channel
+  */
+bool SCHEDULER::getLoopChannel( uint16_t rate_hz, Tools::time_measure_channel_map_type &channel ) const
 {
+	switch(rate_hz)
+	{
+		case 800: channel = Tools::time_measure_channel_map_type::LOOP_800_HZ; break;
+		case 400: channel = Tools::time_measure_channel_map_type::LOOP_400_HZ; break;
+		case 200: channel = Tools::time_measure_channel_map_type::LOOP_200_HZ; break;
+		case 100: channel = Tools::time_measure_channel_map_type::LOOP_100_HZ; break;
+		case  50: channel = Tools::time_measure_channel_map_type::LOOP_50_HZ;  break;
+		case  20: channel = Tools::time_measure_channel_map_type::LOOP_20_HZ;  break;
+		case  10: channel = Tools::time_measure_channel_map_type::LOOP_10_HZ;  break;
+		case   5: channel = Tools::time_measure_channel_map_type::LOOP_5_HZ;   break;
+		case   2: channel = Tools::time_measure_channel_map_type::LOOP_2_HZ;   break;
+		case   1: channel = Tools::time_measure_channel_map_type::LOOP_1_HZ;   break;
+		default:  return false;
+	}
 
+	return true;
 }
 
 
 
 /**
-  * @brief 		2Hz loop function
+  * @brief 		Runs the signalled event tasks in registration order while their budgets
+  *				fit in the tick. An event which does not fit is deferred one tick only,
+  *				so a data ready task is never late more than one tick.
   *
   * @param[in]  void
   *
   * @return 	void
   */
-void SCHEDULER::task2Hz( void )
+void SCHEDULER::runEvents( void )
 {
+	uint32_t budget_us = tick_budget_us[task_counter % SCHEDULER_TICK_HZ];
+	uint8_t	 event_id  = 0;
 
+	for(event_id = 0; event_id < event_number; event_id++)
+	{
+		if(event_pending[event_id] == false)
+		{
+			continue;
+		}
+
+		if( ( (budget_us + event_table[event_id].budget_us) > TICK_BUDGET_US ) && (event_deferred[event_id] == false) )
+		{
+			event_deferred[event_id] = true;
+			continue;
+		}
+
+		// Cleared before the run, a byte received during the task signals it again
+		event_pending[event_id]	 = false;
+		event_deferred[event_id] = false;
+		budget_us += event_table[event_id].budget_us;
+		runTask(task_number + event_id);
+		work_queue.drain(Tools::WORK_DRAIN_LIMIT_US);
+	}
 }
 
 
 
 /**
-  * @brief 		1Hz loop function
+  * @brief 		Runs one task and checks its execution time against the budget
   *
-  * @param[in]  void
+  * @param[in]  uint8_t index : Periodic table index, or task_number + event id
   *
   * @return 	void
   */
-void SCHEDULER::task1Hz( void )
+void SCHEDULER::runTask( uint8_t index )
 {
+	task_type &entry	  = ( index < task_number ) ? task_table[index] : event_table[index - task_number];
+	uint32_t   start_us	  = monitor.getMicros();
+	uint32_t   elapsed_us = 0;
+
+	entry.function();
+	elapsed_us = monitor.getMicros() - start_us;
 
+	entry.execution_counter++;
+	if(elapsed_us > entry.maximum_time_us)
+	{
+		entry.maximum_time_us = elapsed_us;
+	}
+	if(elapsed_us > entry.budget_us)
+	{
+		entry.overrun_counter++;
+	}
 }
 
 
 
 /**
-  * @brief 		Cpu main function
+  * @brief 		Places every task on the tick plan. Fixed phase tasks are placed first,
+  *				then the auto phase tasks in rate monotonic order.
   *
   * @param[in]  void
   *
   * @return 	void
   */
-void SCHEDULER::main( void )
+void SCHEDULER::balancePhases( void )
 {
-	const uint64_t LOOP_PRESCALER_400HZ =   2;
-	const uint64_t LOOP_PRESCALER_200HZ =   4;
-	const uint64_t LOOP_PRESCALER_100HZ =   8;
-	const uint64_t LOOP_PRESCALER_50HZ  =  16;
-	const uint64_t LOOP_PRESCALER_20HZ  =  40;
-	const uint64_t LOOP_PRESCALER_10HZ  =  80;
-	const uint64_t LOOP_PRESCALER_5HZ   = 160;
-	const uint64_t LOOP_PRESCALER_2HZ   = 400;
-	const uint64_t LOOP_PRESCALER_1HZ   = 800;
+	uint8_t	 index = 0;
+	uint16_t tick  = 0;
 
-	init();
-	while(true)
+	for(tick = 0; tick < SCHEDULER_TICK_HZ; tick++)
+	{
+		tick_budget_us[tick] = 0;
+	}
+
+	for(index = 0; index < task_number; index++)
 	{
-		if( task_tick == 1 ) // 800Hz
+		if(task_table[index].phase_fixed == true)
 		{
-			task_tick = 0;
-			task_counter++;
-			monitor.idle_time_us += monitor.getElapsedTime_us(Tools::time_measure_channel_map_type::MAIN_TASK_IDLE_TIME);
-			monitor.startElapsedTimeMeasure(Tools::time_measure_channel_map_type::LOOP_ALL);
+			placeTask(task_table[index]);
+		}
+	}
 
-			monitor.getFrequency_Hz(Tools::time_measure_channel_map_type::LOOP_800_HZ);
-			monitor.startElapsedTimeMeasure(Tools::time_measure_channel_map_type::LOOP_800_HZ);
-			task800Hz();
-			monitor.getElapsedTime_us(Tools::time_measure_channel_map_type::LOOP_800_HZ);
+	for(index = 0; index < task_number; index++)
+	{
+		if(task_table[index].phase_fixed == false)
+		{
+			placeTask(task_table[index]);
+		}
+	}
+}
 
-			if( (task_counter % LOOP_PRESCALER_400HZ ) == 0 )
-			{
-				monitor.getFrequency_Hz(Tools::time_measure_channel_map_type::LOOP_400_HZ);
-				monitor.startElapsedTimeMeasure(Tools::time_measure_channel_map_type::LOOP_400_HZ);
-				task400Hz();
-				monitor.getElapsedTime_us(Tools::time_measure_channel_map_type::LOOP_400_HZ);
-			}
 
-			if( (task_counter % LOOP_PRESCALER_200HZ ) == 1 )
-			{
-				monitor.getFrequency_Hz(Tools::time_measure_channel_map_type::LOOP_200_HZ);
-				monitor.startElapsedTimeMeasure(Tools::time_measure_channel_map_type::LOOP_200_HZ);
-				task200Hz();
-				monitor.getElapsedTime_us(Tools::time_measure_channel_map_type::LOOP_200_HZ);
-			}
-			
-			if( (task_counter % LOOP_PRESCALER_100HZ ) == 3 )
-			{
-				monitor.getFrequency_Hz(Tools::time_measure_channel_map_type::LOOP_100_HZ);
-				monitor.startElapsedTimeMeasure(Tools::time_measure_channel_map_type::LOOP_100_HZ);
-				task100Hz();
-				monitor.getElapsedTime_us(Tools::time_measure_channel_map_type::LOOP_100_HZ);
-			}
-			
-			if( (task_counter % LOOP_PRESCALER_50HZ ) == 7 )
-			{
-				monitor.getFrequency_Hz(Tools::time_measure_channel_map_type::LOOP_50_HZ);
-				monitor.startElapsedTimeMeasure(Tools::time_measure_channel_map_type::LOOP_50_HZ);
-				task50Hz();
-				monitor.getElapsedTime_us(Tools::time_measure_channel_map_type::LOOP_50_HZ);
-			}
-			
-			if( (task_counter % LOOP_PRESCALER_20HZ ) == 11 )
-			{
-				monitor.getFrequency_Hz(Tools::time_measure_channel_map_type::LOOP_20_HZ);
-				monitor.startElapsedTimeMeasure(Tools::time_measure_channel_map_type::LOOP_20_HZ);
-				task20Hz();
-				monitor.getElapsedTime_us(Tools::time_measure_channel_map_type::LOOP_20_HZ);
-			}
-			
-			if( (task_counter % LOOP_PRESCALER_10HZ ) == 15 )
-			{
-				monitor.getFrequency_Hz(Tools::time_measure_channel_map_type::LOOP_10_HZ);
-				monitor.startElapsedTimeMeasure(Tools::time_measure_channel_map_type::LOOP_10_HZ);
-				task10Hz();
-				monitor.getElapsedTime_us(Tools::time_measure_channel_map_type::LOOP_10_HZ);
-			}
-			
-			if( (task_counter % LOOP_PRESCALER_5HZ ) == 19 )
-			{
-				monitor.getFrequency_Hz(Tools::time_measure_channel_map_type::LOOP_5_HZ);
-				monitor.startElapsedTimeMeasure(Tools::time_measure_channel_map_type::LOOP_5_HZ);
-				task5Hz();
-				monitor.getElapsedTime_us(Tools::time_measure_channel_map_type::LOOP_5_HZ);
-			}
-			
-			if( (task_counter % LOOP_PRESCALER_2HZ ) == 27 )
+
+/**
+  * @brief 		Adds the budget of a task to the tick plan. An auto phase task takes the
+  *				phase with the lowest resulting peak tick budget, then the lowest total.
+  *
+  * @param[in]  task_type &entry
+  *
+  * @return 	void
+  */
+void SCHEDULER::placeTask( task_type &entry )
+{
+	uint16_t phase		   = 0;
+	uint16_t tick		   = 0;
+	uint32_t peak_us	   = 0;
+	uint32_t total_us	   = 0;
+	uint32_t best_peak_us  = UINT32_MAX;
+	uint32_t best_total_us = UINT32_MAX;
+
+	if(entry.phase_fixed == false)
+	{
+		for(phase = 0; phase < entry.prescaler; phase++)
+		{
+			peak_us	 = 0;
+			total_us = 0;
+			for(tick = phase; tick < SCHEDULER_TICK_HZ; tick += entry.prescaler)
 			{
-				monitor.getFrequency_Hz(Tools::time_measure_channel_map_type::LOOP_2_HZ);
-				monitor.startElapsedTimeMeasure(Tools::time_measure_channel_map_type::LOOP_2_HZ);
-				task2Hz();
-				monitor.getElapsedTime_us(Tools::time_measure_channel_map_type::LOOP_2_HZ);
+				total_us += tick_budget_us[tick];
+				if(tick_budget_us[tick] > peak_us)
+				{
+					peak_us = tick_budget_us[tick];
+				}
 			}
-			
-			if( (task_counter % LOOP_PRESCALER_1HZ ) == 31 )
+
+			if( (peak_us < best_peak_us) || ( (peak_us == best_peak_us) && (total_us < best_total_us) ) )
 			{
-				monitor.getFrequency_Hz(Tools::time_measure_channel_map_type::LOOP_1_HZ);
-				monitor.startElapsedTimeMeasure(Tools::time_measure_channel_map_type::LOOP_1_HZ);
-				task1Hz();
-				monitor.getElapsedTime_us(Tools::time_measure_channel_map_type::LOOP_1_HZ);
-			}
-			
-			if( (task_counter % LOOP_PRESCALER_1HZ ) == 799 )
-			{ 
-				monitor.measureCpuLoad();
+				best_peak_us  = peak_us;
+				best_total_us = total_us;
+				entry.phase	  = phase;
 			}
-			
-			monitor.getElapsedTime_us(Tools::time_measure_channel_map_type::LOOP_ALL);
-			monitor.startElapsedTimeMeasure(Tools::time_measure_channel_map_type::MAIN_TASK_IDLE_TIME);
 		}
 	}
+
+	for(tick = entry.phase; tick < SCHEDULER_TICK_HZ; tick += entry.prescaler)
+	{
+		tick_budget_us[tick] += entry.budget_us;
+	}
 }
 
 
@@ -33,18 +33,48 @@
  * Begin of Includes
  */
 #include <stdint.h>
+#ifdef __cplusplus
+#include "ds_debug_tools.hpp"
+#endif
 // End Of Includes
 
 
 
+#ifdef __cplusplus
+
 /*
  * Begin of Macro Definitions
  */
-
+const uint16_t SCHEDULER_TICK_HZ	= 800;		///< TIM6 tick, every task rate must divide it
+const uint8_t  MAXIMUM_TASK_NUMBER	= 32;
+const uint16_t TASK_PHASE_AUTO		= 0xFFFF;	///< Phase is assigned by the scheduler to balance the tick load
+const uint8_t  MAXIMUM_EVENT_NUMBER	= 8;
+const uint8_t  EVENT_ID_NONE		= 0xFF;
+const uint16_t TICK_BUDGET_US		= 1000;		///< Plannable part of the 1250us tick, the rest is left to the interrupts
 //End of Macro Definitions
 
 
-#ifdef __cplusplus
+
+/*
+ * Begin of Enum, Union and Struct Definitions
+ */
+struct task_type
+{
+	const char	*name;
+	void		(*function)( void );
+	uint16_t	rate_hz;				///< 0 for the event tasks
+	uint16_t	prescaler;				///< SCHEDULER_TICK_HZ / rate_hz
+	uint16_t	phase;					///< Task runs when task_counter % prescaler == phase
+	bool		phase_fixed;			///< Phase is given by the task owner, it is not moved by balancing
+	uint16_t	budget_us;				///< Worst case execution time, used for balancing and overrun detection
+	uint8_t		priority;				///< Order among the tasks of the same rate, 0 runs first
+	uint32_t	execution_counter;
+	uint32_t	overrun_counter;		///< Executions which took longer than budget_us
+	uint32_t	maximum_time_us;
+};
+// End of Enum, Union and Struct Definitions
+
+
 
 /*
  * SCHEDULER Class Definition
@@ -55,18 +85,19 @@ class SCHEDULER
 			SCHEDULER();
 			
 			void init		( void );
-			void task1Hz	( void );
-			void task2Hz	( void );
-			void task5Hz	( void );
-			void task10Hz	( void );
-			void task20Hz	( void );
-			void task50Hz	( void );
-			void task100Hz	( void );
-			void task200Hz	( void );
-			void task400Hz	( void );
-			void task800Hz	( void );
 			void main		( void );
+			bool step		( void );
 			void setTick	( void );
+
+			bool			 addTask				( const char *name, void (*function)( void ), uint16_t rate_hz,
+													  uint16_t budget_us, uint8_t priority, uint16_t phase = TASK_PHASE_AUTO );
+			uint8_t			 getTaskNumber			( void ) const;
+			const task_type* getTask				( uint8_t index ) const;
+			bool			 setTaskFunction		( uint8_t index, void (*function)( void ) );
+			uint32_t		 getMaximumTickBudget_us( void ) const;
+
+			uint8_t			 addEventTask			( const char *name, void (*function)( void ), uint16_t budget_us );
+			void			 signalEvent			( uint8_t event_id );
 			
 			SCHEDULER(const SCHEDULER& orig);
 			virtual ~SCHEDULER();
@@ -74,12 +105,35 @@ class SCHEDULER
     private:
 			uint8_t 	task_tick;
 			uint64_t 	task_counter;
+			task_type	task_table[MAXIMUM_TASK_NUMBER];	///< Sorted rate monotonic, higher rate first, then priority
+			uint8_t		task_number;
+			uint32_t	tick_budget_us[SCHEDULER_TICK_HZ];	///< Planned budget of every tick in one second
+			task_type	event_table[MAXIMUM_EVENT_NUMBER];	///< Registration order, runs after the periodic tasks of the tick
+			uint8_t		event_number;
+			volatile bool event_pending[MAXIMUM_EVENT_NUMBER];	///< Set by signalEvent, also from interrupts
+			bool		event_deferred[MAXIMUM_EVENT_NUMBER];	///< Did not fit in the last tick, runs in the next one anyway
+
+			void	 runEvents		( void );
+			void	 runTask		( uint8_t index );
+			void	 balancePhases	( void );
+			void	 placeTask		( task_type &entry );
+			void	 startLoopMeasure	( uint16_t rate_hz );
+			void	 finishLoopMeasure	( uint16_t rate_hz );
+			bool	 getLoopChannel		( uint16_t rate_hz, Tools::time_measure_channel_map_type &channel ) const;
 		
 };
 // End of SCHEDULER Class Definition
 
 
 
+/*
+ * External Linkages
+ */
+extern SCHEDULER task;
+// End of External Linkages
+
+
+
 extern "C"
 {
 #endif
@@ -315,7 +315,7 @@ void PACKET::add_int16 (int16_t  *value_s16, const uint8_t *buffer, uint16_t *in
   * uart1.initialize();
   * @endcode
   */
-void add_int24( int32_t *value_s32, const uint8_t *buffer, uint16_t *index )
+void PACKET::add_int24( int32_t *value_s32, const uint8_t *buffer, uint16_t *index )
 {
 	#ifdef _LITTLE_ENDIAN_
 	( (uint8_t *) value_s32 )[ 0 ] = buffer[ *index     ];
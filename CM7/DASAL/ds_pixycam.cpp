@@ -65,8 +65,8 @@ PIXY_CAMERA::~PIXY_CAMERA()
 void PIXY_CAMERA::read()
 {
 	pixy_cam_read_state_t pixy_cam_read_state = pixy_cam_read_state_t::SOF_L;
-	uint8_t cbuffer[Peripherals::Uart::UART_BUFFER_SIZE] = { 0 };
-	uint16_t coming_data_size = uart2.getDataFromBuffer(cbuffer);
+	Peripherals::Uart::receive_span_type cbuffer;
+	uint16_t coming_data_size = uart2.peek(cbuffer);
 	uint16_t temp_cheksum = 0;
 
 	static frame_t temp_frame;
@@ -318,6 +318,7 @@ void PIXY_CAMERA::read()
 				break;
 		}
 	}
+	uart2.consume(coming_data_size);
 }
 
 /**
@@ -0,0 +1,342 @@
+/**
+ ******************************************************************************
+  * @file		: ds_ring_buffer.hpp
+  * @brief		: Ring buffer header file
+  *				  This file contains the single producer single consumer ring used by the drivers
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+#ifndef DS_RING_BUFFER_HPP
+#define	DS_RING_BUFFER_HPP
+
+
+
+/*
+ * Begin of Includes
+ */
+#include <stdint.h>
+#include <atomic>
+#include <algorithm>
+// End of Includes
+
+
+
+namespace Tools
+{
+
+
+
+/*
+ * Begin of Enum, Union and Struct Definitions
+ */
+/**
+ * @brief Unread elements of a ring in place, two spans when they wrap around the end
+ */
+template <typename element_type>
+struct ring_span_type
+{
+	const element_type	*first			= nullptr;
+	uint32_t			 first_size		= 0;
+	const element_type	*second			= nullptr;
+	uint32_t			 second_size	= 0;
+
+	uint32_t size(void) const
+	{
+		return first_size + second_size;
+	}
+
+	element_type operator[](uint32_t index) const
+	{
+		return (index < first_size) ? first[index] : second[index - first_size];
+	}
+
+	void copy(element_type destination[], uint32_t offset, uint32_t size) const
+	{
+		uint32_t first_part = 0;
+
+		if(offset < first_size)
+		{
+			first_part = std::min(first_size - offset, size);
+			std::copy_n(&first[offset], first_part, destination);
+			offset = first_size;
+		}
+		if(size > first_part)
+		{
+			std::copy_n(&second[offset - first_size], size - first_part, &destination[first_part]);
+		}
+	}
+};
+// End of Enum, Union and Struct Definitions
+
+
+
+/*
+ * Begin of RING_BUFFER Class Definition
+ */
+/**
+ * @brief Lock-free ring for one producer and one consumer, e.g. an interrupt and the main
+ *		  loop or the two cores. head is only written by the producer and tail only by the
+ *		  consumer, both are free running and published with release/acquire ordering.
+ *		  A full ring drops the new elements and counts them, the unread data is never
+ *		  overwritten. The class has no virtual functions, so an instance can be mapped
+ *		  on a fixed address which is shared with the other core.
+ */
+template <typename element_type, uint32_t CAPACITY>
+class RING_BUFFER
+{
+	static_assert( (CAPACITY != 0) && ( (CAPACITY & (CAPACITY - 1)) == 0 ), "RING_BUFFER capacity must be a power of two" );
+
+	public:
+		static const uint32_t MASK = CAPACITY - 1;
+
+		RING_BUFFER() : head(0), tail(0), overrun_counter(0)
+		{
+		}
+
+		RING_BUFFER(const RING_BUFFER &orig) = delete;
+
+
+
+		/**
+		  * @brief 		Producer: adds one element
+		  *
+		  * @return 	bool : false if the ring is full, the element is dropped
+		  */
+		bool push(const element_type &element)
+		{
+			const uint32_t position = head.load(std::memory_order_relaxed);
+
+			if( (position - tail.load(std::memory_order_acquire)) >= CAPACITY )
+			{
+				countOverrun(1);
+				return false;
+			}
+
+			buffer[position & MASK] = element;
+			head.store(position + 1, std::memory_order_release);
+
+			return true;
+		}
+
+
+
+		/**
+		  * @brief 		Producer: adds the elements which fit with at most two block copies
+		  *
+		  * @return 	uint32_t : Number of elements added, the rest is dropped and counted
+		  */
+		uint32_t pushBulk(const element_type elements[], uint32_t count)
+		{
+			const uint32_t position = head.load(std::memory_order_relaxed);
+			const uint32_t space	= CAPACITY - (position - tail.load(std::memory_order_acquire));
+			const uint32_t index	= position & MASK;
+			uint32_t	   first	= 0;
+
+			if(count > space)
+			{
+				countOverrun(count - space);
+				count = space;
+			}
+
+			first = std::min(count, CAPACITY - index);
+			std::copy_n(elements, first, &buffer[index]);
+			std::copy_n(&elements[first], count - first, &buffer[0]);
+			head.store(position + count, std::memory_order_release);
+
+			return count;
+		}
+
+
+
+		/**
+		  * @brief 		Producer: publishes elements which were written in place, e.g. by a DMA
+		  *				into getStorage()
+		  */
+		void commit(uint32_t count)
+		{
+			head.store(head.load(std::memory_order_relaxed) + count, std::memory_order_release);
+		}
+
+
+
+		/**
+		  * @brief 		Publishes elements written in place by a circular DMA, which does not stop at
+		  *				the tail. Unread elements it overwrote are dropped and counted, the tail moves
+		  *				to the oldest element left. Only for a producer which is also the consumer.
+		  */
+		void commitOverwrite(uint32_t count)
+		{
+			const uint32_t position = head.load(std::memory_order_relaxed) + count;
+			const uint32_t size		= position - tail.load(std::memory_order_relaxed);
+
+			if(size > CAPACITY)
+			{
+				countOverrun(size - CAPACITY);
+				tail.store(position - CAPACITY, std::memory_order_relaxed);
+			}
+			head.store(position, std::memory_order_release);
+		}
+
+
+
+		/**
+		  * @brief 		Consumer: takes one element
+		  *
+		  * @return 	bool : false if the ring is empty
+		  */
+		bool pop(element_type &element)
+		{
+			const uint32_t position = tail.load(std::memory_order_relaxed);
+
+			if(position == head.load(std::memory_order_acquire))
+			{
+				return false;
+			}
+
+			element = buffer[position & MASK];
+			tail.store(position + 1, std::memory_order_release);
+
+			return true;
+		}
+
+
+
+		/**
+		  * @brief 		Consumer: takes up to count elements with at most two block copies
+		  *
+		  * @return 	uint32_t : Number of elements taken
+		  */
+		uint32_t popBulk(element_type elements[], uint32_t count)
+		{
+			ring_span_type<element_type> span;
+
+			count = std::min(count, peek(span));
+			span.copy(elements, 0, count);
+			tail.store(tail.load(std::memory_order_relaxed) + count, std::memory_order_release);
+
+			return count;
+		}
+
+
+
+		/**
+		  * @brief 		Consumer: gives the unread elements in place, they stay valid until consumed
+		  *
+		  * @return 	uint32_t : Number of unread elements
+		  */
+		uint32_t peek(ring_span_type<element_type> &span) const
+		{
+			const uint32_t position = tail.load(std::memory_order_relaxed);
+			const uint32_t index	= position & MASK;
+			const uint32_t size		= head.load(std::memory_order_acquire) - position;
+
+			span.first		 = &buffer[index];
+			span.first_size	 = std::min(size, CAPACITY - index);
+			span.second		 = &buffer[0];
+			span.second_size = size - span.first_size;
+
+			return size;
+		}
+
+
+
+		/**
+		  * @brief 		Consumer: releases elements given by peek, limited to the unread elements
+		  */
+		void consume(uint32_t count)
+		{
+			const uint32_t position = tail.load(std::memory_order_relaxed);
+
+			count = std::min(count, head.load(std::memory_order_acquire) - position);
+			tail.store(position + count, std::memory_order_release);
+		}
+
+
+
+		/**
+		  * @brief 		Consumer: drops every unread element
+		  */
+		void flush(void)
+		{
+			tail.store(head.load(std::memory_order_acquire), std::memory_order_release);
+		}
+
+
+
+		/**
+		  * @brief 		Empties the ring, only while neither side is running
+		  */
+		void reset(void)
+		{
+			head.store(0, std::memory_order_relaxed);
+			tail.store(0, std::memory_order_relaxed);
+			overrun_counter.store(0, std::memory_order_release);
+		}
+
+
+
+		uint32_t getSize(void) const
+		{
+			return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+		}
+
+		uint32_t getSpace(void) const
+		{
+			return CAPACITY - getSize();
+		}
+
+		uint32_t getHead(void) const
+		{
+			return head.load(std::memory_order_acquire);
+		}
+
+		uint32_t getOverrunCounter(void) const
+		{
+			return overrun_counter.load(std::memory_order_relaxed);
+		}
+
+		element_type *getStorage(void)
+		{
+			return buffer;
+		}
+
+	protected:
+
+	private:
+		void countOverrun(uint32_t count)
+		{
+			overrun_counter.store(overrun_counter.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);	///< Producer only, no exclusive access needed
+		}
+
+		std::atomic<uint32_t> head;				///< Written by the producer only
+		std::atomic<uint32_t> tail;				///< Written by the consumer only
+		std::atomic<uint32_t> overrun_counter;	///< Elements dropped because the ring was full, written by the producer
+		element_type		  buffer[CAPACITY];
+};
+// End of RING_BUFFER Class Definition
+
+
+
+} //End of namespace Tools
+
+
+#endif	/* DS_RING_BUFFER_HPP */
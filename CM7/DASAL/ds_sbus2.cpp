@@ -39,6 +39,7 @@
 #include <cstring>
 #include <cmath>
 #include "ds_debug_tools.hpp"
+#include "ds_work_queue.hpp"
 // End of Includes
 
 
@@ -89,11 +90,16 @@ SBUS2_TELEMETRY::SBUS2_TELEMETRY():
 timer_enabled(false),
 telemetry_initialized(false),
 new_data_available(false),
+frame_notify(nullptr),
+receive_buffer(),
+receive_buffer_index(0),
+latch_pending(),
 payload(),
 active_slot_multiplier(0),
 rssi(0),
 packet_loss_counter(0),
 unprocessed_packet_counter(0),
+latch_overrun_counter(0),
 out_of_range_packet_counter(0),
 frame_status(frame_status_type::NOT_INITIALIZED),
 receiver_status(receiver_status_type::RECEIVER_NOT_PLUGGED_IN)
@@ -131,6 +137,36 @@ void SBUS2_TELEMETRY::scheduler(void)
 
 
 
+/**
+  * @brief 			Parses the frame right after the frame notification, the
+  *							telemetry is still updated by the scheduler
+  *
+  * @param[in]	void
+  *
+  * @return 		void
+  */
+void SBUS2_TELEMETRY::frameHandler(void)
+{
+	parseReceivedData();
+}
+
+
+
+/**
+  * @brief 			Sets the function called when a new frame is latched for
+  *							frameHandler
+  *
+  * @param[in]	void (*notify)(void) : It must only signal
+  *
+  * @return 		void
+  */
+void SBUS2_TELEMETRY::setFrameNotification(void (*notify)(void))
+{
+	frame_notify = notify;
+}
+
+
+
 /**
   * @brief 			Uart receive interrupt handler
   *
@@ -142,7 +178,7 @@ void SBUS2_TELEMETRY::receiveInterruptHandler(uint8_t data)
 {
 	static receive_handler_state_type state = receive_handler_state_type::HEADER;
 	static uint16_t counter = 0;
-	static uint8_t	buffer[FRAME_LENGTH] = {0};
+	uint8_t *buffer = receive_buffer[receive_buffer_index];
 
 	if(timer_enabled == false)
 	{
@@ -174,15 +210,7 @@ void SBUS2_TELEMETRY::receiveInterruptHandler(uint8_t data)
 					case FRAME_END_SLOT_16_23:
 					case FRAME_END_SLOT_24_31:
 						active_slot_multiplier = (data & 0xF0) >> 4;
-						if(new_data_available == false)
-						{
-							std::memcpy(payload, buffer, FRAME_LENGTH);
-							new_data_available = true;
-						}
-						else
-						{
-							unprocessed_packet_counter++;
-						}
+						postFrame();
 						frame_status = frame_status_type::SBUS2_TELEMETRY;
 						state = receive_handler_state_type::HEADER;
 						enableTimer();
@@ -191,15 +219,7 @@ void SBUS2_TELEMETRY::receiveInterruptHandler(uint8_t data)
 					case FRAME_END_NON_TELEMETRY:
 						if(buffer[21] != 0)
 						{
-							if(new_data_available == false)
-							{
-								std::memcpy(payload, buffer, FRAME_LENGTH);
-								new_data_available = true;
-							}
-							else
-							{
-								unprocessed_packet_counter++;
-							}
+							postFrame();
 							frame_status = frame_status_type::SBUS_NON_TELEMETRY;
 						}
 						else
@@ -296,6 +316,85 @@ void SBUS2_TELEMETRY::timerInterruptHandler(void)
 
 
 
+/**
+  * @brief 			Hands the received frame to the main loop and switches the
+  *							interrupt to the other buffer. The frame is latched in the
+  *							interrupt only if the work queue is full. If the main loop
+  *							has not latched the other buffer yet, the frame is dropped:
+  *							SBUS has no CRC, the next frame must not tear the queued one.
+  *
+  * @param[in]	void
+  *
+  * @return 		void
+  */
+void SBUS2_TELEMETRY::postFrame(void)
+{
+	const uint8_t next_index = receive_buffer_index ^ 1;
+
+	if(latch_pending[next_index] == true)
+	{
+		latch_overrun_counter++;
+		return;
+	}
+
+	latch_pending[receive_buffer_index] = true;
+	if(work_queue.post(latchFrameWork, this, receive_buffer_index) == true)
+	{
+		receive_buffer_index = next_index;
+	}
+	else
+	{
+		latch_pending[receive_buffer_index] = false;
+		latchFrame(receive_buffer_index);
+	}
+}
+
+
+
+/**
+  * @brief 			Copies a received frame to the payload for the parser
+  *
+  * @param[in]	uint8_t buffer_index : Receive buffer of the frame
+  *
+  * @return 		void
+  */
+void SBUS2_TELEMETRY::latchFrame(uint8_t buffer_index)
+{
+	if(new_data_available == false)
+	{
+		std::memcpy(payload, receive_buffer[buffer_index], FRAME_LENGTH);
+		new_data_available = true;
+		if(frame_notify != nullptr)
+		{
+			frame_notify();
+		}
+	}
+	else
+	{
+		unprocessed_packet_counter++;
+	}
+}
+
+
+
+/**
+  * @brief 			Deferred work entry of latchFrame, frees the buffer for the interrupt
+  *
+  * @param[in]	void *context			 : SBUS2_TELEMETRY object
+  * @param[in]	uint32_t argument	 : Receive buffer of the frame
+  *
+  * @return 		void
+  */
+void SBUS2_TELEMETRY::latchFrameWork(void *context, uint32_t argument)
+{
+	SBUS2_TELEMETRY *sbus2 = static_cast<SBUS2_TELEMETRY *>(context);
+
+	sbus2->latchFrame(static_cast<uint8_t>(argument));
+	sbus2->latch_pending[argument] = false;
+}
+
+
+
 /**
   * @brief 			Update telemetry values
   *
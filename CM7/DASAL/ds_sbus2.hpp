@@ -218,6 +218,8 @@ class SBUS2_TELEMETRY
 
 		void initialize(void);
 		void scheduler(void);
+		void frameHandler(void);
+		void setFrameNotification(void (*notify)(void));
 
 		void receiveInterruptHandler(uint8_t data);
 		void timerInterruptHandler(void);
@@ -231,16 +233,25 @@ class SBUS2_TELEMETRY
 		bool			timer_enabled;
 		bool			telemetry_initialized;
 		bool			new_data_available;
+		void			(*frame_notify)(void);
+		uint8_t		receive_buffer[2][FRAME_LENGTH];	///< Filled by the interrupt, latched by the deferred work
+		uint8_t		receive_buffer_index;
+		volatile bool latch_pending[2];			///< The latch of the buffer is queued, the interrupt does not write it
 		uint8_t		payload[FRAME_LENGTH];
 		uint8_t		active_slot_multiplier;
 		uint8_t 	rssi;
 		uint16_t  packet_loss_counter;
 		uint16_t  unprocessed_packet_counter;
+		uint16_t  latch_overrun_counter;			///< Frames dropped because both buffers waited for their latch
 		uint16_t 	out_of_range_packet_counter;
 		frame_status_type	frame_status;
 		receiver_status_type receiver_status;
 		slot_type slot;
 
+		void postFrame(void);
+		void latchFrame(uint8_t buffer_index);
+		static void latchFrameWork(void *context, uint32_t argument);
+
 		void updateTelemetry(void);
 		void parseReceivedData(void);
 		bool isRawValuesInLimits(void);
@@ -27,6 +27,7 @@
  * Begin of Includes
  */
 #include <string.h>
+#include <atomic>
 #include "ds_serializer.hpp"
 #include "ds_telemetry_core.hpp"
 // End of Includes
@@ -58,7 +59,7 @@ SERIALIZER::SERIALIZER(scheduler_freq_t freq, packet_size_t size):
 packet_count_write(static_cast<uint16_t>(freq)),
 packet_size(static_cast<uint16_t>(size))
 {
-	uint16_t datalogger_packet_size = sizeof(dl_packet.buffer);
+	uint16_t datalogger_packet_size = sizeof(dl_packet_t);
 
 	master_err_flags.all = 0;
 	slave_status_flags.all = 0;
@@ -81,11 +82,16 @@ packet_size(static_cast<uint16_t>(size))
   */
 void SERIALIZER::initialize(void)
 {
+	master_link.initialize();
+	slave_link.update();
+
 	master_cmd = command_t::STAND_BY;
 	setConfigParams();
 	setMasterSharedBufferIndex();
 	clearSharedBuffStatusBytes();
 	updateMasterStatus();
+
+	master_link.publish();
 }
 
 
@@ -132,7 +138,6 @@ void SERIALIZER::scheduler(void)
 			case serializer_state_t::WRITE:
 				if(!datalogger_err_flags.bits.datalogger_err)
 				{
-					updatePacket();
 					if(update_buff_idx_master == true)
 					{
 						update_buff_idx_master = false;
@@ -171,7 +176,10 @@ void SERIALIZER::scheduler(void)
 
 					if(serializer_state == serializer_state_t::WRITE)
 					{
-						writeToSharedBuffer();
+						dl_packet_t &record = *claimSharedSlotRecord();
+
+						updatePacket(record);
+						commitSharedSlotRecord(record);
 						packet_counter++;
 
 						if(packet_counter >= static_cast<uint32_t>(packet_count_write))
@@ -219,6 +227,8 @@ void SERIALIZER::scheduler(void)
 	}
 
 	updateMasterStatus();
+
+	master_link.publish();
 }
 
 
@@ -226,11 +236,11 @@ void SERIALIZER::scheduler(void)
 /**
   * @brief 		  Updates packet to be logged
   *
-  * @param[in]  void	Nothing
+  * @param[in]  dl_packet_t &dl_packet	Record in the shared buffer slot
   *
   * @return 	  void	Nothing
   */
-void SERIALIZER::updatePacket(void)
+void SERIALIZER::updatePacket(dl_packet_t &dl_packet)
 {
 	//TODO: Can be deleted after tests are done
 	dl_packet.data.dummy_data_000_d64 = -12345.678901231;
@@ -462,7 +472,7 @@ void SERIALIZER::updatePacket(void)
 
 
 /**
-  * @brief 		  Sends the date and time information to the slave
+  * @brief 		  Updates the date and time information of the master state
   *
   * @param[in]  void	Nothing
   *
@@ -470,9 +480,6 @@ void SERIALIZER::updatePacket(void)
   */
 void SERIALIZER::updateDateAndTime(void)
 {
-	const uint16_t BUFFER_SIZE = sizeof(gnss_date_and_time.buffer);
-		  uint8_t  set_buffer[BUFFER_SIZE] = {0};
-
 	// TODO: Will be deleted after GNSS packet added - Test
 	/***********************************************************************************************************************************/
 	gnss_date_and_time.data.iTOW   = 123456789;
@@ -484,9 +491,7 @@ void SERIALIZER::updateDateAndTime(void)
 	gnss_date_and_time.data.second = 1;
 	/***********************************************************************************************************************************/
 
-	memcpy(set_buffer,gnss_date_and_time.buffer,BUFFER_SIZE);
-
-	telemetry_core.sendPacketToSharedBuff(DATE_AND_TIME_ADDR,static_cast<uint16_t>(cmd_type::DATE_AND_TIME),set_buffer,BUFFER_SIZE);
+	memcpy(master_link.state.date_and_time,gnss_date_and_time.buffer,DATE_AND_TIME_SIZE);
 }
 
 
@@ -528,7 +533,7 @@ void SERIALIZER::updateMasterStatus(void)
 
 
 /**
-  * @brief 		  Sends master commands to slave
+  * @brief 		  Updates the master command of the master state
   *
   * @param[in]  void	Nothing
   *
@@ -536,19 +541,14 @@ void SERIALIZER::updateMasterStatus(void)
   */
 void SERIALIZER::setMasterCommand(void)
 {
-	      uint8_t  master_command = static_cast<uint8_t>(master_cmd);
-	const uint16_t BUFFER_SIZE = sizeof(master_command);
-				uint8_t  set_buffer[BUFFER_SIZE] = {0};
-
-	memcpy(set_buffer,&master_command,BUFFER_SIZE);
-
-	telemetry_core.sendPacketToSharedBuff(MASTER_CMD_ADDR,static_cast<uint16_t>(cmd_type::MASTER_CMD),set_buffer,BUFFER_SIZE);
+	master_link.state.command = static_cast<uint8_t>(master_cmd);
 }
 
 
 
 /**
-  * @brief 		  Gets slave status byte(s) and data logger status byte(s)
+  * @brief 		  Reads the slave state once per cycle and gets the slave status byte(s)
+  *             and data logger status byte(s) from it
   *
   * @param[in]  void	Nothing
   *
@@ -556,20 +556,16 @@ void SERIALIZER::setMasterCommand(void)
   */
 bool SERIALIZER::getSlaveStatus(void)
 {
-	const uint16_t BUFFER_SIZE = sizeof(slave_status_flags.all) +
-									             sizeof(datalogger_err_flags.all) +
-									             sizeof(datalogger_err_cntr);
-
-				uint8_t  get_buffer[BUFFER_SIZE] = {0};
-				bool     success = false;
+	bool success = false;
 
-	success = telemetry_core.receivePacketFromSharedBuff(SLAVE_STATUS_ADDR, get_buffer, BUFFER_SIZE);
+	slave_link.update();
+	success = slave_link.isValid();
 
 	if(success == true)
 	{
-		memcpy(&slave_status_flags.all, get_buffer, sizeof(slave_status_flags.all));
-		memcpy(&datalogger_err_flags.all, &get_buffer[sizeof(slave_status_flags.all)], sizeof(datalogger_err_flags.all));
-		memcpy(&datalogger_err_cntr, &get_buffer[sizeof(slave_status_flags.all) + sizeof(datalogger_err_flags.all)], sizeof(datalogger_err_cntr));
+		slave_status_flags.all = slave_link.state.status_flags;
+		datalogger_err_flags.all = slave_link.state.datalogger_err_flags;
+		datalogger_err_cntr = slave_link.state.datalogger_err_cntr;
 
 		master_err_flags.bits.get_slave_status_err = 0;
 	}
@@ -585,22 +581,46 @@ bool SERIALIZER::getSlaveStatus(void)
 
 
 /**
-  * @brief 		  Sends packet to the shared buffer
+  * @brief 		  Claims the next record of the current shared buffer slot, the packet is
+  *             updated in place and the slave writes it to the storage device from there
   *
   * @param[in]  void	Nothing
   *
+  * @return 	  dl_packet_t*	record
+  */
+dl_packet_t *SERIALIZER::claimSharedSlotRecord(void)
+{
+	const uint32_t slot_addr = SHARED_BUFFER_ADDR + (shared_buffer_index_master * SHARED_BUFFER_SIZE);
+	shared_slot_header_t *header = reinterpret_cast<shared_slot_header_t *>(slot_addr);
+
+	if(packet_counter == 0)
+	{
+		header->command = static_cast<uint16_t>(cmd_type::SHARED_BUFFER);
+		header->packet_size = sizeof(dl_packet_t);
+		header->packet_count = 0;
+		header->reserved = 0;
+	}
+
+	return reinterpret_cast<dl_packet_t *>(slot_addr + SHARED_SLOT_DATA_OFFSET + (packet_counter * sizeof(dl_packet_t)));
+}
+
+
+
+/**
+  * @brief 		  Commits the record claimed by claimSharedSlotRecord with its CRC16
+  *
+  * @param[in]  const dl_packet_t &record
+  *
   * @return 	  void	Nothing
   */
-void SERIALIZER::writeToSharedBuffer(void)
+void SERIALIZER::commitSharedSlotRecord(const dl_packet_t &record)
 {
-	uint32_t address = SHARED_BUFFER_ADDR +
-			           (shared_buffer_index_master * SHARED_BUFFER_SIZE) +
-			  		   (packet_counter * (sizeof(dl_packet.buffer) + static_cast<uint32_t>(9)));
-
-	telemetry_core.sendPacketToSharedBuff(address,
-										  static_cast<uint16_t>(cmd_type::SHARED_BUFFER),
-										  dl_packet.buffer,
-										  sizeof(dl_packet.buffer));
+	shared_slot_header_t *header = reinterpret_cast<shared_slot_header_t *>(SHARED_BUFFER_ADDR + (shared_buffer_index_master * SHARED_BUFFER_SIZE));
+
+	header->crc[packet_counter] = telemetry_core.calculatePacketCrc(record.buffer, sizeof(record.buffer));
+	header->packet_count = static_cast<uint16_t>(packet_counter + 1);
+
+	std::atomic_thread_fence(std::memory_order_release); /* The record is written before the FULL status */
 }
 
 
@@ -635,15 +655,11 @@ void SERIALIZER::increaseMasterSharedBufferIndex(void)
   */
 bool SERIALIZER::getSlaveSharedBufferIndex(void)
 {
-	const uint16_t BUFFER_SIZE = sizeof(shared_buffer_index_slave);
-				bool     success = false;
-				uint8_t  get_buffer[BUFFER_SIZE] = {0};
-
-	success = telemetry_core.receivePacketFromSharedBuff(SLAVE_BUFF_INDEX_ADDR, get_buffer, BUFFER_SIZE);
+	bool success = slave_link.isValid();
 
 	if(success == true)
 	{
-		memcpy(&shared_buffer_index_slave,get_buffer,BUFFER_SIZE);
+		shared_buffer_index_slave = slave_link.state.buffer_index;
 
 		if(shared_buffer_index_slave >= SHARED_BUFFER_COUNT)
 		{
@@ -675,18 +691,13 @@ bool SERIALIZER::getSlaveSharedBufferIndex(void)
   */
 void SERIALIZER::setMasterSharedBufferIndex(void)
 {
-	const uint16_t BUFFER_SIZE = sizeof(shared_buffer_index_master);
-				uint8_t  set_buffer[BUFFER_SIZE] = {0};
-
-	memcpy(set_buffer,&shared_buffer_index_master,BUFFER_SIZE);
-
-	telemetry_core.sendPacketToSharedBuff(MASTER_BUFF_INDEX_ADDR,static_cast<uint16_t>(cmd_type::MASTER_BUFFER_INDEX),set_buffer,BUFFER_SIZE);
+	master_link.state.buffer_index = shared_buffer_index_master;
 }
 
 
 
 /**
-  * @brief 		  Clears all shared buffer status byte(s)
+  * @brief 		  Clears all shared buffer status bits, the master toggles follow the slave
   *
   * @param[in]  void	Nothing
   *
@@ -694,18 +705,9 @@ void SERIALIZER::setMasterSharedBufferIndex(void)
   */
 void SERIALIZER::clearSharedBuffStatusBytes(void)
 {
-	const uint16_t BUFFER_SIZE = sizeof(shared_buffer_status);
-				uint8_t  set_buffer[BUFFER_SIZE] = {0};
-				uint8_t  i = 0;
+	shared_buffer_status = 0;
 
-  shared_buffer_status = 0;
-
-  memcpy(set_buffer,&shared_buffer_status,BUFFER_SIZE);
-
-	for(i = 0;i < SHARED_BUFFER_COUNT;i++)
-	{
-		telemetry_core.sendPacketToSharedBuff((SHARED_BUFF_STATUS_ADDR + (i * static_cast<uint32_t>(0x10))),static_cast<uint16_t>(cmd_type::SHARED_BUFFER_STATUS),set_buffer,BUFFER_SIZE);
-	}
+	master_link.state.full_toggle = slave_link.state.empty_toggle;
 }
 
 
@@ -719,16 +721,12 @@ void SERIALIZER::clearSharedBuffStatusBytes(void)
   */
 bool SERIALIZER::getSharedBufferStatus(void)
 {
-	const uint16_t BUFFER_SIZE = sizeof(shared_buffer_status);
-				bool     success = false;
-				uint8_t  get_buffer[BUFFER_SIZE] = {0};
-				uint32_t address = SHARED_BUFF_STATUS_ADDR + (shared_buffer_index_master * static_cast<uint32_t>(0x10));
-
-	success = telemetry_core.receivePacketFromSharedBuff(address, get_buffer, BUFFER_SIZE);
+	const uint8_t slot = static_cast<uint8_t>(1U << shared_buffer_index_master);
+	bool          success = slave_link.isValid();
 
 	if(success == true)
 	{
-		memcpy(&shared_buffer_status,get_buffer,BUFFER_SIZE);
+		shared_buffer_status = (((master_link.state.full_toggle ^ slave_link.state.empty_toggle) & slot) != 0U) ? FULL : EMPTY;
 
 		master_err_flags.bits.get_shared_buff_stat_err = 0;
 	}
@@ -744,7 +742,7 @@ bool SERIALIZER::getSharedBufferStatus(void)
 
 
 /**
-  * @brief 		  Sends the shared buffer status byte(s)
+  * @brief 		  Sets the shared buffer status bit, only the master toggle is flipped
   *
   * @param[in]  void	Nothing
   *
@@ -752,18 +750,19 @@ bool SERIALIZER::getSharedBufferStatus(void)
   */
 void SERIALIZER::setSharedBufferStatus(void)
 {
-	const uint16_t BUFFER_SIZE = sizeof(shared_buffer_status);
-				uint8_t  set_buffer[BUFFER_SIZE] = {0};
-				uint32_t address = SHARED_BUFF_STATUS_ADDR + (shared_buffer_index_master * static_cast<uint32_t>(0x10));
+	const uint8_t slot = static_cast<uint8_t>(1U << shared_buffer_index_master);
+	const bool    full = (((master_link.state.full_toggle ^ slave_link.state.empty_toggle) & slot) != 0U);
 
-	memcpy(set_buffer,&shared_buffer_status,BUFFER_SIZE);
-	telemetry_core.sendPacketToSharedBuff(address,static_cast<uint16_t>(cmd_type::SHARED_BUFFER_STATUS),set_buffer,BUFFER_SIZE);
+	if((shared_buffer_status == FULL) != full)
+	{
+		master_link.state.full_toggle ^= slot;
+	}
 }
 
 
 
 /**
-  * @brief 		  Sends the configuration parameters to the slave
+  * @brief 		  Sets the configuration parameters of the master state
   *
   * @param[in]  void	Nothing
   *
@@ -771,14 +770,9 @@ void SERIALIZER::setSharedBufferStatus(void)
   */
 void SERIALIZER::setConfigParams(void)
 {
-	const uint16_t BUFFER_SIZE = sizeof(packet_count_write) + sizeof(packet_size) + sizeof(config_reserved);
-				uint8_t  set_buffer[BUFFER_SIZE] = {0};
-
-	memcpy(set_buffer, &packet_count_write, sizeof(packet_count_write));
-	memcpy(&set_buffer[sizeof(packet_count_write)], &packet_size, sizeof(packet_size));
-	memcpy(&set_buffer[sizeof(packet_count_write) + sizeof(packet_size)], &config_reserved, sizeof(config_reserved));
-
-	telemetry_core.sendPacketToSharedBuff(CONFIG_PARAMS_ADDR,static_cast<uint16_t>(cmd_type::CONFIG_PARAMS),set_buffer,BUFFER_SIZE);
+	master_link.state.packet_count_write = packet_count_write;
+	master_link.state.packet_size = packet_size;
+	master_link.state.config_reserved = config_reserved;
 }
 
 
@@ -32,6 +32,7 @@
  * Begin of Includes
  */
 #include <stdint.h>
+#include "ds_state_sync.hpp"
 // End of Includes
 
 
@@ -50,13 +51,12 @@ const uint32_t MAX_SHARED_BUFF_ERR_CNT = 100;
 const uint8_t  SHARED_BUFFER_COUNT     = 8;
 const uint32_t SHARED_BUFFER_SIZE      = 0xF000;
 const uint32_t SHARED_BUFFER_ADDR      = 0x24000000;
-const uint32_t SHARED_BUFF_STATUS_ADDR = 0x38007F70;
-const uint32_t SLAVE_BUFF_INDEX_ADDR   = 0x3800FF70;
-const uint32_t MASTER_BUFF_INDEX_ADDR  = 0x3800FF80;
-const uint32_t MASTER_CMD_ADDR         = 0x3800FF90;
-const uint32_t SLAVE_STATUS_ADDR       = 0x3800FFA0;
-const uint32_t DATE_AND_TIME_ADDR      = 0x3800FFC0;
-const uint32_t CONFIG_PARAMS_ADDR      = 0x38007FF0;
+const uint32_t SHARED_SLOT_DATA_OFFSET = 0x100;  ///< Records follow the slot header, 32 byte aligned for the SDMMC IDMA
+const uint16_t SHARED_SLOT_MAX_PACKET  = 64;
+const uint32_t MASTER_STATE_ADDR       = 0x38007F70;  ///< Written by the master only, lower half of the SRAM4
+const uint32_t SLAVE_STATE_ADDR        = 0x3800FF70;  ///< Written by the slave only, upper half of the SRAM4
+const uint16_t STATE_VERSION           = 1;           ///< Increase on every change of master_state_t or slave_state_t
+const uint8_t  DATE_AND_TIME_SIZE      = 11;
 //End of Macro Definitions
 
 
@@ -311,6 +311,26 @@ const uint32_t CONFIG_PARAMS_ADDR      = 0x38007FF0;
 
 
 
+/*
+* @brief Head of a shared buffer slot. The records are written in place behind it and the slave
+*        hands them to f_write without a copy, so the record area is the file data.
+*/
+#pragma pack(1)
+	struct shared_slot_header_t
+	{
+		uint16_t command;                        ///< cmd_type::SHARED_BUFFER
+		uint16_t packet_size;
+		uint16_t packet_count;                   ///< Records committed to the slot
+		uint16_t reserved;
+		uint16_t crc[SHARED_SLOT_MAX_PACKET];    ///< CRC16 of each record
+	};
+#pragma pack()
+
+static_assert( sizeof(shared_slot_header_t) <= SHARED_SLOT_DATA_OFFSET, "Shared slot header overlaps the records" );
+static_assert( (SHARED_SLOT_DATA_OFFSET + (SHARED_SLOT_MAX_PACKET * sizeof(dl_packet_t))) <= SHARED_BUFFER_SIZE, "Shared slot records overflow the slot" );
+
+
+
 
 enum class scheduler_freq_t : uint16_t
 {
@@ -358,6 +378,8 @@ enum class cmd_type : uint16_t
 	SHARED_BUFFER        = 0x1006,
 	CONFIG_PARAMS        = 0x1007,
 	DATE_AND_TIME        = 0x1008,
+	MASTER_STATE         = 0x1009,
+	SLAVE_STATE          = 0x100A,
 };
 
 
@@ -470,6 +492,48 @@ union datalogger_err_flags_t
 
 
 
+/*
+* @brief Control fields of the master, mirrored to the slave as one block once per cycle.
+*        A shared buffer slot is FULL while its bits in full_toggle and empty_toggle differ,
+*        so each side only flips its own bit and the status has a single writer per core.
+*/
+#pragma pack(1)
+	struct master_state_t
+	{
+		uint8_t  command;                            ///< command_t
+		uint8_t  buffer_index;
+		uint8_t  full_toggle;                        ///< Bit i flipped by the master when slot i is FULL
+		uint8_t  reserved;
+		uint16_t packet_count_write;
+		uint16_t packet_size;
+		uint16_t config_reserved;
+		uint8_t  date_and_time[DATE_AND_TIME_SIZE];  ///< gnss_date_and_time_t
+		uint8_t  padding[3];
+	};
+#pragma pack()
+
+
+
+/*
+* @brief Status fields of the slave, mirrored to the master as one block once per cycle
+*/
+#pragma pack(1)
+	struct slave_state_t
+	{
+		uint8_t  status_flags;                       ///< slave_status_flags_t
+		uint8_t  buffer_index;
+		uint8_t  empty_toggle;                       ///< Bit i flipped by the slave when slot i is written
+		uint8_t  reserved;
+		uint32_t datalogger_err_flags;
+		uint32_t datalogger_err_cntr;
+	};
+#pragma pack()
+
+static_assert( sizeof(gnss_date_and_time_t) == DATE_AND_TIME_SIZE, "Date and time does not fit the master state" );
+static_assert( SHARED_BUFFER_COUNT <= 8, "Shared buffer status toggles are 8 bit" );
+
+
+
 // End of Enum, Union and Struct Definitions
 
 
@@ -482,7 +546,6 @@ class SERIALIZER
 	public:
 		SERIALIZER(scheduler_freq_t freq, packet_size_t size);
 
-		dl_packet_t dl_packet;
 		gnss_date_and_time_t gnss_date_and_time;
 
 		void initialize( void );
@@ -525,12 +588,16 @@ class SERIALIZER
 		command_t command = command_t::STAND_BY;
 		command_t master_cmd = command_t::STAND_BY;
 
-		void updatePacket     	    				 ( void );
+		Tools::STATE_PUBLISHER<master_state_t>  master_link{MASTER_STATE_ADDR, static_cast<uint16_t>(cmd_type::MASTER_STATE), STATE_VERSION};
+		Tools::STATE_SUBSCRIBER<slave_state_t>  slave_link {SLAVE_STATE_ADDR,  static_cast<uint16_t>(cmd_type::SLAVE_STATE),  STATE_VERSION};
+
+		void updatePacket     	    				 ( dl_packet_t &dl_packet );
 		void updateDateAndTime               ( void );
 		void updateMasterStatus 						 ( void );
 		void setMasterCommand   						 ( void );
 		bool getSlaveStatus    							 ( void );
-		void writeToSharedBuffer 	    			 ( void );
+		dl_packet_t *claimSharedSlotRecord   ( void );
+		void commitSharedSlotRecord          ( const dl_packet_t &record );
 		void increaseMasterSharedBufferIndex ( void );
 		bool getSlaveSharedBufferIndex       ( void );
 		void setMasterSharedBufferIndex      ( void );
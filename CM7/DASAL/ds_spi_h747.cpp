@@ -26,6 +26,7 @@
  */
 // Begin of Includes
 #include "ds_spi_h747.hpp"
+#include "ds_cache_h747.hpp"
 
 // End of Includes
 
@@ -66,7 +67,7 @@ extern "C"
   */
 static void dsSpi1InterruptCallback(SPI_HandleTypeDef *hspi_handle)
 {
-
+	UNUSED(hspi_handle);
 }
 
 
@@ -243,6 +244,7 @@ static void dsSpi2InterruptCallback(SPI_HandleTypeDef *hspi_handle)
   */
 static void dsSpi3InterruptCallback(SPI_HandleTypeDef *hspi_handle)
 {
+	UNUSED(hspi_handle);
 }
 
 
@@ -255,7 +257,7 @@ static void dsSpi3InterruptCallback(SPI_HandleTypeDef *hspi_handle)
   */
 static void dsSpi4InterruptCallback(SPI_HandleTypeDef *hspi_handle)
 {
-
+	UNUSED(hspi_handle);
 }
 
 
@@ -268,7 +270,25 @@ static void dsSpi4InterruptCallback(SPI_HandleTypeDef *hspi_handle)
   */
 static void dsSpi5InterruptCallback(SPI_HandleTypeDef *hspi_handle)
 {
+	UNUSED(hspi_handle);
+}
 
+
+/**
+  * @brief 		End of transfer of the DMA transaction queue. It is called from the SPI IRQ handlers
+  *				before HAL_SPI_IRQHandler, which would close the transfer as a HAL DMA transfer.
+  *				The flags are cleared here, so HAL_SPI_IRQHandler finds nothing to do.
+  *
+  * @param[in]  SPI_HandleTypeDef *hspi: SPI_HandleTypeDef Instance
+  *
+  * @return 	void	Nothing
+  */
+void DS_SPI_DmaInterruptHandler(SPI_HandleTypeDef *hspi_handle)
+{
+	if (spi_2.getHandle() == hspi_handle)
+	{
+		spi_2.dmaInterruptHandler();
+	}
 }
 
 
@@ -566,8 +586,8 @@ void H747_Spi::transactionDisable(SPI_HandleTypeDef *hspi_handle)
 	}
 
 	/* clear count of transaction*/
-	receiv_count 	= (uint8_t) 0;
-	trans_count 	= (uint8_t) 0;
+	receiv_count 	= 0;
+	trans_count 	= 0;
 }
 
 /**
@@ -667,8 +687,8 @@ bool H747_Spi::transactionEndProcedure(SPI_HandleTypeDef *hspi_handle)
   */
 bool H747_Spi::transmitReceive(const uint8_t *send, const uint32_t send_len,uint8_t *recv, const uint32_t recv_len)
 {
-	/* In case of any other transmission  request break transmission */
-	if (!(spi_state == spi_state_type::SPI_STATE_READY))
+	/* In case of any other transmission  request or a running DMA transaction break transmission */
+	if (!(spi_state == spi_state_type::SPI_STATE_READY) || (send_len > SPI_MAXIMUM_TRANSFER_SIZE) || (recv_len > SPI_MAXIMUM_TRANSFER_SIZE))
 	{
 		return false;
 	}
@@ -677,7 +697,7 @@ bool H747_Spi::transmitReceive(const uint8_t *send, const uint32_t send_len,uint
 	{
 		if (spi_cs_port) // cs for low
 		{
-			spi_cs_port->BSRR = spi_cs_pin;
+			spi_cs_port->BSRR = (uint32_t) spi_cs_pin << 16;
 		}
 	}
 	else
@@ -706,10 +726,10 @@ bool H747_Spi::transmitReceive(const uint8_t *send, const uint32_t send_len,uint
 		spi_receive_completed  = false;
 	}
 
-	trans_size  = (uint8_t) send_len;
-	receiv_size = (uint8_t) recv_len;
-	receiv_count= (uint8_t) recv_len;
-	trans_count = (uint8_t) send_len;
+	trans_size  = send_len;
+	receiv_size = recv_len;
+	receiv_count= recv_len;
+	trans_count = send_len;
 
 	tx_data_ptr 		       = send;
 	spi_handle_ptr->pRxBuffPtr = (uint8_t*) recv;
@@ -754,10 +774,14 @@ bool H747_Spi::transmitReceive(const uint8_t *send, const uint32_t send_len,uint
 
 		if (spi_cs_port) //cs for high
 		{
-			spi_cs_port->BSRR = (uint32_t) spi_cs_pin << 16; //TODO:Test if the pin gets high
+			spi_cs_port->BSRR = spi_cs_pin;
 		}
 
 	}
+
+	/* A transaction submitted while this call held the bus waits in the queue */
+	startDmaTransaction();
+
 	return true;
 
 }
@@ -808,11 +832,7 @@ bool H747_Spi::receiveOnly( uint8_t *recv, const uint32_t recv_len)
   */
 void H747_Spi::receiveByte(uint8_t buffer)
 {
-	receive_buffer[ (receive_head++) & SPI_BUFFER_SIZE_MASK ] = buffer;
-	if(receive_head == receive_tail)
-	{
-		receive_buffer_overrun = true;
-	}
+	receive_ring.push(buffer);
 
 }
 
@@ -825,12 +845,287 @@ void H747_Spi::receiveByte(uint8_t buffer)
   */
 uint16_t  H747_Spi::getDataFromBuffer	(uint8_t buffer[])
 {
-		uint16_t size = 0;
-		while( (receive_tail & SPI_BUFFER_SIZE_MASK) != (receive_head & SPI_BUFFER_SIZE_MASK) )
-		{
-			buffer[size++] = receive_buffer[(receive_tail++) & SPI_BUFFER_SIZE_MASK ];
-		}
-		return size;
+		return static_cast<uint16_t>(receive_ring.popBulk(buffer, SPI_BUFFER_SIZE));
+}
+
+/**
+  * @brief 		A static function that checks whether a buffer can be accessed by DMA1/2
+  *
+  * @param[in]  const void *buffer : nullptr is accepted, the dummy bytes are used instead
+  *
+  * @return 	bool	false : buffer is in the DTCM
+  */
+static bool isDmaReachable(const void *buffer)
+{
+	const uintptr_t address = reinterpret_cast<uintptr_t>(buffer);
+
+	return (address < D1_DTCMRAM_BASE) || (address >= (D1_DTCMRAM_BASE + 0x20000));
+}
+
+/**
+  * @brief 		A static function that fills the byte wide DMA configuration of one direction
+  *
+  * @param[in]  DMA_HandleTypeDef &handle
+  * @param[in]  DMA_Stream_TypeDef *stream
+  * @param[in]  uint32_t request
+  * @param[in]  uint32_t direction : DMA_PERIPH_TO_MEMORY or DMA_MEMORY_TO_PERIPH
+  *
+  * @return 	HAL_StatusTypeDef
+  */
+static HAL_StatusTypeDef initDmaHandle(DMA_HandleTypeDef &handle, DMA_Stream_TypeDef *stream, uint32_t request, uint32_t direction)
+{
+	handle.Instance					= stream;
+	handle.Init.Request				= request;
+	handle.Init.Direction			= direction;
+	handle.Init.PeriphInc			= DMA_PINC_DISABLE;
+	handle.Init.MemInc				= DMA_MINC_ENABLE;
+	handle.Init.PeriphDataAlignment	= DMA_PDATAALIGN_BYTE;
+	handle.Init.MemDataAlignment	= DMA_MDATAALIGN_BYTE;
+	handle.Init.Mode				= DMA_NORMAL;
+	handle.Init.Priority			= DMA_PRIORITY_HIGH;
+	handle.Init.FIFOMode			= DMA_FIFOMODE_DISABLE;
+
+	return HAL_DMA_Init(&handle);
+}
+
+/**
+  * @brief 		A static function that points the memory side of a stopped stream to a buffer,
+  *				or to a dummy byte which is not incremented
+  *
+  * @param[in]  DMA_HandleTypeDef &handle
+  * @param[in]  bool increment : false for the dummy byte
+  *
+  * @return 	void	Nothing
+  */
+static void setMemoryIncrement(DMA_HandleTypeDef &handle, bool increment)
+{
+	DMA_Stream_TypeDef *stream = static_cast<DMA_Stream_TypeDef *>(handle.Instance);
+
+	MODIFY_REG(stream->CR, DMA_SxCR_MINC, (increment == true) ? DMA_SxCR_MINC : 0U);
+}
+
+/**
+  * @brief 		A function that moves the port to the DMA transaction queue. The blocking
+  *				transmitReceive stays usable while the queue is empty.
+  *
+  * @param[in]  DMA_Stream_TypeDef *rx_stream	: Free DMA1 or DMA2 stream
+  * @param[in]  uint32_t rx_request			: DMAMUX request of the receiver, e.g. DMA_REQUEST_SPI2_RX
+  * @param[in]  DMA_Stream_TypeDef *tx_stream	: Free DMA1 or DMA2 stream
+  * @param[in]  uint32_t tx_request			: DMAMUX request of the transmitter, e.g. DMA_REQUEST_SPI2_TX
+  *
+  * @return 	bool	true  : success
+  * 					false : the DMA can not be initialized
+  *
+  * Example:
+  * @code
+  * spi_2.enableDma(DMA1_Stream3, DMA_REQUEST_SPI2_RX, DMA1_Stream4, DMA_REQUEST_SPI2_TX);
+  * @endcode
+  */
+bool H747_Spi::enableDma(DMA_Stream_TypeDef *rx_stream, uint32_t rx_request, DMA_Stream_TypeDef *tx_stream, uint32_t tx_request)
+{
+	uint8_t *dummy = reinterpret_cast<uint8_t *>(SPI_DMA_DUMMY_ADDR);
+
+	if (spi_handle_ptr == nullptr || rx_stream == nullptr || tx_stream == nullptr)
+	{
+		return false;
+	}
+
+	__HAL_RCC_DMA1_CLK_ENABLE();
+	__HAL_RCC_DMA2_CLK_ENABLE();
+
+	if ((initDmaHandle(receive_dma_handle, rx_stream, rx_request, DMA_PERIPH_TO_MEMORY) != HAL_OK) ||
+		(initDmaHandle(transmit_dma_handle, tx_stream, tx_request, DMA_MEMORY_TO_PERIPH) != HAL_OK))
+	{
+		return false;
+	}
+
+	__HAL_LINKDMA(spi_handle_ptr, hdmarx, receive_dma_handle);
+	__HAL_LINKDMA(spi_handle_ptr, hdmatx, transmit_dma_handle);
+
+	dummy[0] 	= SPI_DUMMY_BYTE;
+	transaction_queue.reset();
+	dma_active 	= false;
+	dma_enabled = true;
+
+	return true;
+}
+
+/**
+  * @brief 		A function that queues a transaction. The call returns at once, the transaction is
+  *				started as soon as the previous one ends and its callback reports the result.
+  *				Transactions are submitted from one context only, the main loop or the callbacks.
+  *
+  * @param[in]  const spi_transaction_type &transaction : Buffers must stay valid until the callback,
+  *														  a cached receive buffer must cover whole cache lines
+  *
+  * @return 	bool	true  : queued
+  * 					false : DMA disabled, empty transfer, DTCM or unaligned cached buffer or full queue
+  */
+bool H747_Spi::submit(const spi_transaction_type &transaction)
+{
+	if ((dma_enabled == false) || (transaction.size == 0) || (isDmaReachable(transaction.tx_data) == false) ||
+		(isDmaReachable(transaction.rx_data) == false) ||
+		(cache.isReceiveBufferValid(transaction.rx_data, transaction.size) == false) ||
+		(transaction_queue.push(transaction) == false))
+	{
+		transaction_reject_counter++;
+		return false;
+	}
+
+	startDmaTransaction();
+
+	return true;
+}
+
+/**
+  * @brief 		A function that closes the transaction on the bus at EOT or at a bus error, releases
+  *				its chip select, reports it and starts the next one in the same interrupt
+  *
+  * @param[in]  void	Nothing.
+  *
+  * @return 	void	Nothing
+  */
+void H747_Spi::dmaInterruptHandler(void)
+{
+	const uint32_t trigger 	= spi_handle_ptr->Instance->IER & spi_handle_ptr->Instance->SR;
+	uint8_t 	   drain 	= SPI_DMA_DRAIN_LIMIT;
+	bool 		   success 	= true;
+
+	if ((dma_active == false) || ((trigger & (SPI_FLAG_EOT | SPI_FLAG_OVR | SPI_FLAG_UDR | SPI_FLAG_MODF | SPI_FLAG_FRE)) == 0U))
+	{
+		return;
+	}
+
+	/* EOT is set when the last byte is in the RX FIFO, the DMA may still be reading it */
+	while ((__HAL_DMA_GET_COUNTER(&receive_dma_handle) != 0U) && (drain != 0U))
+	{
+		drain--;
+	}
+
+	/* Call SPI Standard close procedure, it collects the error flags */
+	transactionDisable(spi_handle_ptr);
+	CLEAR_BIT(spi_handle_ptr->Instance->CFG1, SPI_CFG1_TXDMAEN | SPI_CFG1_RXDMAEN);
+	HAL_DMA_Abort(&receive_dma_handle);
+	HAL_DMA_Abort(&transmit_dma_handle);
+	cache.invalidateRange(active_transaction.rx_data, active_transaction.size);
+
+	if ((spi_handle_ptr->ErrorCode != HAL_SPI_ERROR_NONE) || (drain == 0U))
+	{
+		transaction_error_counter++;
+		success = false;
+	}
+
+	setChipSelect(active_transaction, false);
+	transaction_queue.consume(1);
+	spi_state  = spi_state_type::SPI_STATE_READY;
+	dma_active = false;
+
+	if (active_transaction.complete != nullptr)
+	{
+		active_transaction.complete(active_transaction.context, success);
+	}
+
+	startDmaTransaction();
+}
+
+/**
+  * @brief 		A function that gives the number of queued transactions, including the running one
+  *
+  * @param[in]  void	Nothing.
+  *
+  * @return 	uint32_t
+  */
+uint32_t H747_Spi::getPendingTransactions(void) const
+{
+	return transaction_queue.getSize();
+}
+
+/**
+  * @brief 		A function that gives the HAL handle of the port
+  *
+  * @param[in]  void	Nothing.
+  *
+  * @return 	SPI_HandleTypeDef*
+  */
+SPI_HandleTypeDef* H747_Spi::getHandle(void) const
+{
+	return spi_handle_ptr;
+}
+
+/**
+  * @brief 		A private function that puts the oldest queued transaction on the bus if the port is idle.
+  *				The sequence follows the reference manual: TSIZE and RXDMAEN, both streams, TXDMAEN,
+  *				then SPE and CSTART.
+  *
+  * @param[in]  void	Nothing.
+  *
+  * @return 	void	Nothing
+  */
+void H747_Spi::startDmaTransaction(void)
+{
+	Tools::ring_span_type<spi_transaction_type> span;
+	SPI_TypeDef *spi   = spi_handle_ptr->Instance;
+	uint8_t 	*dummy = reinterpret_cast<uint8_t *>(SPI_DMA_DUMMY_ADDR);
+
+	if ((dma_active == true) || (spi_state != spi_state_type::SPI_STATE_READY) || (transaction_queue.peek(span) == 0U))
+	{
+		return;
+	}
+
+	dma_active 					= true;
+	active_transaction 			= span[0];
+	spi_state 					= spi_state_type::SPI_STATE_BUSY_TX_RX;
+	spi_handle_ptr->ErrorCode 	= HAL_SPI_ERROR_NONE;
+
+	setChipSelect(active_transaction, true);
+
+	/* The streams of the last transaction are already stopped, this resets their flags and state */
+	HAL_DMA_Abort(&receive_dma_handle);
+	HAL_DMA_Abort(&transmit_dma_handle);
+	setMemoryIncrement(receive_dma_handle, active_transaction.rx_data != nullptr);
+	setMemoryIncrement(transmit_dma_handle, active_transaction.tx_data != nullptr);
+	cache.cleanRange(active_transaction.tx_data, active_transaction.size);
+	cache.invalidateRange(active_transaction.rx_data, active_transaction.size);
+
+	MODIFY_REG(spi->CR2, SPI_CR2_TSIZE, (uint32_t) active_transaction.size);
+	SET_BIT(spi->CFG1, SPI_CFG1_RXDMAEN);
+
+	HAL_DMA_Start(&receive_dma_handle, static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&spi->RXDR)),
+				  static_cast<uint32_t>((active_transaction.rx_data != nullptr) ? reinterpret_cast<uintptr_t>(active_transaction.rx_data) : reinterpret_cast<uintptr_t>(&dummy[4])),
+				  active_transaction.size);
+	HAL_DMA_Start(&transmit_dma_handle,
+				  static_cast<uint32_t>((active_transaction.tx_data != nullptr) ? reinterpret_cast<uintptr_t>(active_transaction.tx_data) : reinterpret_cast<uintptr_t>(&dummy[0])),
+				  static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&spi->TXDR)), active_transaction.size);
+
+	SET_BIT(spi->CFG1, SPI_CFG1_TXDMAEN);
+
+	/* Enable EOT, UDR, OVR, FRE and MODF interrupts, the data itself needs no interrupt */
+	__HAL_SPI_ENABLE_IT(spi_handle_ptr, (SPI_IT_EOT | SPI_IT_UDR | SPI_IT_OVR | SPI_IT_FRE | SPI_IT_MODF));
+	__HAL_SPI_ENABLE(spi_handle_ptr);
+
+	/*  Master start the transaction*/
+	SET_BIT(spi->CR1, SPI_CR1_CSTART);
+}
+
+/**
+  * @brief 		A private function that drives the software chip select of a transaction
+  *
+  * @param[in]  const spi_transaction_type &transaction : nullptr port selects the chip select of the driver
+  * @param[in]  bool selected : true pulls the line low
+  *
+  * @return 	void	Nothing
+  */
+void H747_Spi::setChipSelect(const spi_transaction_type &transaction, bool selected) const
+{
+	GPIO_TypeDef *port = (transaction.cs_port != nullptr) ? transaction.cs_port : spi_cs_port;
+	uint32_t 	  pin  = (transaction.cs_port != nullptr) ? transaction.cs_pin  : spi_cs_pin;
+
+	if ((spi_handle_ptr->Init.NSS != SPI_NSS_SOFT) || (port == nullptr))
+	{
+		return;
+	}
+
+	port->BSRR = (selected == true) ? (pin << 16) : pin;
 }
 
 
@@ -32,6 +32,7 @@
 #include <stdint.h>
 #include <ds_spi.hpp>
 #include "spi.h"
+#include "ds_ring_buffer.hpp"
 
 
 
@@ -49,6 +50,12 @@ namespace Spi  // if spi library must be changed , it prevents us to change the
 
 //#define SPI_BUFFER_ENABLED
 
+const uint32_t SPI_MAXIMUM_TRANSFER_SIZE	= 0xFFFF;		///< TSIZE and the DMA NDTR are 16 bit
+const uint8_t  SPI_TRANSACTION_QUEUE_SIZE	= 8;			///< Must be a power of two
+const uint32_t SPI_DMA_DUMMY_ADDR			= 0x2407FFF8;	///< Last words of the AXI SRAM: dummy transmit byte and discarded receive byte
+const uint8_t  SPI_DUMMY_BYTE				= 0xFF;
+const uint8_t  SPI_DMA_DRAIN_LIMIT			= 64;			///< Polls for the last bytes of the receive DMA after EOT
+
  //End of Macro and Literals Definitions
 
 
@@ -111,6 +118,20 @@ enum class spi_speed_type : uint8_t {
      SPEED_LOW,
  };
 
+/**
+ * @brief One queued DMA transaction, the chip select is held low for the whole transfer
+ */
+struct spi_transaction_type
+{
+	GPIO_TypeDef	*cs_port;		///< nullptr selects the chip select of the driver
+	uint32_t		 cs_pin;
+	const uint8_t	*tx_data;		///< nullptr clocks out SPI_DUMMY_BYTE
+	uint8_t			*rx_data;		///< nullptr discards the received bytes
+	uint16_t		 size;
+	void			(*complete)(void *context, bool success);	///< Called from the SPI interrupt, may be nullptr
+	void			*context;
+};
+
 
 // End of Enum, Union and Struct Definitions
 /*
@@ -137,16 +158,25 @@ public:
 	bool 					      transactionEndProcedure		(SPI_HandleTypeDef *hspi);
 	void 					      transactionErrorHandler	    (SPI_HandleTypeDef *hspi);
 
+	bool						  enableDma					(DMA_Stream_TypeDef *rx_stream, uint32_t rx_request,
+															 DMA_Stream_TypeDef *tx_stream, uint32_t tx_request);
+	bool						  submit					(const spi_transaction_type &transaction);
+	void						  dmaInterruptHandler		(void);
+	uint32_t					  getPendingTransactions	(void) const;
+	SPI_HandleTypeDef*			  getHandle					(void) const;
+
 
 	spi_state_type        spi_state;
 	uint8_t 			        spi_error_flag;
 	uint8_t				        spi_timeout_error;
 	const uint8_t          *tx_data_ptr;
-	uint8_t 			        trans_size;
-	uint8_t 			        trans_count;
-	uint8_t 			        receiv_size;
-	uint8_t 			        receiv_count;
+	uint32_t 			        trans_size;
+	uint32_t 			        trans_count;
+	uint32_t 			        receiv_size;
+	uint32_t 			        receiv_count;
 	spi_transaction_size_type	spi_trans_size;
+	uint32_t					transaction_reject_counter = 0;	///< submit calls refused: no DMA, bad size, DTCM or unaligned cached buffer or full queue
+	uint32_t					transaction_error_counter  = 0;	///< DMA transactions completed with a bus error
 
 
 
@@ -169,12 +199,19 @@ private:
 
 
 
-	const static uint16_t 					SPI_BUFFER_SIZE 								= 255;
-	const static uint16_t 					SPI_BUFFER_SIZE_MASK 						= SPI_BUFFER_SIZE -1;
-    					 uint8_t  					receive_buffer[SPI_BUFFER_SIZE] = {0};
-    					 uint16_t           receive_head 		  							= 0;
-    					 uint16_t           receive_tail 		  							= 0;
-    					 bool	              receive_buffer_overrun 	  	    = false;
+	const static uint16_t 					SPI_BUFFER_SIZE 								= 256;	///< Must be a power of two
+	Tools::RING_BUFFER<uint8_t, SPI_BUFFER_SIZE>	receive_ring;
+
+				/* DMA transaction queue, filled by submit and drained by the EOT interrupt */
+	void 			startDmaTransaction			(void);
+	void 			setChipSelect				(const spi_transaction_type &transaction, bool selected) const;
+
+	DMA_HandleTypeDef		receive_dma_handle		= {};
+	DMA_HandleTypeDef		transmit_dma_handle		= {};
+	bool					dma_enabled				= false;
+	volatile bool			dma_active				= false;
+	spi_transaction_type	active_transaction		= {};	///< Copy of the queue head while it is on the bus
+	Tools::RING_BUFFER<spi_transaction_type, SPI_TRANSACTION_QUEUE_SIZE>	transaction_queue;
 
 
   const static uint8_t	    SPI_TIMEOUT_ERROR_C 			= 20; //ms
@@ -0,0 +1,152 @@
+/**
+ ******************************************************************************
+  * @file		: ds_tasks.cpp
+  * @brief		: Vehicle task set source file
+  *				  This file registers the periodic tasks of the selected vehicle
+  *				  into the scheduler. Budgets are worst case execution times in us.
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+
+/*
+ * Begin of Includes
+ */
+#include "ds_tasks.hpp"
+#include "ds_uart_h747.hpp"
+#include "ds_led_h747.hpp"
+#include "ds_shared_ram_h747.hpp"
+#include "ds_telemetry_core.hpp"
+#include "ds_telemetry_router.hpp"
+#include "ds_telemetry_scheduler.hpp"
+#include "ds_sbus2.hpp"
+#include "ds_serializer.hpp"
+#include "ds_lw20.hpp"
+#include "ds_i2c_h747.hpp"
+#include "ds_can_h747.hpp"
+#include "ds_telemetry_can.hpp"
+// End of Includes
+
+
+
+namespace Tasks
+{
+
+
+
+/*
+ * Begin of Macro Definitions
+ */
+const uint16_t LW20_DATA_READY_THRESHOLD = 64;		///< Longest stream line, notifies even if the line end is lost
+//End of Macro Definitions
+
+
+
+/*
+ * Begin of Object Definitions
+ */
+static SCHEDULER *event_scheduler	 = nullptr;
+static uint8_t	  sbus_event		 = EVENT_ID_NONE;
+static uint8_t	  lw20_event		 = EVENT_ID_NONE;
+static uint8_t	  core_tlm_event	 = EVENT_ID_NONE;
+// End of Object Definitions
+
+
+
+/*
+ * Begin of Task Functions
+ */
+static void ledTask					( void ) { led.scheduler(); }
+static void sbusTask				( void ) { sbus.scheduler(); }
+static void sbusFrameTask			( void ) { sbus.frameHandler(); }
+static void serializerTask			( void ) { serializer.scheduler(); }
+static void lw20Task				( void ) { lw20.scheduler(); }
+static void coreTelemetryParseTask	( void ) { telemetry_core.parseReceivedData(); }
+static void coreTelemetrySendTask	( void ) { telemetry_core.sendPeriodicPacket(); }
+static void uart3RouterTask		( void ) { uart3_router.parseReceivedData(); }
+static void uart3TelemetryTask		( void ) { uart3_telemetry_scheduler.service(); }
+static void i2c4Task				( void ) { i2c4.service(); }
+
+static void can1Task( void )
+{
+	can1.service();
+	can1_transport.parseReceivedData();
+}
+
+static void interCoreTask( void )
+{
+	inter_core.scheduler();
+	if(inter_core.isDataAvailable() == true)	///< Data left behind by a parser call which hit its buffer limit
+	{
+		event_scheduler->signalEvent(core_tlm_event);
+	}
+}
+// End of Task Functions
+
+
+
+/*
+ * Begin of Data Ready Notifications, called from the receive interrupts
+ */
+static void sbusFrameReady			( void ) { event_scheduler->signalEvent(sbus_event); }
+static void lw20DataReady			( void ) { event_scheduler->signalEvent(lw20_event); }
+static void coreTelemetryDataReady	( void ) { event_scheduler->signalEvent(core_tlm_event); }
+// End of Data Ready Notifications
+
+
+
+/**
+  * @brief 		Registers the task set, every vehicle runs the same tasks
+  *
+  * @param[in]  SCHEDULER &scheduler
+  *
+  * @return 	void
+  */
+void registerVehicleTasks( SCHEDULER &scheduler )
+{
+	scheduler.addTask("inter_core",		 interCoreTask,			 100,  20, 6);	///< Heartbeat, the CM4 data is signalled by the HSEM interrupt
+	scheduler.addTask("sbus",			 sbusTask,				 100,  50, 0);
+	scheduler.addTask("serializer",		 serializerTask,		 100, 100, 1);
+	scheduler.addTask("led",			 ledTask,				 100,  10, 2);
+	scheduler.addTask("lw20",			 lw20Task,				  50,  50, 0);
+	scheduler.addTask("core_tlm_send",	 coreTelemetrySendTask,	  10, 200, 0);
+	scheduler.addTask("uart3_router",	 uart3RouterTask,		 100, 200, 3);	///< GCS, INS, mission computer and radar frames
+	scheduler.addTask("uart3_tlm_send",	 uart3TelemetryTask,	 Telemetry::TELEMETRY_SCHEDULER_RATE_HZ, 100, 7);	///< Message streams within the uart3 capacity
+	scheduler.addTask("i2c4",			 i2c4Task,				 100,  20, 4);	///< Batch timeout and error recovery of the I2C job queue
+	scheduler.addTask("can1",			 can1Task,				 100,  50, 5);	///< Bus-off recovery of FDCAN1 and the telemetry flows moved to CAN-FD
+
+	/*
+	 * Parsers run in the tick after their data arrives. The periodic tasks above
+	 * keep the timeouts, the device state machines and the telemetry running.
+	 */
+	event_scheduler = &scheduler;
+	sbus_event		= scheduler.addEventTask("sbus_rx",		   sbusFrameTask,			 50);
+	lw20_event		= scheduler.addEventTask("lw20_rx",		   lw20Task,				 50);
+	core_tlm_event	= scheduler.addEventTask("core_tlm_parse", coreTelemetryParseTask,	200);
+
+	sbus.setFrameNotification(sbusFrameReady);
+	uart2.setDataReadyNotification(lw20DataReady, LW20_DATA_READY_THRESHOLD, '\n');
+	inter_core.setDataReadyNotification(coreTelemetryDataReady);
+}
+
+
+
+} //End of namespace Tasks
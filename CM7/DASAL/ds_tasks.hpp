@@ -0,0 +1,58 @@
+/**
+ ******************************************************************************
+  * @file		: ds_tasks.hpp
+  * @brief		: Vehicle task set header file
+  *				  This file contains the task registration of the vehicle variants
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+#ifndef DS_TASKS_HPP
+#define	DS_TASKS_HPP
+
+
+
+/*
+ * Begin of Includes
+ */
+#include <stdint.h>
+#include "ds_main.hpp"
+// End of Includes
+
+
+
+namespace Tasks
+{
+
+
+
+/*
+ * Begin of Task Set Functions
+ */
+void registerVehicleTasks	( SCHEDULER &scheduler );
+// End of Task Set Functions
+
+
+
+} //End of namespace Tasks
+
+
+
+#endif	/* DS_TASKS_HPP */
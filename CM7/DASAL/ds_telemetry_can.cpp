@@ -0,0 +1,436 @@
+/**
+ ******************************************************************************
+  * @file		: ds_telemetry_can.cpp
+  * @brief		: Telemetry CAN-FD transport source file
+  *				  This file contains the segmenting transport which carries telemetry frames over CAN-FD
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+
+/*
+ * Begin of Includes
+ */
+#include <algorithm>
+#include <cstring>
+#include "ds_telemetry_can.hpp"
+// End of Includes
+
+
+
+/*
+ * Begin of Object Definitions
+ */
+Telemetry::CAN_TRANSPORT can1_transport(&can1, Peripherals::Can::can_fifo_type::FIFO0);	///< INS and mission computer data are flight critical
+//End of Object Definitions
+
+
+
+/**
+  * @brief 		Standard identifier of a flow, lower ids win the arbitration
+  *
+  * @param[in]  uint8_t source_id
+  * @param[in]  uint8_t destination_id
+  *
+  * @return 	uint32_t
+  */
+static inline uint32_t getFlowId(uint8_t source_id, uint8_t destination_id)
+{
+	return Telemetry::CAN_TELEMETRY_BASE_ID | (static_cast<uint32_t>(source_id) << 3) | destination_id;
+}
+
+
+
+/**
+  * @brief 		Checks the CRC16 which follows the covered bytes of a frame, low byte first
+  *
+  * @param[in]  const uint8_t frame[]
+  * @param[in]  uint16_t size : Covered bytes, ids, size and payload
+  *
+  * @return 	bool
+  */
+static inline bool checkFrameCrc(const uint8_t frame[], uint16_t size)
+{
+	const uint16_t frame_crc = crc16.calculate(frame, size);
+
+	return (frame[size] == static_cast<uint8_t>(frame_crc)) && (frame[size + 1] == static_cast<uint8_t>(frame_crc >> 8));
+}
+
+
+
+namespace Telemetry
+{
+
+
+
+/**
+  * @brief Default constructor
+  *
+  * @param[in]  Peripherals::Can::H747_CAN *can_module	: Node of the endpoints
+  * @param[in]  Peripherals::Can::can_fifo_type fifo	: Receive FIFO which is drained by the transport only
+  *
+  * @return 	void
+  */
+CAN_TRANSPORT::CAN_TRANSPORT(Peripherals::Can::H747_CAN *can_module, Peripherals::Can::can_fifo_type fifo) :
+can_module(can_module),
+fifo(fifo),
+flow_table{},
+flow_number(0),
+transmit_sequence{},
+transmit_buffers{},
+transmit_frame{},
+segment{}
+{ }
+
+
+
+/**
+  * @brief 		Moves an endpoint to CAN-FD. A hardware filter for its source and destination id
+  *				is added, after this its sendPacket and parseReceivedData run the transport.
+  *
+  * @param[in]  TELEMETRY *endpoint
+  *
+  * @return 	bool : false if the table is full, its ids are taken or the filter bank is full
+  *
+  * Example:
+  * @code
+  * can1_transport.registerEndpoint(&ins_telemetry);
+  * @endcode
+  */
+bool CAN_TRANSPORT::registerEndpoint(TELEMETRY *endpoint)
+{
+	can_flow_type *flow  = nullptr;
+	uint8_t		   index = 0;
+
+	if( (endpoint == nullptr) || (flow_number >= CAN_TRANSPORT_MAXIMUM_FLOW_NUMBER) )
+	{
+		return false;
+	}
+
+	for(index = 0; index < flow_number; index++)
+	{
+		if( (flow_table[index].source_id == static_cast<uint8_t>(endpoint->source_id)) &&
+			(flow_table[index].destination_id == static_cast<uint8_t>(endpoint->destination_id)) )
+		{
+			return false;
+		}
+	}
+
+	if(can_module->addFilter(getFlowId(static_cast<uint8_t>(endpoint->source_id), static_cast<uint8_t>(endpoint->destination_id)),
+							 0x7FF, false, fifo) == false)
+	{
+		return false;
+	}
+
+	flow				 = &flow_table[flow_number++];
+	flow->endpoint		 = endpoint;
+	flow->source_id		 = static_cast<uint8_t>(endpoint->source_id);
+	flow->destination_id = static_cast<uint8_t>(endpoint->destination_id);
+	endpoint->can_transport = this;
+
+	return true;
+}
+
+
+
+/**
+  * @brief 		Sends a telemetry frame as a burst of FD segments. The segments of one frame are
+  *				queued at once, a new frame of a flow waits until the previous one is on the bus.
+  *				The segment header and the part of transmit_frame are written straight to the
+  *				message RAM.
+  *
+  * @param[in]	uint8_t  source_id
+  * @param[in]	uint8_t  destination_id
+  * @param[in]	const uint8_t  data[]
+  * @param[in]	uint16_t length
+  *
+  * @return 	bool : false if the frame is dropped
+  */
+bool CAN_TRANSPORT::sendPacket(uint8_t source_id, uint8_t destination_id, const uint8_t data[], uint16_t length)
+{
+	const uint16_t size			 = 4 + length + 2;
+	const uint8_t  segment_number = static_cast<uint8_t>( (size + CAN_SEGMENT_DATA_SIZE - 1) / CAN_SEGMENT_DATA_SIZE );
+	uint16_t	   frame_crc	 = 0;
+	uint16_t	   offset		 = 0;
+	uint8_t		   index		 = 0;
+
+	if( (length > CAN_TRANSPORT_MAXIMUM_PAYLOAD_SIZE) || (source_id >= CAN_TELEMETRY_ID_NUMBER) || (destination_id >= CAN_TELEMETRY_ID_NUMBER) ||
+		(can_module->isTransmitPending(transmit_buffers[source_id][destination_id]) == true) )
+	{
+		transmit_reject_counter++;
+		return false;
+	}
+
+	transmit_frame[0] = source_id;
+	transmit_frame[1] = destination_id;
+	transmit_frame[2] = static_cast<uint8_t>(length % 256);
+	transmit_frame[3] = static_cast<uint8_t>(length / 256);
+	std::memcpy(&transmit_frame[4], data, length);
+	frame_crc = crc16.calculate(transmit_frame, 4 + length);
+	transmit_frame[4 + length] = static_cast<uint8_t>(frame_crc % 256);
+	transmit_frame[5 + length] = static_cast<uint8_t>(frame_crc / 256);
+
+	for(index = 0; index < segment_number; index++)
+	{
+		Peripherals::Can::can_frame_view_type &frame = segment[index];
+		const uint16_t count = std::min(static_cast<uint16_t>(size - offset), static_cast<uint16_t>(CAN_SEGMENT_DATA_SIZE));
+
+		frame.id			  = getFlowId(source_id, destination_id);
+		frame.extended		  = false;
+		frame.fd			  = true;
+		frame.bit_rate_switch = true;
+		frame.prefix_size	  = CAN_SEGMENT_HEADER_SIZE;
+		frame.prefix[0]		  = transmit_sequence[source_id][destination_id];
+		frame.prefix[1]		  = index | ( (index == (segment_number - 1)) ? CAN_SEGMENT_LAST : 0 );
+		frame.data			  = &transmit_frame[offset];
+		frame.data_size		  = static_cast<uint8_t>(count);
+		offset += count;
+	}
+
+	transmit_buffers[source_id][destination_id] = can_module->sendFrames(segment, segment_number);
+	if(transmit_buffers[source_id][destination_id] == 0)
+	{
+		transmit_reject_counter++;
+		return false;
+	}
+	transmit_sequence[source_id][destination_id]++;
+
+	return true;
+}
+
+
+
+/**
+  * @brief 		Returns the frames delivered to the endpoint of a source and destination id
+  *
+  * @param[in]  telemetry_id_type source_id
+  * @param[in]  telemetry_id_type destination_id
+  *
+  * @return 	uint32_t : 0 if no endpoint is registered for them
+  */
+uint32_t CAN_TRANSPORT::getFrameCounter(telemetry_id_type source_id, telemetry_id_type destination_id) const
+{
+	uint8_t index = 0;
+
+	for(index = 0; index < flow_number; index++)
+	{
+		if( (flow_table[index].source_id == static_cast<uint8_t>(source_id)) &&
+			(flow_table[index].destination_id == static_cast<uint8_t>(destination_id)) )
+		{
+			return flow_table[index].frame_counter;
+		}
+	}
+
+	return 0;
+}
+
+
+
+/**
+  * @brief 		Runs the link, the receive task calls parseReceivedData directly
+  *
+  * @param[in]	void
+  *
+  * @return 	void
+  */
+void CAN_TRANSPORT::scheduler(void)
+{
+	parseReceivedData();
+}
+
+
+
+/**
+  * @brief 		Drains the receive FIFO in batches and reassembles the segments of every flow.
+  *				The segments are read in the message RAM and released after they are copied.
+  *
+  * @param[in]	void
+  *
+  * @return 	void
+  */
+void CAN_TRANSPORT::parseReceivedData(void)
+{
+	Peripherals::Can::can_element_type element[CAN_TRANSPORT_DRAIN_SIZE];
+	uint8_t							   count = 0;
+	uint8_t							   index = 0;
+
+	if(flow_number == 0)
+	{
+		return;
+	}
+
+	do
+	{
+		count = can_module->peekFrames(fifo, element, CAN_TRANSPORT_DRAIN_SIZE);
+		for(index = 0; index < count; index++)
+		{
+			receiveSegment(element[index]);
+		}
+		can_module->releaseFrames(fifo, count);
+	} while(count == CAN_TRANSPORT_DRAIN_SIZE);
+}
+
+
+
+/**
+  * @brief 		Copies a segment from the message RAM to its place in the frame of its flow. A
+  *				first segment starts a new frame, a segment with another sequence number or out
+  *				of order drops it.
+  *
+  * @param[in]	const Peripherals::Can::can_element_type &element
+  *
+  * @return 	void
+  */
+void CAN_TRANSPORT::receiveSegment(const Peripherals::Can::can_element_type &element)
+{
+	const uint8_t source_id		 = static_cast<uint8_t>( (element.id >> 3) & 0x07U );
+	const uint8_t destination_id = static_cast<uint8_t>( element.id & 0x07U );
+	uint8_t		  header[CAN_SEGMENT_HEADER_SIZE];
+	uint8_t		  segment_index	 = 0;
+	uint16_t	  offset		 = 0;
+	uint16_t	  count			 = 0;
+	uint8_t		  index			 = 0;
+	can_flow_type *flow			 = nullptr;
+
+	for(index = 0; index < flow_number; index++)
+	{
+		if( (flow_table[index].source_id == source_id) && (flow_table[index].destination_id == destination_id) )
+		{
+			flow = &flow_table[index];
+			break;
+		}
+	}
+	if( (flow == nullptr) || (element.extended == true) || ( (element.id & ~0x3FU) != CAN_TELEMETRY_BASE_ID ) || (element.size <= CAN_SEGMENT_HEADER_SIZE) )
+	{
+		unrouted_counter++;
+		return;
+	}
+	Peripherals::Can::H747_CAN::readPayload(element, 0, header, CAN_SEGMENT_HEADER_SIZE);
+
+	segment_index = header[1] & static_cast<uint8_t>(~CAN_SEGMENT_LAST);
+	if(segment_index == 0)
+	{
+		if( (flow->synchronized == true) && (header[0] != static_cast<uint8_t>(flow->sequence + 1)) )
+		{
+			lost_frame_counter += static_cast<uint8_t>(header[0] - flow->sequence - 1);
+		}
+		if(flow->active == true)
+		{
+			sequence_error_counter++;	///< The previous frame never got its last segment
+		}
+		flow->active		= true;
+		flow->sequence		= header[0];
+		flow->next_segment	= 0;
+		flow->received_size	= 0;
+	}
+
+	if( (flow->active == false) || (header[0] != flow->sequence) || (segment_index != flow->next_segment) )
+	{
+		sequence_error_counter++;
+		flow->active = false;
+		return;
+	}
+
+	offset = static_cast<uint16_t>(segment_index) * CAN_SEGMENT_DATA_SIZE;
+	count  = std::min(static_cast<uint16_t>(element.size - CAN_SEGMENT_HEADER_SIZE), static_cast<uint16_t>(CAN_TRANSPORT_FRAME_SIZE - offset));
+	Peripherals::Can::H747_CAN::readPayload(element, CAN_SEGMENT_HEADER_SIZE, &flow->frame[offset], static_cast<uint8_t>(count));
+	flow->received_size = offset + count;
+	flow->next_segment++;
+
+	if( (header[1] & CAN_SEGMENT_LAST) != 0U )
+	{
+		flow->active	   = false;
+		flow->synchronized = true;
+		completeFrame(*flow);
+	}
+	else if( (offset + count) >= CAN_TRANSPORT_FRAME_SIZE )
+	{
+		length_error_counter++;
+		flow->active = false;
+	}
+}
+
+
+
+/**
+  * @brief 		Checks the size and the CRC of a reassembled frame and gives it to the endpoint
+  *
+  * @param[in]	can_flow_type &flow
+  *
+  * @return 	void
+  */
+void CAN_TRANSPORT::completeFrame(can_flow_type &flow)
+{
+	const uint16_t length = static_cast<uint16_t>(flow.frame[2]) | (static_cast<uint16_t>(flow.frame[3]) << 8);
+
+	/* The last segment can carry DLC padding, only the size field tells where the frame ends */
+	if( (length > CAN_TRANSPORT_MAXIMUM_PAYLOAD_SIZE) || (flow.received_size < (4 + length + 2)) )
+	{
+		length_error_counter++;
+	}
+	else if(checkFrameCrc(flow.frame, 4 + length) == false)
+	{
+		crc_error_counter++;
+	}
+	else
+	{
+		frame_counter++;
+		flow.frame_counter++;
+		flow.endpoint->processPayloadPacket(&flow.frame[4], length);
+	}
+}
+
+
+
+/**
+  * @brief Default copy constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+CAN_TRANSPORT::CAN_TRANSPORT(const CAN_TRANSPORT &orig) :
+can_module(orig.can_module),
+fifo(orig.fifo),
+flow_table{},
+flow_number(0),
+transmit_sequence{},
+transmit_buffers{},
+transmit_frame{},
+segment{}
+{ }
+
+
+
+/**
+  * @brief Default destructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+CAN_TRANSPORT::~CAN_TRANSPORT()
+{
+}
+
+
+
+} /* End of namespace Telemetry */
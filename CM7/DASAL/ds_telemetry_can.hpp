@@ -0,0 +1,152 @@
+/**
+ ******************************************************************************
+  * @file		: ds_telemetry_can.hpp
+  * @brief		: Telemetry CAN-FD transport header file
+  *				  This file contains the segmenting transport which carries telemetry frames over CAN-FD
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+#ifndef DS_TELEMETRY_CAN_HPP
+#define	DS_TELEMETRY_CAN_HPP
+
+
+
+/*
+ * Begin of Includes
+ */
+#include <stdint.h>
+#include "ds_telemetry_gcs.hpp"
+#include "ds_can_h747.hpp"
+// End of Includes
+
+
+
+namespace Telemetry
+{
+
+
+
+/*
+ * Begin of Macro Definitions
+ */
+const uint8_t  CAN_TRANSPORT_MAXIMUM_FLOW_NUMBER	= 4;
+const uint16_t CAN_TRANSPORT_MAXIMUM_PAYLOAD_SIZE	= 512;		///< Same limit as the UART router
+const uint16_t CAN_TRANSPORT_FRAME_SIZE				= 4 + CAN_TRANSPORT_MAXIMUM_PAYLOAD_SIZE + 2;	///< Ids, size, payload and CRC as on the UART, without the header byte
+const uint8_t  CAN_SEGMENT_HEADER_SIZE				= 2;		///< Sequence number, segment index and last segment flag
+const uint8_t  CAN_SEGMENT_DATA_SIZE				= Peripherals::Can::CAN_MAXIMUM_PAYLOAD_SIZE - CAN_SEGMENT_HEADER_SIZE;
+const uint8_t  CAN_MAXIMUM_SEGMENT_NUMBER			= (CAN_TRANSPORT_FRAME_SIZE + CAN_SEGMENT_DATA_SIZE - 1) / CAN_SEGMENT_DATA_SIZE;
+const uint8_t  CAN_SEGMENT_LAST						= 0x80;		///< Set in the segment index byte of the last segment
+const uint32_t CAN_TELEMETRY_BASE_ID				= 0x600;	///< Standard id of a flow: base | source id << 3 | destination id
+const uint8_t  CAN_TELEMETRY_ID_NUMBER				= static_cast<uint8_t>(telemetry_id_type::PDB) + 1;
+const uint8_t  CAN_TRANSPORT_DRAIN_SIZE				= 8;		///< Frames taken from the FIFO with one acknowledge
+//End of Macro Definitions
+
+
+
+/*
+ * Begin of Enum, Union and Struct Definitions
+ */
+/**
+ * @brief Receive side of one flow, the segments are written straight to their place in frame
+ */
+struct can_flow_type
+{
+	TELEMETRY	*endpoint;
+	uint8_t		 source_id;
+	uint8_t		 destination_id;
+	uint8_t		 sequence;					///< Sequence number of the frame being reassembled
+	uint8_t		 next_segment;
+	bool		 active;					///< A first segment arrived and the frame is not complete yet
+	bool		 synchronized;				///< A frame was completed, sequence gaps are counted from now on
+	uint16_t	 received_size;
+	uint32_t	 frame_counter;				///< Frames delivered to the endpoint
+	uint8_t		 frame[CAN_TRANSPORT_FRAME_SIZE];
+};
+// End of Enum, Union and Struct Definitions
+
+
+
+/*
+ * Begin of CAN_TRANSPORT Class Definition
+ */
+/**
+ * @brief Carries the telemetry frames of its endpoints over CAN-FD. A frame is split into
+ *		  64 byte FD segments which start with the sequence number of the flow and the
+ *		  segment index. Every flow has its own identifier and hardware filter, the
+ *		  transport drains one receive FIFO of the node. The segments are copied once, between
+ *		  the message RAM and the frame buffer of the flow. The CRC of the UART frame is kept
+ *		  end to end, so a reassembly error is found like a line error.
+ */
+class CAN_TRANSPORT
+{
+	public:
+		explicit CAN_TRANSPORT(Peripherals::Can::H747_CAN *can_module, Peripherals::Can::can_fifo_type fifo);
+
+		bool	 registerEndpoint	(TELEMETRY *endpoint);
+		bool	 sendPacket			(uint8_t source_id, uint8_t destination_id, const uint8_t data[], uint16_t length);
+		uint32_t getFrameCounter	(telemetry_id_type source_id, telemetry_id_type destination_id) const;
+
+		void scheduler(void);
+		void parseReceivedData(void);
+
+		uint32_t frame_counter			 = 0;
+		uint32_t crc_error_counter		 = 0;
+		uint32_t length_error_counter	 = 0;
+		uint32_t sequence_error_counter	 = 0;	///< Segments out of order, the frame is dropped
+		uint32_t lost_frame_counter		 = 0;	///< Gaps in the sequence numbers of a flow
+		uint32_t unrouted_counter		 = 0;	///< Frames of the FIFO which belong to no flow
+		uint32_t transmit_reject_counter = 0;	///< Frames refused: too long, previous frame of the flow still queued or no room
+
+		CAN_TRANSPORT(const CAN_TRANSPORT &orig);
+		virtual ~CAN_TRANSPORT();
+
+	protected:
+
+	private:
+		Peripherals::Can::H747_CAN	   *can_module;
+		Peripherals::Can::can_fifo_type fifo;
+		can_flow_type	flow_table[CAN_TRANSPORT_MAXIMUM_FLOW_NUMBER];
+		uint8_t			flow_number;
+		uint8_t			transmit_sequence[CAN_TELEMETRY_ID_NUMBER][CAN_TELEMETRY_ID_NUMBER];
+		uint32_t		transmit_buffers[CAN_TELEMETRY_ID_NUMBER][CAN_TELEMETRY_ID_NUMBER];	///< Transmit buffers of the last frame of a flow
+		uint8_t			transmit_frame[CAN_TRANSPORT_FRAME_SIZE];
+		Peripherals::Can::can_frame_view_type segment[CAN_MAXIMUM_SEGMENT_NUMBER];	///< Refer to transmit_frame
+
+		void receiveSegment	(const Peripherals::Can::can_element_type &element);
+		void completeFrame	(can_flow_type &flow);
+};
+// End of CAN_TRANSPORT Class Definition
+
+
+
+} /* End of namespace Telemetry */
+
+
+
+/*
+ * External Linkages
+ */
+extern Telemetry::CAN_TRANSPORT can1_transport;
+// End of External Linkages
+
+
+#endif	/* DS_TELEMETRY_CAN_HPP */
@@ -0,0 +1,306 @@
+/**
+ ******************************************************************************
+  * @file		: ds_telemetry_codec.hpp
+  * @brief		: Telemetry message codec header file
+  *				  This file contains the compile-time message descriptors and the receive codec of the
+  *				  payload format which is shared by the GCS, INS, MC and RADAR endpoints
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+#ifndef DS_TELEMETRY_CODEC_HPP
+#define DS_TELEMETRY_CODEC_HPP
+
+/*
+ * Begin of Includes
+ */
+#include <stdint.h>
+#include <cstring>
+#include <new>
+#include "ds_crc16.hpp"
+// End of Includes
+
+namespace Telemetry
+{
+
+/*
+ * Begin of Macro Definitions
+ */
+const uint8_t HEADER_FOOTER_DIFF = 126;
+const uint8_t PAYLOAD_SIZE_WITHOUT_DATA = 6;	///< PAYLOAD HEADER, VERSION, CHANGING_BYTE, CRC16 and FOOTER
+const uint16_t PAYLOAD_MAX_SIZE = 512;			///< Largest payload a telemetry parser accepts
+const uint16_t MESSAGE_HEADER_COUNT = 256;
+//End of Macro Definitions
+
+/*
+ * Begin of Enum, Union and Struct Definitions
+ */
+enum class message_direction_type : uint8_t
+{
+	RECEIVE = 0,
+	TRANSMIT = 1,
+};
+
+/*
+ * | PAYLOAD HEADER	| VERSION			| CHANGING_BYTE	| DATA		| CRC			| FOOTER		|
+ */
+struct payload_packet_type
+{
+		uint8_t header = 0;
+		uint16_t data_length = 0;
+		uint8_t version = 0;
+		uint8_t changing_byte = 0;
+		const uint8_t *data = nullptr;	///< Points into the received payload, valid during processReceivedPacket only
+		uint8_t footer = 0;
+};
+
+/**
+ * @brief Everything the codec needs to know about one message, declared once per message.
+ *		  message_type is the packed union of the message with its data struct and buffer.
+ *		  RATE_HZ is the nominal transmit rate, 0 for messages which are sent on request.
+ */
+template <uint8_t HEADER_ID, uint8_t VERSION_ID, typename message_type, uint16_t RATE, message_direction_type DIRECTION_ID>
+struct message_descriptor_type
+{
+		typedef message_type type;
+
+		static const uint8_t HEADER = HEADER_ID;
+		static const uint8_t VERSION = VERSION_ID;
+		static const uint8_t FOOTER = static_cast<uint8_t>(HEADER_ID + HEADER_FOOTER_DIFF);
+		static const uint16_t SIZE = sizeof(message_type::buffer);
+		static const uint16_t PAYLOAD_SIZE = SIZE + PAYLOAD_SIZE_WITHOUT_DATA;
+		static const uint16_t RATE_HZ = RATE;
+		static const message_direction_type DIRECTION = DIRECTION_ID;
+
+		static_assert(sizeof(message_type::data) <= SIZE, "Message struct does not fit into its buffer");
+		static_assert(PAYLOAD_SIZE <= PAYLOAD_MAX_SIZE, "Message does not fit into a telemetry payload");
+
+		/**
+		 * @brief 		Writes the complete payload, the CRC covers VERSION to DATA
+		 */
+		static void encode(message_type const &message, uint8_t changing_byte, uint8_t payload[])
+		{
+			std::memcpy(beginPayload(payload).buffer, message.buffer, SIZE);
+			finishPayload(changing_byte, payload);
+		}
+
+		/**
+		 * @brief 		Constructs a cleared message at the DATA position of the payload, so that the
+		 *				caller serializes it once straight into the wire buffer
+		 */
+		static message_type &beginPayload(uint8_t payload[])
+		{
+			return *new (&payload[3]) message_type();	///< Packed union, any address is aligned
+		}
+
+		/**
+		 * @brief 		Writes the fields around the DATA which is already in place
+		 */
+		static void finishPayload(uint8_t changing_byte, uint8_t payload[])
+		{
+			uint16_t crc = 0;
+
+			payload[0] = HEADER;
+			payload[1] = VERSION;
+			payload[2] = changing_byte;
+
+			crc = crc16.calculate(&payload[1], SIZE + 2);
+			payload[SIZE + 3] = static_cast<uint8_t>(crc);
+			payload[SIZE + 4] = static_cast<uint8_t>(crc >> 8);
+			payload[SIZE + 5] = FOOTER;
+		}
+
+		/**
+		 * @brief 		Copies a validated payload into the message. A payload of another VERSION
+		 *				is rejected, its DATA has another layout and the struct would be filled
+		 *				with wrong fields. The old process handlers accepted any version, so
+		 *				both ends of a link must now be built with the same message definitions.
+		 *
+		 * @return 		bool : false if the version or the size does not match
+		 */
+		static bool decode(payload_packet_type const &payload_packet, message_type &message)
+		{
+			if ((payload_packet.version != VERSION) || (payload_packet.data_length != SIZE))
+			{
+				return false;
+			}
+
+			std::memcpy(message.buffer, payload_packet.data, SIZE);
+			return true;
+		}
+};
+
+/**
+ * @brief Last received message of one descriptor
+ */
+template <typename descriptor_type>
+struct message_slot_type
+{
+		typename descriptor_type::type message;
+		uint32_t receive_counter = 0;
+};
+
+/**
+ * @brief Next message of one transmit descriptor
+ */
+template <typename descriptor_type>
+struct transmit_slot_type
+{
+		typename descriptor_type::type message;
+};
+
+template <typename owner_type, uint8_t COUNT>
+struct message_dispatch_table_type
+{
+		uint8_t index[MESSAGE_HEADER_COUNT];						///< Decoder number + 1 of every header, 0 for unknown headers
+		bool (*decoder[COUNT])(owner_type &owner, payload_packet_type const &payload_packet);
+};
+// End of Enum, Union and Struct Definitions
+
+/*
+ * Begin of MESSAGE_CODEC Class Definition
+ */
+/**
+ * @brief Decodes the received messages of one endpoint. The header to decoder table is built by
+ *		  the compiler from the descriptor list, so dispatch is one table lookup whatever the
+ *		  number of messages. Every message is kept in its own slot until the next one arrives.
+ */
+template <typename... descriptor_types>
+class MESSAGE_CODEC: private message_slot_type<descriptor_types>...
+{
+		static_assert(sizeof...(descriptor_types) < MESSAGE_HEADER_COUNT, "Too many messages for one codec");
+
+	public:
+		uint32_t decode_error_counter = 0;	///< Unknown header, wrong version or wrong size
+
+		/**
+		 * @brief 		Decodes a validated payload into the slot of its header
+		 *
+		 * @return 		bool : false if the payload is not a known message
+		 */
+		bool decode(payload_packet_type const &payload_packet)
+		{
+			static_assert(hasUniqueHeaders(), "Two receive messages share a header");
+
+			const uint8_t index = DISPATCH_TABLE.index[payload_packet.header];
+
+			if ((index == 0) || (DISPATCH_TABLE.decoder[index - 1](*this, payload_packet) == false))
+			{
+				decode_error_counter++;
+				return false;
+			}
+
+			return true;
+		}
+
+		template <typename descriptor_type>
+		typename descriptor_type::type const &getMessage(void) const
+		{
+			return static_cast<message_slot_type<descriptor_type> const &>(*this).message;
+		}
+
+		template <typename descriptor_type>
+		uint32_t getReceiveCounter(void) const
+		{
+			return static_cast<message_slot_type<descriptor_type> const &>(*this).receive_counter;
+		}
+
+	private:
+		typedef message_dispatch_table_type<MESSAGE_CODEC, sizeof...(descriptor_types)> dispatch_table_type;
+
+		template <typename descriptor_type>
+		static bool decodeMessage(MESSAGE_CODEC &codec, payload_packet_type const &payload_packet)
+		{
+			static_assert(descriptor_type::DIRECTION == message_direction_type::RECEIVE, "Only receive messages are decoded");
+
+			message_slot_type<descriptor_type> &slot = static_cast<message_slot_type<descriptor_type> &>(codec);
+
+			if (descriptor_type::decode(payload_packet, slot.message) == false)
+			{
+				return false;
+			}
+
+			slot.receive_counter++;
+			return true;
+		}
+
+		static constexpr dispatch_table_type makeDispatchTable(void)
+		{
+			const uint8_t headers[] = { descriptor_types::HEADER... };
+			dispatch_table_type table = { { 0 }, { &decodeMessage<descriptor_types>... } };
+
+			for (uint16_t number = 0; number < sizeof...(descriptor_types); number++)
+			{
+				table.index[headers[number]] = static_cast<uint8_t>(number + 1);
+			}
+
+			return table;
+		}
+
+		static constexpr bool hasUniqueHeaders(void)
+		{
+			const uint8_t headers[] = { descriptor_types::HEADER... };
+
+			for (uint16_t number = 0; number < sizeof...(descriptor_types); number++)
+			{
+				for (uint16_t other = number + 1; other < sizeof...(descriptor_types); other++)
+				{
+					if (headers[number] == headers[other])
+					{
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+
+		static const dispatch_table_type DISPATCH_TABLE;	///< Built by the compiler, placed in the flash
+};
+
+template <typename... descriptor_types>
+constexpr typename MESSAGE_CODEC<descriptor_types...>::dispatch_table_type MESSAGE_CODEC<descriptor_types...>::DISPATCH_TABLE =
+		MESSAGE_CODEC<descriptor_types...>::makeDispatchTable();
+// End of MESSAGE_CODEC Class Definition
+
+/*
+ * Begin of MESSAGE_STORE Class Definition
+ */
+/**
+ * @brief Keeps the content of the transmit messages of one endpoint, the application updates
+ *		  them and the telemetry scheduler sends them at the rate of their stream
+ */
+template <typename... descriptor_types>
+class MESSAGE_STORE: private transmit_slot_type<descriptor_types>...
+{
+	public:
+		template <typename descriptor_type>
+		typename descriptor_type::type &getMessage(void)
+		{
+			static_assert(descriptor_type::DIRECTION == message_direction_type::TRANSMIT, "Only transmit messages are stored");
+
+			return static_cast<transmit_slot_type<descriptor_type> &>(*this).message;
+		}
+};
+// End of MESSAGE_STORE Class Definition
+
+} /* End of namespace Telemetry */
+
+#endif /* DS_TELEMETRY_CODEC_HPP */
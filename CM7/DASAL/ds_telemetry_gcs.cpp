@@ -27,15 +27,13 @@
 #include <ds_telemetry_gcs.hpp>
 #include <cstring>
 #include "ds_telemetry_core.hpp"
+#include "ds_telemetry_router.hpp"
+#include "ds_telemetry_can.hpp"
+#include "ds_telemetry_scheduler.hpp"
+#include "ds_crc16.hpp"
 
 Telemetry::GCS_TELEMETRY gcs_telemetry(&uart3, Telemetry::telemetry_id_type::GCS, Telemetry::telemetry_id_type::FLIGHT_CONTROLLER);
 
-/*
- * Begin of Local Constant Definitions
- */
-const uint8_t TELEMETRY_HEADER = 0xFA;
-// End of Local Constant Definitions
-
 /*
  * Begin of Enum, Union and Struct Definitions
  */
@@ -98,42 +96,52 @@ void TELEMETRY::processPayloadPacket(const uint8_t payload[], uint16_t payload_l
 	uint16_t index = 0;
 
 	payload_state_type state = payload_state_type::PAYLOAD_HEADER;
-	uint8_t crc_data[512] = { 0 };
-	uint16_t crc_counter = 0;
+	uint16_t crc = Tools::CRC16_INIT;	///< Folded in while the bytes are parsed, covers VERSION to DATA
+	uint8_t crc_low = 0;
 	uint16_t data_counter = 0;
+	uint16_t run = 0;
 	payload_packet_type payload_packet;
 
 	/*
 	 * | PAYLOAD HEADER	| VERSION			| CHANGING_BYTE	| DATA		| CRC			| FOOTER		|
 	 */
 
+	if (payload_length < PAYLOAD_SIZE_WITHOUT_DATA)
+	{
+		payload_error_counter++;
+		return;
+	}
+
 	for (index = 0; index < payload_length; index++)
 	{
 		switch (state)
 		{
 			case payload_state_type::PAYLOAD_HEADER:
 				payload_packet.header = payload[index];
-				payload_packet.data_length = payload_length - 6;
+				payload_packet.data_length = payload_length - PAYLOAD_SIZE_WITHOUT_DATA;
 				data_counter = 0;
-				crc_counter = 0;
+				crc = Tools::CRC16_INIT;
 				state = payload_state_type::VERSION;
 				break;
 
 			case payload_state_type::VERSION:
 				payload_packet.version = payload[index];
-				crc_data[crc_counter++] = payload[index];
+				crc = Tools::CRC16::update(crc, payload[index]);
 				state = payload_state_type::CHANGING_BYTE;
 				break;
 
 			case payload_state_type::CHANGING_BYTE:
 				payload_packet.changing_byte = payload[index];
-				crc_data[crc_counter++] = payload[index];
-				state = payload_state_type::DATA;
+				crc = Tools::CRC16::update(crc, payload[index]);
+				payload_packet.data = &payload[index + 1];
+				state = (payload_packet.data_length > 0) ? payload_state_type::DATA : payload_state_type::CRC_1;
 				break;
 
 			case payload_state_type::DATA:
-				payload_packet.data[data_counter++] = payload[index];
-				crc_data[crc_counter++] = payload[index];
+				run = ((payload_packet.data_length - data_counter) < (payload_length - index)) ? (payload_packet.data_length - data_counter) : (payload_length - index);	///< Rest of the field which is in this buffer
+				crc = crc16.calculate(&payload[index], run, crc);	///< The data stays in place, the codec copies it into the message
+				data_counter += run;
+				index += run - 1;
 				if (data_counter >= payload_packet.data_length)
 				{
 					state = payload_state_type::CRC_1;
@@ -141,13 +149,12 @@ void TELEMETRY::processPayloadPacket(const uint8_t payload[], uint16_t payload_l
 				break;
 
 			case payload_state_type::CRC_1:
-				crc_data[crc_counter] = payload[index];
+				crc_low = payload[index];
 				state = payload_state_type::CRC_2;
 				break;
 
 			case payload_state_type::CRC_2:
-				crc_data[crc_counter + 1] = payload[index];
-				if (checkCrc16(crc_data, crc_counter) == true)
+				if (checkCrc16(crc, crc_low, payload[index]) == true)
 				{
 					state = payload_state_type::FOOTER;
 				}
@@ -180,7 +187,7 @@ void TELEMETRY::scheduler(void)
 }
 
 /**
- * @brief 			Parse and process incoming data
+ * @brief 			Parse and process incoming data, on a shared link the router or the CAN-FD transport parses it for every endpoint
  *
  * @param[in]	void
  *
@@ -191,12 +198,13 @@ void TELEMETRY::parseReceivedData(void)
 	uint8_t buffer[512] = { 0 };
 	uint16_t size = 0;
 	uint16_t index = 0;
+	uint16_t run = 0;
 
 	static parser_state_type state = parser_state_type::HEADER;
-	static uint8_t payload[512] = { 0 };
+	static uint8_t payload[PAYLOAD_MAX_SIZE] = { 0 };
 	static uint16_t payload_counter = 0;
-	static uint8_t crc_data[512] = { 0 };
-	static uint16_t crc_counter = 0;
+	static uint16_t crc = Tools::CRC16_INIT;	///< Folded in while the bytes arrive, covers SOURCE_ID to PAYLOAD
+	static uint8_t crc_low = 0;
 	static uint16_t length = 0;
 
 	/*
@@ -204,6 +212,18 @@ void TELEMETRY::parseReceivedData(void)
 	 * | 0xFA        | 0x00-0x05    | 0x00-0x05 			| -- 						| -- 					|	--		|
 	 */
 
+	if (can_transport != nullptr)
+	{
+		can_transport->parseReceivedData();
+		return;
+	}
+
+	if (router != nullptr)
+	{
+		router->parseReceivedData();
+		return;
+	}
+
 	size = uart_module->getDataFromBuffer(buffer, sizeof(buffer));
 
 	for (index = 0; index < size; index++)
@@ -215,7 +235,7 @@ void TELEMETRY::parseReceivedData(void)
 				{
 					length = 0;
 					payload_counter = 0;
-					crc_counter = 0;
+					crc = Tools::CRC16_INIT;
 					state = parser_state_type::SOURCE_ID;
 				}
 				break;
@@ -223,7 +243,7 @@ void TELEMETRY::parseReceivedData(void)
 			case parser_state_type::SOURCE_ID:
 				if (buffer[index] == static_cast<uint8_t>(source_id))
 				{
-					crc_data[crc_counter++] = buffer[index];
+					crc = Tools::CRC16::update(crc, buffer[index]);
 					state = parser_state_type::DESTINATION_ID;
 				}
 				else
@@ -235,7 +255,7 @@ void TELEMETRY::parseReceivedData(void)
 			case parser_state_type::DESTINATION_ID:
 				if (buffer[index] == static_cast<uint8_t>(destination_id))
 				{
-					crc_data[crc_counter++] = buffer[index];
+					crc = Tools::CRC16::update(crc, buffer[index]);
 					state = parser_state_type::PAYLOAD_SIZE_1;
 				}
 				else
@@ -246,19 +266,30 @@ void TELEMETRY::parseReceivedData(void)
 
 			case parser_state_type::PAYLOAD_SIZE_1:
 				length = (static_cast<uint16_t>(buffer[index]));
-				crc_data[crc_counter++] = buffer[index];
+				crc = Tools::CRC16::update(crc, buffer[index]);
 				state = parser_state_type::PAYLOAD_SIZE_2;
 				break;
 
 			case parser_state_type::PAYLOAD_SIZE_2:
 				length += (static_cast<uint16_t>(buffer[index]) << 8);
-				crc_data[crc_counter++] = buffer[index];
-				state = parser_state_type::PAYLOAD;
+				crc = Tools::CRC16::update(crc, buffer[index]);
+				if (length > sizeof(payload))
+				{
+					parse_error_counter++;
+					state = parser_state_type::HEADER;
+				}
+				else
+				{
+					state = (length > 0) ? parser_state_type::PAYLOAD : parser_state_type::CRC_1;
+				}
 				break;
 
 			case parser_state_type::PAYLOAD:
-				payload[payload_counter++] = buffer[index];
-				crc_data[crc_counter++] = buffer[index];
+				run = ((length - payload_counter) < (size - index)) ? (length - payload_counter) : (size - index);	///< Rest of the field which is in this buffer
+				std::memcpy(&payload[payload_counter], &buffer[index], run);
+				crc = crc16.calculate(&buffer[index], run, crc);
+				payload_counter += run;
+				index += run - 1;
 				if (payload_counter >= length)
 				{
 					state = parser_state_type::CRC_1;
@@ -266,13 +297,12 @@ void TELEMETRY::parseReceivedData(void)
 				break;
 
 			case parser_state_type::CRC_1:
-				crc_data[crc_counter] = buffer[index];
+				crc_low = buffer[index];
 				state = parser_state_type::CRC_2;
 				break;
 
 			case parser_state_type::CRC_2:
-				crc_data[crc_counter + 1] = buffer[index];
-				if (checkCrc16(crc_data, crc_counter) == true)
+				if (checkCrc16(crc, crc_low, buffer[index]) == true)
 				{
 					processPayloadPacket(payload, length);
 				}
@@ -291,95 +321,97 @@ void TELEMETRY::parseReceivedData(void)
 }
 
 /**
- * @brief 			Prepare payload message packet
+ * @brief 			Sends a packet over the UART or, when the endpoint is moved there, over CAN-FD
  *
- * @param[in]	uint8_t  src_id
- * @param[in]	uint8_t  dest_id
- * @param[in]	const payload_packet_type  payload_packet
+ * @param[in]	uint8_t  source_id
+ * @param[in]	uint8_t  destination_id
+ * @param[in]	const uint8_t  data[]
+ * @param[in]	uint16_t length
  *
- * @return 		void
+ * @return 		bool : false if the link is saturated and the packet is dropped
  */
-void TELEMETRY::preparePayload(uint8_t src_id, uint8_t dest_id, payload_packet_type const &payload_packet)
+bool TELEMETRY::sendPacket(uint8_t src_id, uint8_t dest_id, const uint8_t data[], uint16_t length)
 {
-	uint8_t buffer[512] = { 0 };
-	uint16_t buffer_index = 0;
-	uint8_t crc_data[512] = { 0 };
-	uint16_t crc_index = 0;
-	uint16_t index = 0;
-	uint16_t crc16 = 0;
-
-	buffer[buffer_index++] = payload_packet.header;
-
-	buffer[buffer_index++] = payload_packet.version;
-	crc_data[crc_index++] = payload_packet.version;
-
-	buffer[buffer_index++] = payload_packet.changing_byte;
-	crc_data[crc_index++] = payload_packet.changing_byte;
+	if (can_transport != nullptr)
+	{
+		return can_transport->sendPacket(src_id, dest_id, data, length);	///< The frame below is not needed
+	}
 
-	for (index = 0; index < payload_packet.data_length; index++)
+	if (length > PAYLOAD_MAX_SIZE)
 	{
-		buffer[buffer_index++] = payload_packet.data[index];
-		crc_data[crc_index++] = payload_packet.data[index];
+		return false;
 	}
 
-	crc16 = calculateCrc16(crc_data, crc_index);
+	uint8_t stack_frame[PAYLOAD_MAX_SIZE + FRAME_SIZE_WITHOUT_PAYLOAD];
+	uint8_t *frame = beginFrame(stack_frame, length);
+
+	std::memcpy(&frame[FRAME_PAYLOAD_OFFSET], data, length);
+
+	return sendFrame(frame, stack_frame, src_id, dest_id, length);
+}
 
-	buffer[buffer_index++] = static_cast<uint8_t>(crc16 % 256);
-	buffer[buffer_index++] = static_cast<uint8_t>(crc16 / 256);
+/**
+ * @brief 			Gives the buffer which a frame is built in: contiguous space of the UART transmit
+ *					ring, so that nothing is copied afterwards, or stack_frame when the space wraps,
+ *					the link is saturated or the endpoint is on CAN-FD
+ *
+ * @param[in]	uint8_t  stack_frame[] : Room for payload_length + FRAME_SIZE_WITHOUT_PAYLOAD bytes
+ * @param[in]	uint16_t payload_length
+ *
+ * @return 		uint8_t* : The payload is written at FRAME_PAYLOAD_OFFSET
+ */
+uint8_t* TELEMETRY::beginFrame(uint8_t stack_frame[], uint16_t payload_length)
+{
+	uint8_t *frame = nullptr;
 
-	buffer[buffer_index++] = payload_packet.footer;
+	if (can_transport == nullptr)
+	{
+		frame = uart_module->reserveTransmit(payload_length + FRAME_SIZE_WITHOUT_PAYLOAD);
+	}
 
-	sendPacket(src_id, dest_id, buffer, buffer_index);
+	return (frame != nullptr) ? frame : stack_frame;
 }
 
 /**
- * @brief 			Sends a packet to the other core
+ * @brief 			Patches the header fields and the CRC16 around the payload which is already in
+ *					place and sends the frame given by beginFrame
  *
+ * @param[in]	uint8_t  frame[]
+ * @param[in]	const uint8_t  stack_frame[]
  * @param[in]	uint8_t  source_id
  * @param[in]	uint8_t  destination_id
- * @param[in]	const uint8_t  data[]
- * @param[in]	uint16_t length
+ * @param[in]	uint16_t payload_length
  *
- * @return 		void
+ * @return 		bool : false if the link is saturated and the packet is dropped
  */
-void TELEMETRY::sendPacket(uint8_t src_id, uint8_t dest_id, const uint8_t data[], uint16_t length)
+bool TELEMETRY::sendFrame(uint8_t frame[], const uint8_t stack_frame[], uint8_t src_id, uint8_t dest_id, uint16_t payload_length)
 {
-	uint16_t buffer_index = 0;
-	uint16_t index = 0;
-	uint8_t buffer[1024] = { 0 };
-	uint8_t crc_data[1024] = { 0 };
-	uint16_t crc_counter = 0;
-	uint16_t crc16 = 0;
+	const uint16_t frame_size = payload_length + FRAME_SIZE_WITHOUT_PAYLOAD;
+	uint16_t frame_crc = 0;
 
-	buffer[buffer_index++] = TELEMETRY_HEADER;
-	buffer[buffer_index++] = src_id;
-	buffer[buffer_index++] = dest_id;
+	if (can_transport != nullptr)
+	{
+		return can_transport->sendPacket(src_id, dest_id, &frame[FRAME_PAYLOAD_OFFSET], payload_length);
+	}
 
-	crc_data[crc_counter++] = src_id;
-	crc_data[crc_counter++] = dest_id;
+	frame[0] = TELEMETRY_HEADER;
+	frame[1] = src_id;
+	frame[2] = dest_id;
+	frame[3] = static_cast<uint8_t>(payload_length % 256);
+	frame[4] = static_cast<uint8_t>(payload_length / 256);
 
-	buffer[buffer_index++] = static_cast<uint8_t>(length % 256);
-	buffer[buffer_index++] = static_cast<uint8_t>(length / 256);
+	frame_crc = calculateCrc16(&frame[1], payload_length + 4);
 
-	crc_data[crc_counter++] = static_cast<uint8_t>(length % 256);
-	crc_data[crc_counter++] = static_cast<uint8_t>(length / 256);
+	frame[FRAME_PAYLOAD_OFFSET + payload_length] = static_cast<uint8_t>(frame_crc % 256);
+	frame[FRAME_PAYLOAD_OFFSET + payload_length + 1] = static_cast<uint8_t>(frame_crc / 256);
 
-	if (length < 1024)
+	if (frame != stack_frame)
 	{
-		for (index = 0; index < length; index++)
-		{
-			buffer[buffer_index++] = data[index];
-			crc_data[crc_counter++] = data[index];
-		}
+		uart_module->commitTransmit(frame_size);	///< Built in the transmit ring, nothing to copy
+		return true;
 	}
 
-	crc16 = calculateCrc16(crc_data, crc_counter);
-
-	buffer[buffer_index++] = static_cast<uint8_t>(crc16 % 256);
-	buffer[buffer_index++] = static_cast<uint8_t>(crc16 / 256);
-
-	uart_module->sendData(buffer, buffer_index);
-
+	return uart_module->sendData(frame, frame_size);
 }
 
 void TELEMETRY::sendPacket(uint16_t command, uint8_t data[], uint16_t length)
@@ -434,7 +466,7 @@ GCS_TELEMETRY::GCS_TELEMETRY(Peripherals::Uart::H747_UART *uart_module, telemetr
 }
 
 /**
- * @brief 			Processes the received packet
+ * @brief 			Decodes the received packet into the message slot of its header
  *
  * @param[in]	const payload_packet_type payload_packet
  *
@@ -442,669 +474,61 @@ GCS_TELEMETRY::GCS_TELEMETRY(Peripherals::Uart::H747_UART *uart_module, telemetr
  */
 void GCS_TELEMETRY::processReceivedPacket(payload_packet_type const &payload_packet)
 {
-	gcs_receive_headers_type gcs_header = static_cast<gcs_receive_headers_type>(payload_packet.header);
-	switch (gcs_header)
-	{
-		case gcs_receive_headers_type::RX_HEARTBEAT:
-			processHeartBeatMessage(payload_packet);
-			break;
-
-		case gcs_receive_headers_type::RX_VEHICLE:
-			processVehicleMessage(payload_packet);
-			break;
-
-		case gcs_receive_headers_type::RX_PAYLOAD:
-			processPayloadMessage(payload_packet);
-			break;
-
-		case gcs_receive_headers_type::RX_WAYPOINT:
-			processWaypointMessage(payload_packet);
-			break;
-
-		case gcs_receive_headers_type::RX_CALIBRATION:
-			processCalibrationMessage(payload_packet);
-			break;
-
-		case gcs_receive_headers_type::RX_CONTROL_1:
-			processControlMessage(payload_packet, control_message_type::TYPE_1);
-			break;
-
-		case gcs_receive_headers_type::RX_CONTROL_2:
-			processControlMessage(payload_packet, control_message_type::TYPE_2);
-			break;
-
-		case gcs_receive_headers_type::RX_CONTROL_3:
-			processControlMessage(payload_packet, control_message_type::TYPE_3);
-			break;
-
-		case gcs_receive_headers_type::RX_CONTROL_4:
-			processControlMessage(payload_packet, control_message_type::TYPE_4);
-			break;
-
-		case gcs_receive_headers_type::RX_CONFIG:
-			processConfigMessage(payload_packet);
-			break;
-
-		case gcs_receive_headers_type::RX_CHANGE_HOME:
-			processCHPMessage(payload_packet);
-			break;
-
-		case gcs_receive_headers_type::RX_NO_FLY_ZONE:
-			processNFZMessage(payload_packet);
-			break;
-
-		case gcs_receive_headers_type::RX_BOOT:
-			processBootMessage(payload_packet);
-			break;
-
-		default:
-			break;
-	}
-}
-
-/**
- * @brief 			Processes heartbeat message
- *
- * @param[in]	const payload_packet_type  payload_packet
- *
- * @return 		void
- */
-void GCS_TELEMETRY::processHeartBeatMessage(payload_packet_type const &payload_packet)
-{
-	heartbeat_receive_type heartbeat_receive;
-	if (payload_packet.data_length == HEARTBEAT_RX_BUFFER_SIZE)
-	{
-		std::memcpy(heartbeat_receive.buffer, payload_packet.data, payload_packet.data_length);
-	}
-
-}
-
-/**
- * @brief 			Processes vehicle message
- *
- * @param[in]	const payload_packet_type  payload_packet
- *
- * @return 		void
- */
-void GCS_TELEMETRY::processVehicleMessage(payload_packet_type const &payload_packet)
-{
-	vehicle_receive_type vehicle_receive;
-	if (payload_packet.data_length == VEHICLE_RX_BUFFER_SIZE)
-	{
-		std::memcpy(vehicle_receive.buffer, payload_packet.data, payload_packet.data_length);
-	}
-}
-
-/**
- * @brief 			Processes payload message
- *
- * @param[in]	const payload_packet_type  payload_packet
- *
- * @return 		void
- */
-void GCS_TELEMETRY::processPayloadMessage(payload_packet_type const &payload_packet)
-{
-	payload_receive_type payload_receive;
-	if (payload_packet.data_length == PAYLOAD_RX_BUFFER_SIZE)
-	{
-		std::memcpy(payload_receive.buffer, payload_packet.data, payload_packet.data_length);
-	}
-}
-
-/**
- * @brief 			Processes waypoint message
- *
- * @param[in]	const payload_packet_type  payload_packet
- *
- * @return 		void
- */
-void GCS_TELEMETRY::processWaypointMessage(payload_packet_type const &payload_packet)
-{
-	waypoint_receive_type waypoint_receive;
-	if (payload_packet.data_length == WAYPOINT_RX_BUFFER_SIZE)
-	{
-		std::memcpy(waypoint_receive.buffer, payload_packet.data, payload_packet.data_length);
-	}
-}
-
-/**
- * @brief 			Processes calibration message
- *
- * @param[in]	const payload_packet_type  payload_packet
- *
- * @return 		void
- */
-void GCS_TELEMETRY::processCalibrationMessage(payload_packet_type const &payload_packet)
-{
-	calibration_receive_type calibration_receive;
-	if (payload_packet.data_length == CALIBRATION_RX_BUFFER_SIZE)
-	{
-		std::memcpy(calibration_receive.buffer, payload_packet.data, payload_packet.data_length);
-	}
-}
-
-/**
- * @brief 			Processes control message
- *
- * @param[in]	const payload_packet_type  payload_packet
- * @param[in]	uint8_t  type
- *
- * @return 		void
- */
-void GCS_TELEMETRY::processControlMessage(payload_packet_type const &payload_packet, control_message_type type)
-{
-	control_1_receive_type control_1_receive;
-	control_2_receive_type control_2_receive;
-	control_3_receive_type control_3_receive;
-	control_4_receive_type control_4_receive;
-
-	switch (type)
-	{
-		case control_message_type::TYPE_1:
-			if (payload_packet.data_length == CONTROL_1_RX_BUFFER_SIZE)
-			{
-				std::memcpy(control_1_receive.buffer, payload_packet.data, payload_packet.data_length);
-			}
-			break;
-
-		case control_message_type::TYPE_2:
-			if (payload_packet.data_length == CONTROL_2_RX_BUFFER_SIZE)
-			{
-				std::memcpy(control_2_receive.buffer, payload_packet.data, payload_packet.data_length);
-			}
-			break;
-
-		case control_message_type::TYPE_3:
-			if (payload_packet.data_length == CONTROL_3_RX_BUFFER_SIZE)
-			{
-				std::memcpy(control_3_receive.buffer, payload_packet.data, payload_packet.data_length);
-			}
-			break;
-
-		case control_message_type::TYPE_4:
-			if (payload_packet.data_length == CONTROL_4_RX_BUFFER_SIZE)
-			{
-				std::memcpy(control_4_receive.buffer, payload_packet.data, payload_packet.data_length);
-			}
-			break;
-
-		default:
-			break;
-	}
-}
-
-/**
- * @brief 			Processes configuration message
- *
- * @param[in]	const payload_packet_type  payload_packet
- *
- * @return 		void
- */
-void GCS_TELEMETRY::processConfigMessage(payload_packet_type const &payload_packet)
-{
-	config_receive_type config_receive;
-	if (payload_packet.data_length == CONFIG_RX_BUFFER_SIZE)
-	{
-		std::memcpy(config_receive.buffer, payload_packet.data, payload_packet.data_length);
-	}
-}
-
-/**
- * @brief 			Processes change home point message
- *
- * @param[in]	const payload_packet_type  payload_packet
- *
- * @return 		void
- */
-void GCS_TELEMETRY::processCHPMessage(payload_packet_type const &payload_packet)
-{
-	chp_receive_type chp_receive;
-	if (payload_packet.data_length == CHP_RX_BUFFER_SIZE)
-	{
-		std::memcpy(chp_receive.buffer, payload_packet.data, payload_packet.data_length);
-	}
-}
-
-/**
- * @brief 			Processes no fly zone message
- *
- * @param[in]	const payload_packet_type  payload_packet
- *
- * @return 		void
- */
-void GCS_TELEMETRY::processNFZMessage(payload_packet_type const &payload_packet)
-{
-	nfz_receive_type nfz_receive;
-	if (payload_packet.data_length == NFZ_RX_BUFFER_SIZE)
-	{
-		std::memcpy(nfz_receive.buffer, payload_packet.data, payload_packet.data_length);
-	}
-}
-
-/**
- * @brief 			Processes boot message
- *
- * @param[in]	const payload_packet_type  payload_packet
- *
- * @return 		void
- */
-void GCS_TELEMETRY::processBootMessage(payload_packet_type const &payload_packet)
-{
-	boot_receive_type boot_receive;
-	if (payload_packet.data_length == BOOT_RX_BUFFER_SIZE)
-	{
-		std::memcpy(boot_receive.buffer, payload_packet.data, payload_packet.data_length);
-	}
-}
-
-/**
- * @brief 			Send heartbeat message
- *
- * @param[in]	void
- *
- * @return 		void
- */
-void GCS_TELEMETRY::sendHeartBeatMessage(void)
-{
-	uint8_t src_id = static_cast<uint8_t>(telemetry_id_type::FLIGHT_CONTROLLER);
-	uint8_t dest_id = static_cast<uint8_t>(telemetry_id_type::GCS);
-	heartbeat_transmit_type heartbeat_transmit;
-	payload_packet_type payload_packet;
-	static uint8_t changing_byte = 0;
-
-	payload_packet.header = static_cast<uint8_t>(gcs_transmit_headers_type::TX_HEARTBEAT);
-	payload_packet.version = HEARTBEAT_VERSION;
-	payload_packet.changing_byte = changing_byte++;
-
-	payload_packet.data_length = HEARTBEAT_TX_BUFFER_SIZE;
-
-	heartbeat_transmit.data.reserved = 0;
-
-	std::memcpy(payload_packet.data, heartbeat_transmit.buffer, payload_packet.data_length);
-
-	payload_packet.footer = payload_packet.header + HEADER_FOOTER_DIFF;
-
-	preparePayload(src_id, dest_id, payload_packet);
-}
-
-/**
- * @brief 			Send vehicle message
- *
- * @param[in]	void
- *
- * @return 		void
- */
-void GCS_TELEMETRY::sendVehicleMessage(void)
-{
-	uint8_t src_id = static_cast<uint8_t>(telemetry_id_type::FLIGHT_CONTROLLER);
-	uint8_t dest_id = static_cast<uint8_t>(telemetry_id_type::GCS);
-	vehicle_transmit_type vehicle_transmit;
-	payload_packet_type payload_packet;
-	static uint8_t changing_byte = 0;
-
-	payload_packet.header = static_cast<uint8_t>(gcs_transmit_headers_type::TX_VEHICLE);
-	payload_packet.version = VEHICLE_VERSION;
-	payload_packet.changing_byte = changing_byte++;
-
-	payload_packet.data_length = VEHICLE_TX_BUFFER_SIZE;
-
-	vehicle_transmit.data.reserved = 0;
-
-	std::memcpy(payload_packet.data, vehicle_transmit.buffer, payload_packet.data_length);
-
-	payload_packet.footer = payload_packet.header + HEADER_FOOTER_DIFF;
-
-	preparePayload(src_id, dest_id, payload_packet);
-}
-
-/**
- * @brief 			Send payload message
- *
- * @param[in]	void
- *
- * @return 		void
- */
-void GCS_TELEMETRY::sendPayloadMessage(void)
-{
-	uint8_t src_id = static_cast<uint8_t>(telemetry_id_type::FLIGHT_CONTROLLER);
-	uint8_t dest_id = static_cast<uint8_t>(telemetry_id_type::GCS);
-	payload_transmit_type payload_transmit;
-	payload_packet_type payload_packet;
-	static uint8_t changing_byte = 0;
-
-	payload_packet.header = static_cast<uint8_t>(gcs_transmit_headers_type::TX_PAYLOAD);
-	payload_packet.version = PAYLOAD_VERSION;
-	payload_packet.changing_byte = changing_byte++;
-
-	payload_packet.data_length = PAYLOAD_TX_BUFFER_SIZE;
-
-	payload_transmit.data.reserved = 0;
-
-	std::memcpy(payload_packet.data, payload_transmit.buffer, payload_packet.data_length);
-
-	payload_packet.footer = payload_packet.header + HEADER_FOOTER_DIFF;
-
-	preparePayload(src_id, dest_id, payload_packet);
-}
-
-/**
- * @brief 			Send waypoint message
- *
- * @param[in]	void
- *
- * @return 		void
- */
-void GCS_TELEMETRY::sendWaypointMessage(void)
-{
-	uint8_t src_id = static_cast<uint8_t>(telemetry_id_type::FLIGHT_CONTROLLER);
-	uint8_t dest_id = static_cast<uint8_t>(telemetry_id_type::GCS);
-	waypoint_transmit_type waypoint_transmit;
-	payload_packet_type payload_packet;
-	static uint8_t changing_byte = 0;
-
-	payload_packet.header = static_cast<uint8_t>(gcs_transmit_headers_type::TX_WAYPOINT);
-	payload_packet.version = WAYPOINT_VERSION;
-	payload_packet.changing_byte = changing_byte++;
-
-	payload_packet.data_length = WAYPOINT_TX_BUFFER_SIZE;
-
-	waypoint_transmit.data.reserved = 0;
-
-	std::memcpy(payload_packet.data, waypoint_transmit.buffer, payload_packet.data_length);
-
-	payload_packet.footer = payload_packet.header + HEADER_FOOTER_DIFF;
-
-	preparePayload(src_id, dest_id, payload_packet);
+	messages.decode(payload_packet);
 }
 
 /**
- * @brief 			Send telemetry 5hz message
+ * @brief 			Adds a stream for every transmit message. Heartbeat and control are CRITICAL,
+ *					TELEMETRY_1HZ and calibration are degraded first on a loaded link.
+ *					Nothing fills outgoing from the vehicle state yet, so every stream is added
+ *					at rate 0 instead of the descriptor rate: the producer of a message writes it
+ *					to outgoing and sends it by requestMessage. A periodic stream would send
+ *					cleared messages.
  *
- * @param[in]	void
+ * @param[in]	TELEMETRY_SCHEDULER *scheduler : Scheduler of the link of the endpoint
  *
- * @return 		void
+ * @return 		bool : false if a stream does not fit into the table of the scheduler
  */
-void GCS_TELEMETRY::sendTelemetry5HzMessage(void)
+bool GCS_TELEMETRY::registerStreams(TELEMETRY_SCHEDULER *scheduler)
 {
-	uint8_t src_id = static_cast<uint8_t>(telemetry_id_type::FLIGHT_CONTROLLER);
-	uint8_t dest_id = static_cast<uint8_t>(telemetry_id_type::GCS);
-	telemetry_5hz_type telemetry_5hz_transmit;
-	payload_packet_type payload_packet;
-	static uint8_t changing_byte = 0;
-
-	payload_packet.header = static_cast<uint8_t>(gcs_transmit_headers_type::TX_TELEMETRY_5HZ);
-	payload_packet.version = TELEMETRY_5HZ_VERSION;
-	payload_packet.changing_byte = changing_byte++;
-
-	payload_packet.data_length = TELEMETRY_5HZ_TX_BUFFER_SIZE;
-
-	telemetry_5hz_transmit.data.reserved = 0;
-
-	std::memcpy(payload_packet.data, telemetry_5hz_transmit.buffer, payload_packet.data_length);
-
-	payload_packet.footer = payload_packet.header + HEADER_FOOTER_DIFF;
-
-	preparePayload(src_id, dest_id, payload_packet);
-}
-
-/**
- * @brief 			Send telemetry 1hz message
- *
- * @param[in]	void
- *
- * @return 		void
- */
-void GCS_TELEMETRY::sendTelemetry1HzMessage(void)
-{
-	uint8_t src_id = static_cast<uint8_t>(telemetry_id_type::FLIGHT_CONTROLLER);
-	uint8_t dest_id = static_cast<uint8_t>(telemetry_id_type::GCS);
-	telemetry_1hz_type telemetry_1hz_transmit;
-	payload_packet_type payload_packet;
-	static uint8_t changing_byte = 0;
-
-	payload_packet.header = static_cast<uint8_t>(gcs_transmit_headers_type::TX_TELEMETRY_1HZ);
-	payload_packet.version = TELEMETRY_1HZ_VERSION;
-	payload_packet.changing_byte = changing_byte++;
-
-	payload_packet.data_length = TELEMETRY_1HZ_TX_BUFFER_SIZE;
-
-	telemetry_1hz_transmit.data.reserved = 0;
-
-	std::memcpy(payload_packet.data, telemetry_1hz_transmit.buffer, payload_packet.data_length);
-
-	payload_packet.footer = payload_packet.header + HEADER_FOOTER_DIFF;
-
-	preparePayload(src_id, dest_id, payload_packet);
-}
-
-/**
- * @brief 			Send calibration message
- *
- * @param[in]	void
- *
- * @return 		void
- */
-void GCS_TELEMETRY::sendCalibrationMessage(void)
-{
-	uint8_t src_id = static_cast<uint8_t>(telemetry_id_type::FLIGHT_CONTROLLER);
-	uint8_t dest_id = static_cast<uint8_t>(telemetry_id_type::GCS);
-	calibration_transmit_type calibration_transmit;
-	payload_packet_type payload_packet;
-	static uint8_t changing_byte = 0;
+	bool result = true;
 
-	payload_packet.header = static_cast<uint8_t>(gcs_transmit_headers_type::TX_CALIBRATION);
-	payload_packet.version = CALIBRATION_VERSION;
-	payload_packet.changing_byte = changing_byte++;
+	telemetry_scheduler = scheduler;
 
-	payload_packet.data_length = CALIBRATION_TX_BUFFER_SIZE;
+	result &= scheduler->addStream<heartbeat_tx_descriptor>("gcs_heartbeat", stream_priority_type::CRITICAL, &sendStoredMessage<heartbeat_tx_descriptor>, this, 0);
+	result &= scheduler->addStream<control_1_tx_descriptor>("gcs_control_1", stream_priority_type::CRITICAL, &sendStoredMessage<control_1_tx_descriptor>, this, 0);
+	result &= scheduler->addStream<control_2_tx_descriptor>("gcs_control_2", stream_priority_type::CRITICAL, &sendStoredMessage<control_2_tx_descriptor>, this, 0);
+	result &= scheduler->addStream<control_3_tx_descriptor>("gcs_control_3", stream_priority_type::CRITICAL, &sendStoredMessage<control_3_tx_descriptor>, this, 0);
+	result &= scheduler->addStream<control_4_tx_descriptor>("gcs_control_4", stream_priority_type::CRITICAL, &sendStoredMessage<control_4_tx_descriptor>, this, 0);
+	result &= scheduler->addStream<telemetry_5hz_tx_descriptor>("gcs_telemetry_5hz", stream_priority_type::NORMAL, &sendStoredMessage<telemetry_5hz_tx_descriptor>, this, 0);
+	result &= scheduler->addStream<vehicle_tx_descriptor>("gcs_vehicle", stream_priority_type::NORMAL, &sendStoredMessage<vehicle_tx_descriptor>, this, 0);
+	result &= scheduler->addStream<payload_tx_descriptor>("gcs_payload", stream_priority_type::NORMAL, &sendStoredMessage<payload_tx_descriptor>, this, 0);
+	result &= scheduler->addStream<waypoint_tx_descriptor>("gcs_waypoint", stream_priority_type::NORMAL, &sendStoredMessage<waypoint_tx_descriptor>, this, 0);
+	result &= scheduler->addStream<config_tx_descriptor>("gcs_config", stream_priority_type::NORMAL, &sendStoredMessage<config_tx_descriptor>, this, 0);
+	result &= scheduler->addStream<chp_tx_descriptor>("gcs_chp", stream_priority_type::NORMAL, &sendStoredMessage<chp_tx_descriptor>, this, 0);
+	result &= scheduler->addStream<nfz_tx_descriptor>("gcs_nfz", stream_priority_type::NORMAL, &sendStoredMessage<nfz_tx_descriptor>, this, 0);
+	result &= scheduler->addStream<boot_tx_descriptor>("gcs_boot", stream_priority_type::NORMAL, &sendStoredMessage<boot_tx_descriptor>, this, 0);
+	result &= scheduler->addStream<telemetry_1hz_tx_descriptor>("gcs_telemetry_1hz", stream_priority_type::LOW, &sendStoredMessage<telemetry_1hz_tx_descriptor>, this, 0);
+	result &= scheduler->addStream<calibration_tx_descriptor>("gcs_calibration", stream_priority_type::LOW, &sendStoredMessage<calibration_tx_descriptor>, this, 0);
 
-	calibration_transmit.data.reserved = 0;
-
-	std::memcpy(payload_packet.data, calibration_transmit.buffer, payload_packet.data_length);
-
-	payload_packet.footer = payload_packet.header + HEADER_FOOTER_DIFF;
-
-	preparePayload(src_id, dest_id, payload_packet);
+	return result;
 }
 
 /**
- * @brief 			Send control message
+ * @brief 			Marks the stream of a send function pending
  *
- * @param[in]	control_message_type type
+ * @param[in]	bool (*send)(void *context)
  *
- * @return 		void
+ * @return 		bool : false if the streams are not registered
  */
-void GCS_TELEMETRY::sendControlMessage(control_message_type type)
+bool GCS_TELEMETRY::requestStream(bool (*send)(void *context))
 {
-	uint8_t src_id = static_cast<uint8_t>(telemetry_id_type::FLIGHT_CONTROLLER);
-	uint8_t dest_id = static_cast<uint8_t>(telemetry_id_type::GCS);
-	payload_packet_type payload_packet;
-
-	static uint8_t changing_byte_1 = 0;
-	static uint8_t changing_byte_2 = 0;
-	static uint8_t changing_byte_3 = 0;
-	static uint8_t changing_byte_4 = 0;
-
-	control_1_transmit_type control_1_transmit;
-	control_2_transmit_type control_2_transmit;
-	control_3_transmit_type control_3_transmit;
-	control_4_transmit_type control_4_transmit;
-
-	payload_packet.version = CONTROL_VERSION;
-
-	switch (type)
+	if (telemetry_scheduler == nullptr)
 	{
-		case control_message_type::TYPE_1:
-			payload_packet.header = static_cast<uint8_t>(gcs_transmit_headers_type::TX_CONTROL_1);
-			payload_packet.changing_byte = changing_byte_1++;
-
-			payload_packet.data_length = CONTROL_1_TX_BUFFER_SIZE;
-
-			control_1_transmit.data.reserved = 0;
-
-			std::memcpy(payload_packet.data, control_1_transmit.buffer, payload_packet.data_length);
-			break;
-
-		case control_message_type::TYPE_2:
-			payload_packet.header = static_cast<uint8_t>(gcs_transmit_headers_type::TX_CONTROL_2);
-			payload_packet.changing_byte = changing_byte_2++;
-
-			payload_packet.data_length = CONTROL_2_TX_BUFFER_SIZE;
-
-			control_2_transmit.data.reserved = 0;
-
-			std::memcpy(payload_packet.data, control_2_transmit.buffer, payload_packet.data_length);
-			break;
-
-		case control_message_type::TYPE_3:
-			payload_packet.header = static_cast<uint8_t>(gcs_transmit_headers_type::TX_CONTROL_3);
-			payload_packet.changing_byte = changing_byte_3++;
-
-			payload_packet.data_length = CONTROL_3_TX_BUFFER_SIZE;
-
-			control_3_transmit.data.reserved = 0;
-
-			std::memcpy(payload_packet.data, control_3_transmit.buffer, payload_packet.data_length);
-			break;
-
-		case control_message_type::TYPE_4:
-			payload_packet.header = static_cast<uint8_t>(gcs_transmit_headers_type::TX_CONTROL_4);
-			payload_packet.changing_byte = changing_byte_4++;
-
-			payload_packet.data_length = CONTROL_4_TX_BUFFER_SIZE;
-
-			control_4_transmit.data.reserved = 0;
-
-			std::memcpy(payload_packet.data, control_4_transmit.buffer, payload_packet.data_length);
-			break;
-
-		default:
-			break;
+		return false;
 	}
 
-	payload_packet.footer = payload_packet.header + HEADER_FOOTER_DIFF;
-
-	preparePayload(src_id, dest_id, payload_packet);
-}
-
-/**
- * @brief 			Send configuration message
- *
- * @param[in]	void
- *
- * @return 		void
- */
-void GCS_TELEMETRY::sendConfigMessage(void)
-{
-	uint8_t src_id = static_cast<uint8_t>(telemetry_id_type::FLIGHT_CONTROLLER);
-	uint8_t dest_id = static_cast<uint8_t>(telemetry_id_type::GCS);
-	config_transmit_type config_transmit;
-	payload_packet_type payload_packet;
-	static uint8_t changing_byte = 0;
-
-	payload_packet.header = static_cast<uint8_t>(gcs_transmit_headers_type::TX_CONFIG);
-	payload_packet.version = CONFIG_VERSION;
-	payload_packet.changing_byte = changing_byte++;
-
-	payload_packet.data_length = CONFIG_TX_BUFFER_SIZE;
-
-	config_transmit.data.reserved = 0;
-
-	std::memcpy(payload_packet.data, config_transmit.buffer, payload_packet.data_length);
-
-	payload_packet.footer = payload_packet.header + HEADER_FOOTER_DIFF;
-
-	preparePayload(src_id, dest_id, payload_packet);
-}
-
-/**
- * @brief 			Send change home point message
- *
- * @param[in]	void
- *
- * @return 		void
- */
-void GCS_TELEMETRY::sendCHPMessage(void)
-{
-	uint8_t src_id = static_cast<uint8_t>(telemetry_id_type::FLIGHT_CONTROLLER);
-	uint8_t dest_id = static_cast<uint8_t>(telemetry_id_type::GCS);
-	chp_transmit_type chp_transmit;
-	payload_packet_type payload_packet;
-	static uint8_t changing_byte = 0;
-
-	payload_packet.header = static_cast<uint8_t>(gcs_transmit_headers_type::TX_CHANGE_HOME);
-	payload_packet.version = CHP_VERSION;
-	payload_packet.changing_byte = changing_byte++;
-
-	payload_packet.data_length = CHP_TX_BUFFER_SIZE;
-
-	chp_transmit.data.reserved = 0;
-
-	std::memcpy(payload_packet.data, chp_transmit.buffer, payload_packet.data_length);
-
-	payload_packet.footer = payload_packet.header + HEADER_FOOTER_DIFF;
-
-	preparePayload(src_id, dest_id, payload_packet);
-}
-
-/**
- * @brief 			Send no fly zone message
- *
- * @param[in]	void
- *
- * @return 		void
- */
-void GCS_TELEMETRY::sendNFZMessage(void)
-{
-	uint8_t src_id = static_cast<uint8_t>(telemetry_id_type::FLIGHT_CONTROLLER);
-	uint8_t dest_id = static_cast<uint8_t>(telemetry_id_type::GCS);
-	nfz_transmit_type nfz_transmit;
-	payload_packet_type payload_packet;
-	static uint8_t changing_byte = 0;
-
-	payload_packet.header = static_cast<uint8_t>(gcs_transmit_headers_type::TX_NO_FLY_ZONE);
-	payload_packet.version = NFZ_VERSION;
-	payload_packet.changing_byte = changing_byte++;
-
-	payload_packet.data_length = NFZ_TX_BUFFER_SIZE;
-
-	nfz_transmit.data.reserved = 0;
-
-	std::memcpy(payload_packet.data, nfz_transmit.buffer, payload_packet.data_length);
-
-	payload_packet.footer = payload_packet.header + HEADER_FOOTER_DIFF;
-
-	preparePayload(src_id, dest_id, payload_packet);
-}
-
-/**
- * @brief 			Send boot message
- *
- * @param[in]	void
- *
- * @return 		void
- */
-void GCS_TELEMETRY::sendBootMessage(void)
-{
-	uint8_t src_id = static_cast<uint8_t>(telemetry_id_type::FLIGHT_CONTROLLER);
-	uint8_t dest_id = static_cast<uint8_t>(telemetry_id_type::GCS);
-	boot_transmit_type boot_transmit;
-	payload_packet_type payload_packet;
-	static uint8_t changing_byte = 0;
-
-	payload_packet.header = static_cast<uint8_t>(gcs_transmit_headers_type::TX_BOOT);
-	payload_packet.version = BOOT_VERSION;
-	payload_packet.changing_byte = changing_byte++;
-
-	payload_packet.data_length = BOOT_TX_BUFFER_SIZE;
-
-	boot_transmit.data.reserved = 0;
-
-	std::memcpy(payload_packet.data, boot_transmit.buffer, payload_packet.data_length);
-
-	payload_packet.footer = payload_packet.header + HEADER_FOOTER_DIFF;
-
-	preparePayload(src_id, dest_id, payload_packet);
+	return telemetry_scheduler->request(send, this);
 }
 
 /**
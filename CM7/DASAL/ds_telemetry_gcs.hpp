@@ -32,6 +32,7 @@
  */
 #include <stdint.h>
 #include "ds_telemetry.hpp"
+#include "ds_telemetry_codec.hpp"
 #include "ds_uart_h747.hpp"
 // End of Includes
 
@@ -70,6 +71,10 @@ const uint16_t CONFIG_RX_BUFFER_SIZE = 4;
 const uint16_t CHP_RX_BUFFER_SIZE = 4;
 const uint16_t NFZ_RX_BUFFER_SIZE = 4;
 const uint16_t BOOT_RX_BUFFER_SIZE = 4;
+
+const uint8_t TELEMETRY_HEADER = 0xFA;
+const uint8_t FRAME_PAYLOAD_OFFSET = 5;			///< TELEMETRY_HEADER, SOURCE_ID, DESTINATION_ID and PAYLOAD_SIZE
+const uint8_t FRAME_SIZE_WITHOUT_PAYLOAD = 7;	///< The fields before the payload and CRC16
 //End of Macro Definitions
 
 /*
@@ -112,14 +117,6 @@ enum class gcs_transmit_headers_type : uint8_t
 	TX_BOOT = 30,
 };
 
-enum class control_message_type : uint8_t
-{
-	TYPE_1 = 1,
-	TYPE_2 = 2,
-	TYPE_3 = 3,
-	TYPE_4 = 4,
-};
-
 enum class telemetry_id_type : uint8_t
 {
 	GCS = 0x00,
@@ -714,32 +711,107 @@ union boot_transmit_type
 };
 #pragma pack()
 
-struct payload_packet_type
-{
-		uint8_t header = 0;
-		uint16_t data_length = 0;
-		uint8_t version = 0;
-		uint8_t changing_byte = 0;
-		uint8_t data[1024] = { 0 };
-		uint8_t footer = 0;
-};
-
 // End of Enum, Union and Struct Definitions
 
+/*
+ * Begin of Message Descriptors
+ */
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_receive_headers_type::RX_HEARTBEAT), 0, heartbeat_receive_type, 0, message_direction_type::RECEIVE> heartbeat_rx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_receive_headers_type::RX_VEHICLE), 0, vehicle_receive_type, 0, message_direction_type::RECEIVE> vehicle_rx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_receive_headers_type::RX_PAYLOAD), 0, payload_receive_type, 0, message_direction_type::RECEIVE> payload_rx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_receive_headers_type::RX_WAYPOINT), 0, waypoint_receive_type, 0, message_direction_type::RECEIVE> waypoint_rx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_receive_headers_type::RX_CALIBRATION), 0, calibration_receive_type, 0, message_direction_type::RECEIVE> calibration_rx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_receive_headers_type::RX_CONTROL_1), 0, control_1_receive_type, 0, message_direction_type::RECEIVE> control_1_rx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_receive_headers_type::RX_CONTROL_2), 0, control_2_receive_type, 0, message_direction_type::RECEIVE> control_2_rx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_receive_headers_type::RX_CONTROL_3), 0, control_3_receive_type, 0, message_direction_type::RECEIVE> control_3_rx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_receive_headers_type::RX_CONTROL_4), 0, control_4_receive_type, 0, message_direction_type::RECEIVE> control_4_rx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_receive_headers_type::RX_CONFIG), 0, config_receive_type, 0, message_direction_type::RECEIVE> config_rx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_receive_headers_type::RX_CHANGE_HOME), 0, chp_receive_type, 0, message_direction_type::RECEIVE> chp_rx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_receive_headers_type::RX_NO_FLY_ZONE), 0, nfz_receive_type, 0, message_direction_type::RECEIVE> nfz_rx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_receive_headers_type::RX_BOOT), 0, boot_receive_type, 0, message_direction_type::RECEIVE> boot_rx_descriptor;
+
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_transmit_headers_type::TX_HEARTBEAT), 0, heartbeat_transmit_type, 1, message_direction_type::TRANSMIT> heartbeat_tx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_transmit_headers_type::TX_VEHICLE), 0, vehicle_transmit_type, 0, message_direction_type::TRANSMIT> vehicle_tx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_transmit_headers_type::TX_PAYLOAD), 0, payload_transmit_type, 0, message_direction_type::TRANSMIT> payload_tx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_transmit_headers_type::TX_WAYPOINT), 0, waypoint_transmit_type, 0, message_direction_type::TRANSMIT> waypoint_tx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_transmit_headers_type::TX_TELEMETRY_5HZ), 0, telemetry_5hz_type, 5, message_direction_type::TRANSMIT> telemetry_5hz_tx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_transmit_headers_type::TX_TELEMETRY_1HZ), 0, telemetry_1hz_type, 1, message_direction_type::TRANSMIT> telemetry_1hz_tx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_transmit_headers_type::TX_CALIBRATION), 0, calibration_transmit_type, 0, message_direction_type::TRANSMIT> calibration_tx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_transmit_headers_type::TX_CONTROL_1), 0, control_1_transmit_type, 0, message_direction_type::TRANSMIT> control_1_tx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_transmit_headers_type::TX_CONTROL_2), 0, control_2_transmit_type, 0, message_direction_type::TRANSMIT> control_2_tx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_transmit_headers_type::TX_CONTROL_3), 0, control_3_transmit_type, 0, message_direction_type::TRANSMIT> control_3_tx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_transmit_headers_type::TX_CONTROL_4), 0, control_4_transmit_type, 0, message_direction_type::TRANSMIT> control_4_tx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_transmit_headers_type::TX_CONFIG), 0, config_transmit_type, 0, message_direction_type::TRANSMIT> config_tx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_transmit_headers_type::TX_CHANGE_HOME), 0, chp_transmit_type, 0, message_direction_type::TRANSMIT> chp_tx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_transmit_headers_type::TX_NO_FLY_ZONE), 0, nfz_transmit_type, 0, message_direction_type::TRANSMIT> nfz_tx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(gcs_transmit_headers_type::TX_BOOT), 0, boot_transmit_type, 0, message_direction_type::TRANSMIT> boot_tx_descriptor;
+
+typedef MESSAGE_CODEC<heartbeat_rx_descriptor, vehicle_rx_descriptor, payload_rx_descriptor, waypoint_rx_descriptor,
+		calibration_rx_descriptor, control_1_rx_descriptor, control_2_rx_descriptor, control_3_rx_descriptor,
+		control_4_rx_descriptor, config_rx_descriptor, chp_rx_descriptor, nfz_rx_descriptor, boot_rx_descriptor> gcs_message_codec_type;
+
+typedef MESSAGE_STORE<heartbeat_tx_descriptor, vehicle_tx_descriptor, payload_tx_descriptor, waypoint_tx_descriptor,
+		telemetry_5hz_tx_descriptor, telemetry_1hz_tx_descriptor, calibration_tx_descriptor, control_1_tx_descriptor,
+		control_2_tx_descriptor, control_3_tx_descriptor, control_4_tx_descriptor, config_tx_descriptor, chp_tx_descriptor,
+		nfz_tx_descriptor, boot_tx_descriptor> gcs_message_store_type;
+// End of Message Descriptors
+
+class TELEMETRY_ROUTER;
+class CAN_TRANSPORT;
+class TELEMETRY_SCHEDULER;
+
 /*
  * Begin of TELEMETRY Class Definition
  */
 class TELEMETRY: public BASE
 {
+		friend class TELEMETRY_ROUTER;
+		friend class CAN_TRANSPORT;
+
 	public:
 		explicit TELEMETRY(Peripherals::Uart::H747_UART *uart_module, telemetry_id_type source_id, telemetry_id_type destination_id);
 
 		void scheduler(void) override;
 		void parseReceivedData(void) override;
-		void sendPacket(uint8_t source_id, uint8_t destination_id, const uint8_t data[], uint16_t length);
+		bool sendPacket(uint8_t source_id, uint8_t destination_id, const uint8_t data[], uint16_t length);
 		void sendPacket(uint16_t command, uint8_t data[], uint16_t length) override;
 		void sendPeriodicPacket(void) override;
 
+		/**
+		 * @brief 		Encodes a message of this endpoint and sends it from the flight controller to the peer
+		 *
+		 * @return 		bool : false if the link is saturated and the packet is dropped
+		 */
+		template <typename descriptor_type>
+		bool sendMessage(typename descriptor_type::type const &message)
+		{
+			return sendMessageInPlace<descriptor_type>([&message](typename descriptor_type::type &frame_message)
+			{
+				frame_message = message;
+			});
+		}
+
+		/**
+		 * @brief 		Builds the frame in one pass, in the transmit ring of the UART when it has contiguous
+		 *				space. serialize fills the cleared message in the frame, then the lengths and both
+		 *				CRCs are patched in place. serialize must not send anything on the same link.
+		 *
+		 * @return 		bool : false if the link is saturated and the packet is dropped
+		 */
+		template <typename descriptor_type, typename serializer_type>
+		bool sendMessageInPlace(serializer_type serialize)
+		{
+			static_assert(descriptor_type::DIRECTION == message_direction_type::TRANSMIT, "Only transmit messages are sent");
+
+			static uint8_t changing_byte = 0;
+			uint8_t stack_frame[descriptor_type::PAYLOAD_SIZE + FRAME_SIZE_WITHOUT_PAYLOAD];
+			uint8_t *frame = beginFrame(stack_frame, descriptor_type::PAYLOAD_SIZE);
+
+			serialize(descriptor_type::beginPayload(&frame[FRAME_PAYLOAD_OFFSET]));
+			descriptor_type::finishPayload(changing_byte++, &frame[FRAME_PAYLOAD_OFFSET]);
+			return sendFrame(frame, stack_frame, static_cast<uint8_t>(destination_id), static_cast<uint8_t>(source_id), descriptor_type::PAYLOAD_SIZE);
+		}
+
 		TELEMETRY(const TELEMETRY &orig);
 		virtual ~TELEMETRY();
 
@@ -748,15 +820,18 @@ class TELEMETRY: public BASE
 		void processPayloadPacket(const uint8_t data[], uint16_t size);
 
 		virtual void processReceivedPacket(payload_packet_type const &payload_packet) = 0;
-		void preparePayload(uint8_t src_id, uint8_t dest_id, payload_packet_type const &payload_packet);
-		const uint8_t HEADER_FOOTER_DIFF = 126;
 
 	private:
+		uint8_t *beginFrame(uint8_t stack_frame[], uint16_t payload_length);
+		bool sendFrame(uint8_t frame[], const uint8_t stack_frame[], uint8_t source_id, uint8_t destination_id, uint16_t payload_length);
+
 		Peripherals::Uart::H747_UART *uart_module = nullptr;
 		telemetry_id_type source_id;
 		telemetry_id_type destination_id;
 		uint16_t parse_error_counter = 0;
 		uint16_t payload_error_counter = 0;
+		TELEMETRY_ROUTER *router = nullptr;	///< Set when the link is shared, the router parses it for every endpoint
+		CAN_TRANSPORT *can_transport = nullptr;	///< Set when the endpoint is moved to CAN-FD, it replaces the UART link
 
 };
 // End of of TELEMETRY Definition
@@ -772,48 +847,37 @@ class GCS_TELEMETRY: public TELEMETRY
 		GCS_TELEMETRY(const GCS_TELEMETRY &orig);
 		virtual ~GCS_TELEMETRY();
 
+		bool registerStreams(TELEMETRY_SCHEDULER *scheduler);
+
+		/**
+		 * @brief 		Sends the message of outgoing once, when the link has capacity for it
+		 *
+		 * @return 		bool : false if the streams are not registered
+		 */
+		template <typename descriptor_type>
+		bool requestMessage(void)
+		{
+			return requestStream(&sendStoredMessage<descriptor_type>);
+		}
+
+		gcs_message_codec_type messages;	///< Last received message of every type
+		gcs_message_store_type outgoing;	///< Next transmitted message of every type
+
 	protected:
 		void processReceivedPacket(payload_packet_type const &payload_packet) override;
 
 	private:
+		TELEMETRY_SCHEDULER *telemetry_scheduler = nullptr;
 
-		const uint8_t HEARTBEAT_VERSION = 0;
-		const uint8_t VEHICLE_VERSION = 0;
-		const uint8_t PAYLOAD_VERSION = 0;
-		const uint8_t WAYPOINT_VERSION = 0;
-		const uint8_t TELEMETRY_5HZ_VERSION = 0;
-		const uint8_t TELEMETRY_1HZ_VERSION = 0;
-		const uint8_t CALIBRATION_VERSION = 0;
-		const uint8_t CONTROL_VERSION = 0;
-		const uint8_t CONFIG_VERSION = 0;
-		const uint8_t CHP_VERSION = 0;
-		const uint8_t NFZ_VERSION = 0;
-		const uint8_t BOOT_VERSION = 0;
-
-		void processHeartBeatMessage(payload_packet_type const &payload_packet);
-		void processVehicleMessage(payload_packet_type const &payload_packet);
-		void processPayloadMessage(payload_packet_type const &payload_packet);
-		void processWaypointMessage(payload_packet_type const &payload_packet);
-		void processCalibrationMessage(payload_packet_type const &payload_packet);
-		void processControlMessage(payload_packet_type const &payload_packet, control_message_type type);
-		void processConfigMessage(payload_packet_type const &payload_packet);
-		void processCHPMessage(payload_packet_type const &payload_packet);
-		void processNFZMessage(payload_packet_type const &payload_packet);
-		void processBootMessage(payload_packet_type const &payload_packet);
-
-		void sendHeartBeatMessage(void);
-		void sendVehicleMessage(void);
-		void sendPayloadMessage(void);
-		void sendWaypointMessage(void);
-		void sendTelemetry5HzMessage(void);
-		void sendTelemetry1HzMessage(void);
-		void sendCalibrationMessage(void);
-		void sendControlMessage(control_message_type type);
-		void sendConfigMessage(void);
-		void sendCHPMessage(void);
-		void sendNFZMessage(void);
-		void sendBootMessage(void);
+		bool requestStream(bool (*send)(void *context));
 
+		template <typename descriptor_type>
+		static bool sendStoredMessage(void *context)
+		{
+			GCS_TELEMETRY &telemetry = *static_cast<GCS_TELEMETRY *>(context);
+
+			return telemetry.sendMessage<descriptor_type>(telemetry.outgoing.getMessage<descriptor_type>());
+		}
 };
 // End of of GCS_TELEMETRY Definition
 
@@ -167,6 +167,16 @@ union ins_ext_receive_type
 
 // End of Enum, Union and Struct Definitions
 
+/*
+ * Begin of Message Descriptors
+ */
+typedef message_descriptor_type<static_cast<uint8_t>(ins_receive_headers_type::RX_INS), 0, ins_receive_type, 0, message_direction_type::RECEIVE> ins_rx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(ins_receive_headers_type::RX_INS_EXTENDED), 0, ins_ext_receive_type, 0, message_direction_type::RECEIVE> ins_ext_rx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(ins_transmit_headers_type::TX_INS), 0, ins_transmit_type, 0, message_direction_type::TRANSMIT> ins_tx_descriptor;
+
+typedef MESSAGE_CODEC<ins_rx_descriptor, ins_ext_rx_descriptor> ins_message_codec_type;
+// End of Message Descriptors
+
 /*
  * Begin of INS_TELEMETRY Class Definition
  */
@@ -179,13 +189,10 @@ class INS_TELEMETRY: public TELEMETRY
 		virtual ~INS_TELEMETRY();
 		INS_TELEMETRY(const INS_TELEMETRY &other);
 
+		ins_message_codec_type messages;	///< Last received message of every type
+
 	protected:
 		void processReceivedPacket(payload_packet_type const &payload_packet) override;
-
-	private:
-		const uint8_t INS_VERSION = 0;
-
-		void sendMessage(void);
 };
 
 } /* End of namespace Telemetry */
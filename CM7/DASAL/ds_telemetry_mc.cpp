@@ -25,7 +25,6 @@
  */
 
 #include <ds_telemetry_mc.hpp>
-#include <cstring>
 
 Telemetry::MC_TELEMETRY mc_telemetry(&uart3, Telemetry::telemetry_id_type::MISSION_COMPUTER, Telemetry::telemetry_id_type::FLIGHT_CONTROLLER);
 
@@ -56,66 +55,7 @@ MC_TELEMETRY::MC_TELEMETRY(Peripherals::Uart::H747_UART *uart_module, telemetry_
  */
 void MC_TELEMETRY::processReceivedPacket(payload_packet_type const &payload_packet)
 {
-	mc_receive_type mc_receive;
-	mc_receive_headers_type mc_header = static_cast<mc_receive_headers_type>(payload_packet.header);
-
-	if ((mc_header == mc_receive_headers_type::RX_MC) && (payload_packet.data_length == MC_RX_BUFFER_SIZE))
-	{
-		std::memcpy(mc_receive.buffer, payload_packet.data, payload_packet.data_length);
-	}
-}
-
-/**
- * @brief 			Send packet
- *
- * @param[in]	void
- *
- * @return 		void
- */
-void MC_TELEMETRY::sendMessage(void)
-{
-	uint8_t src_id = static_cast<uint8_t>(telemetry_id_type::FLIGHT_CONTROLLER);
-	uint8_t dest_id = static_cast<uint8_t>(telemetry_id_type::MISSION_COMPUTER);
-	mc_transmit_type mc_transmit;
-	uint8_t data[512] = { 0 };
-	static uint8_t changing_byte = 0;
-
-	uint8_t buffer[512] = { 0 };
-	uint16_t buffer_index = 0;
-	uint8_t crc_data[512] = { 0 };
-	uint16_t crc_index = 0;
-	uint16_t index = 0;
-	uint16_t crc16 = 0;
-
-	uint16_t data_length = MC_TX_BUFFER_SIZE;
-
-	mc_transmit.data.reserved = 0;
-
-	std::memcpy(data, mc_transmit.buffer, data_length);
-
-	buffer[buffer_index++] = static_cast<uint8_t>(mc_transmit_headers_type::TX_MC);
-
-	buffer[buffer_index++] = MC_VERSION;
-	crc_data[crc_index++] = MC_VERSION;
-
-	buffer[buffer_index++] = changing_byte;
-	crc_data[crc_index++] = changing_byte;
-	changing_byte++;
-
-	for (index = 0; index < data_length; index++)
-	{
-		buffer[buffer_index++] = data[index];
-		crc_data[crc_index++] = data[index];
-	}
-
-	crc16 = calculateCrc16(crc_data, crc_index);
-
-	buffer[buffer_index++] = static_cast<uint8_t>(crc16 % 256);
-	buffer[buffer_index++] = static_cast<uint8_t>(crc16 / 256);
-
-	buffer[buffer_index++] = static_cast<uint8_t>(mc_transmit_headers_type::TX_MC) + HEADER_FOOTER_DIFF;
-
-	sendPacket(src_id, dest_id, buffer, buffer_index);
+	messages.decode(payload_packet);
 }
 
 /**
@@ -103,6 +103,15 @@ union mc_transmit_type
 
 // End of Enum, Union and Struct Definitions
 
+/*
+ * Begin of Message Descriptors
+ */
+typedef message_descriptor_type<static_cast<uint8_t>(mc_receive_headers_type::RX_MC), 0, mc_receive_type, 0, message_direction_type::RECEIVE> mc_rx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(mc_transmit_headers_type::TX_MC), 0, mc_transmit_type, 0, message_direction_type::TRANSMIT> mc_tx_descriptor;
+
+typedef MESSAGE_CODEC<mc_rx_descriptor> mc_message_codec_type;
+// End of Message Descriptors
+
 /*
  * Begin of MC_TELEMETRY Class Definition
  */
@@ -114,15 +123,12 @@ class MC_TELEMETRY: public TELEMETRY
 				telemetry_id_type destination_id);
 
 		MC_TELEMETRY(const MC_TELEMETRY &orig);
+
+		mc_message_codec_type messages;	///< Last received message of every type
 		virtual ~MC_TELEMETRY();
 
 	protected:
 		void processReceivedPacket(payload_packet_type const &payload_packet) override;
-
-	private:
-		const uint8_t MC_VERSION = 0;
-
-		void sendMessage(void);
 };
 // End of of MC_TELEMETRY Definition
 
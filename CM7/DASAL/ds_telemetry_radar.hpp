@@ -94,6 +94,15 @@ union radar_transmit_type
 
 // End of Enum, Union and Struct Definitions
 
+/*
+ * Begin of Message Descriptors
+ */
+typedef message_descriptor_type<static_cast<uint8_t>(radar_receive_headers_type::RX_RADAR), 0, radar_receive_type, 0, message_direction_type::RECEIVE> radar_rx_descriptor;
+typedef message_descriptor_type<static_cast<uint8_t>(radar_transmit_headers_type::TX_RADAR), 0, radar_transmit_type, 0, message_direction_type::TRANSMIT> radar_tx_descriptor;
+
+typedef MESSAGE_CODEC<radar_rx_descriptor> radar_message_codec_type;
+// End of Message Descriptors
+
 /*
  * Begin of RADAR_TELEMETRY Class Definition
  */
@@ -107,13 +116,10 @@ class RADAR_TELEMETRY: public TELEMETRY
 		virtual ~RADAR_TELEMETRY();
 		RADAR_TELEMETRY(const RADAR_TELEMETRY &other);
 
+		radar_message_codec_type messages;	///< Last received message of every type
+
 	protected:
 			void processReceivedPacket(payload_packet_type const &payload_packet) override;
-
-		private:
-			const uint8_t RADAR_VERSION = 0;
-
-			void sendMessage(void);
 };
 
 } /* End of namespace Telemetry */
@@ -0,0 +1,356 @@
+/**
+ ******************************************************************************
+  * @file		: ds_telemetry_router.cpp
+  * @brief		: Telemetry router source file
+  *				  This file contains the single frame parser of a link shared by several telemetry endpoints
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+
+/*
+ * Begin of Includes
+ */
+#include <algorithm>
+#include <cstring>
+#include "ds_telemetry_router.hpp"
+// End of Includes
+
+
+
+/*
+ * Begin of Object Definitions
+ */
+Telemetry::TELEMETRY_ROUTER uart3_router(&uart3);	///< GCS, INS, mission computer and radar share uart3
+//End of Object Definitions
+
+
+
+/**
+  * @brief 		Checks the CRC16 which follows the covered bytes of a frame, low byte first
+  *
+  * @param[in]  const uint8_t frame[]
+  * @param[in]  uint16_t size : Covered bytes, ids, size and payload
+  *
+  * @return 	bool
+  */
+static inline bool checkFrameCrc(const uint8_t frame[], uint16_t size)
+{
+	const uint16_t frame_crc = crc16.calculate(frame, size);
+
+	return (frame[size] == static_cast<uint8_t>(frame_crc)) && (frame[size + 1] == static_cast<uint8_t>(frame_crc >> 8));
+}
+
+
+
+namespace Telemetry
+{
+
+
+
+/**
+  * @brief Default constructor
+  *
+  * @param[in]  Peripherals::Uart::H747_UART *uart_module : Link of the endpoints
+  *
+  * @return 	void
+  */
+TELEMETRY_ROUTER::TELEMETRY_ROUTER(Peripherals::Uart::H747_UART *uart_module) :
+uart_module(uart_module),
+endpoint_table{},
+endpoint_number(0),
+state(parser_state_type::HEADER),
+length(0),
+payload_counter(0),
+frame{}
+{ }
+
+
+
+/**
+  * @brief 		Adds an endpoint of the link, its own source and destination id select its frames.
+  *				After this the parseReceivedData of the endpoint runs the router.
+  *
+  * @param[in]  TELEMETRY *endpoint
+  *
+  * @return 	bool : false if the table is full, the endpoint is on another link or its ids are taken
+  *
+  * Example:
+  * @code
+  * uart3_router.registerEndpoint(&gcs_telemetry);
+  * @endcode
+  */
+bool TELEMETRY_ROUTER::registerEndpoint(TELEMETRY *endpoint)
+{
+	router_endpoint_type entry = {};
+	uint8_t				 index = 0;
+
+	if( (endpoint == nullptr) || (endpoint_number >= ROUTER_MAXIMUM_ENDPOINT_NUMBER) || (endpoint->uart_module != uart_module) )
+	{
+		return false;
+	}
+
+	entry.endpoint		 = endpoint;
+	entry.source_id		 = static_cast<uint8_t>(endpoint->source_id);
+	entry.destination_id = static_cast<uint8_t>(endpoint->destination_id);
+
+	for(index = 0; index < endpoint_number; index++)
+	{
+		if( (endpoint_table[index].source_id == entry.source_id) && (endpoint_table[index].destination_id == entry.destination_id) )
+		{
+			return false;
+		}
+	}
+
+	endpoint_table[endpoint_number++] = entry;
+	endpoint->router = this;
+
+	return true;
+}
+
+
+
+/**
+  * @brief 		Returns the frames delivered to the endpoint of a source and destination id
+  *
+  * @param[in]  telemetry_id_type source_id
+  * @param[in]  telemetry_id_type destination_id
+  *
+  * @return 	uint32_t : 0 if no endpoint is registered for them
+  */
+uint32_t TELEMETRY_ROUTER::getFrameCounter(telemetry_id_type source_id, telemetry_id_type destination_id) const
+{
+	uint8_t index = 0;
+
+	for(index = 0; index < endpoint_number; index++)
+	{
+		if( (endpoint_table[index].source_id == static_cast<uint8_t>(source_id)) &&
+			(endpoint_table[index].destination_id == static_cast<uint8_t>(destination_id)) )
+		{
+			return endpoint_table[index].frame_counter;
+		}
+	}
+
+	return 0;
+}
+
+
+
+/**
+  * @brief 		Runs the link, the receive task calls parseReceivedData directly
+  *
+  * @param[in]	void
+  *
+  * @return 	void
+  */
+void TELEMETRY_ROUTER::scheduler(void)
+{
+	parseReceivedData();
+}
+
+
+
+/**
+  * @brief 		Parses the received bytes of the link in place, one pass for every endpoint
+  *
+  * @param[in]	void
+  *
+  * @return 	void
+  */
+void TELEMETRY_ROUTER::parseReceivedData(void)
+{
+	Peripherals::Uart::receive_span_type span;
+	uint16_t							 size = 0;
+
+	/*
+	 * | HEADER	 		 | SOURCE_ID		| DESTINATION_ID	| PAYLOAD_SIZE	| PAYLOAD			| CRC		|
+	 * | 0xFA        | 0x00-0x05    | 0x00-0x05 			| -- 						| -- 					|	--		|
+	 */
+
+	size = uart_module->peek(span);
+	parseBlock(span.first, span.first_size);
+	parseBlock(span.second, span.second_size);
+	uart_module->consume(size);
+}
+
+
+
+/**
+  * @brief 		Runs the frame parser over a block, the payload is copied at once
+  *
+  * @param[in]	const uint8_t data[]
+  * @param[in]	uint32_t size
+  *
+  * @return 	void
+  */
+void TELEMETRY_ROUTER::parseBlock(const uint8_t data[], uint32_t size)
+{
+	uint32_t index = 0;
+	uint32_t count = 0;
+
+	while(index < size)
+	{
+		switch(state)
+		{
+			case parser_state_type::HEADER:
+				if(data[index] == TELEMETRY_HEADER)
+				{
+					state = parser_state_type::SOURCE_ID;
+				}
+				break;
+
+			case parser_state_type::SOURCE_ID:
+			case parser_state_type::DESTINATION_ID:
+				if(data[index] > static_cast<uint8_t>(telemetry_id_type::PDB))
+				{
+					state = parser_state_type::HEADER;	///< Not a frame start, an id byte can not be larger
+				}
+				else if(state == parser_state_type::SOURCE_ID)
+				{
+					frame[0] = data[index];
+					state	 = parser_state_type::DESTINATION_ID;
+				}
+				else
+				{
+					frame[1] = data[index];
+					state	 = parser_state_type::PAYLOAD_SIZE_1;
+				}
+				break;
+
+			case parser_state_type::PAYLOAD_SIZE_1:
+				frame[2] = data[index];
+				state	 = parser_state_type::PAYLOAD_SIZE_2;
+				break;
+
+			case parser_state_type::PAYLOAD_SIZE_2:
+				frame[3]		= data[index];
+				length			= static_cast<uint16_t>(frame[2]) | (static_cast<uint16_t>(frame[3]) << 8);
+				payload_counter = 0;
+				if(length > ROUTER_MAXIMUM_PAYLOAD_SIZE)
+				{
+					length_error_counter++;
+					state = parser_state_type::HEADER;
+				}
+				else
+				{
+					state = (length == 0) ? parser_state_type::CRC_1 : parser_state_type::PAYLOAD;
+				}
+				break;
+
+			case parser_state_type::PAYLOAD:
+				count = std::min(static_cast<uint32_t>(length - payload_counter), size - index);
+				std::memcpy(&frame[4 + payload_counter], &data[index], count);
+				payload_counter += count;
+				index			+= count - 1;
+				if(payload_counter >= length)
+				{
+					state = parser_state_type::CRC_1;
+				}
+				break;
+
+			case parser_state_type::CRC_1:
+				frame[4 + length] = data[index];
+				state			  = parser_state_type::CRC_2;
+				break;
+
+			case parser_state_type::CRC_2:
+				frame[5 + length] = data[index];
+				if(checkFrameCrc(frame, 4 + length) == true)
+				{
+					dispatchFrame();
+				}
+				else
+				{
+					crc_error_counter++;
+				}
+				state = parser_state_type::HEADER;
+				break;
+
+			default:
+				state = parser_state_type::HEADER;
+				break;
+		}
+		index++;
+	}
+}
+
+
+
+/**
+  * @brief 		Gives a checked frame to the endpoint of its source and destination id
+  *
+  * @param[in]	void
+  *
+  * @return 	void
+  */
+void TELEMETRY_ROUTER::dispatchFrame(void)
+{
+	uint8_t index = 0;
+
+	frame_counter++;
+	for(index = 0; index < endpoint_number; index++)
+	{
+		if( (endpoint_table[index].source_id == frame[0]) && (endpoint_table[index].destination_id == frame[1]) )
+		{
+			endpoint_table[index].frame_counter++;
+			endpoint_table[index].endpoint->processPayloadPacket(&frame[4], length);
+			return;
+		}
+	}
+
+	unrouted_counter++;
+}
+
+
+
+/**
+  * @brief Default copy constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+TELEMETRY_ROUTER::TELEMETRY_ROUTER(const TELEMETRY_ROUTER &orig) :
+uart_module(orig.uart_module),
+endpoint_table{},
+endpoint_number(0),
+state(parser_state_type::HEADER),
+length(0),
+payload_counter(0),
+frame{}
+{ }
+
+
+
+/**
+  * @brief Default destructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+TELEMETRY_ROUTER::~TELEMETRY_ROUTER()
+{
+}
+
+
+
+} /* End of namespace Telemetry */
@@ -0,0 +1,139 @@
+/**
+ ******************************************************************************
+  * @file		: ds_telemetry_router.hpp
+  * @brief		: Telemetry router header file
+  *				  This file contains the single frame parser of a link shared by several telemetry endpoints
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+#ifndef DS_TELEMETRY_ROUTER_HPP
+#define	DS_TELEMETRY_ROUTER_HPP
+
+
+
+/*
+ * Begin of Includes
+ */
+#include <stdint.h>
+#include "ds_telemetry_gcs.hpp"
+// End of Includes
+
+
+
+namespace Telemetry
+{
+
+
+
+/*
+ * Begin of Macro Definitions
+ */
+const uint8_t  ROUTER_MAXIMUM_ENDPOINT_NUMBER	= 8;
+const uint16_t ROUTER_MAXIMUM_PAYLOAD_SIZE		= 512;		///< Same limit as the payload buffer of TELEMETRY
+//End of Macro Definitions
+
+
+
+/*
+ * Begin of Enum, Union and Struct Definitions
+ */
+struct router_endpoint_type
+{
+	TELEMETRY			*endpoint;
+	uint8_t				 source_id;
+	uint8_t				 destination_id;
+	uint32_t			 frame_counter;		///< Frames delivered to the endpoint
+};
+// End of Enum, Union and Struct Definitions
+
+
+
+/*
+ * Begin of TELEMETRY_ROUTER Class Definition
+ */
+/**
+ * @brief One frame parser per physical link. The header and the CRC of a frame are checked
+ *		  once, then the payload is given to the endpoint registered for its source and
+ *		  destination id. Registered endpoints stop draining the link themselves.
+ */
+class TELEMETRY_ROUTER
+{
+	public:
+		explicit TELEMETRY_ROUTER(Peripherals::Uart::H747_UART *uart_module);
+
+		bool	 registerEndpoint	(TELEMETRY *endpoint);
+		uint32_t getFrameCounter	(telemetry_id_type source_id, telemetry_id_type destination_id) const;
+
+		void scheduler(void);
+		void parseReceivedData(void);
+
+		uint32_t frame_counter			= 0;
+		uint32_t crc_error_counter		= 0;
+		uint32_t length_error_counter	= 0;
+		uint32_t unrouted_counter		= 0;	///< Valid frames without a registered endpoint
+
+		TELEMETRY_ROUTER(const TELEMETRY_ROUTER &orig);
+		virtual ~TELEMETRY_ROUTER();
+
+	protected:
+
+	private:
+		enum class parser_state_type : uint8_t
+		{
+			HEADER = 0,
+			SOURCE_ID = 1,
+			DESTINATION_ID = 2,
+			PAYLOAD_SIZE_1 = 3,
+			PAYLOAD_SIZE_2 = 4,
+			PAYLOAD = 5,
+			CRC_1 = 6,
+			CRC_2 = 7,
+		};
+
+		Peripherals::Uart::H747_UART *uart_module;
+		router_endpoint_type endpoint_table[ROUTER_MAXIMUM_ENDPOINT_NUMBER];
+		uint8_t				 endpoint_number;
+
+		parser_state_type	 state;
+		uint16_t			 length;
+		uint16_t			 payload_counter;
+		uint8_t				 frame[4 + ROUTER_MAXIMUM_PAYLOAD_SIZE + 2];	///< Ids, size, payload and CRC, the CRC covers everything before it
+
+		void parseBlock		(const uint8_t data[], uint32_t size);
+		void dispatchFrame	(void);
+};
+// End of TELEMETRY_ROUTER Class Definition
+
+
+
+} /* End of namespace Telemetry */
+
+
+
+/*
+ * External Linkages
+ */
+extern Telemetry::TELEMETRY_ROUTER uart3_router;
+// End of External Linkages
+
+
+#endif	/* DS_TELEMETRY_ROUTER_HPP */
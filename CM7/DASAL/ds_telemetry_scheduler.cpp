@@ -0,0 +1,337 @@
+/**
+ ******************************************************************************
+  * @file		: ds_telemetry_scheduler.cpp
+  * @brief		: Telemetry scheduler source file
+  *				  This file contains the bandwidth budgeted rate scheduler of the message streams of a link
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+
+/*
+ * Begin of Includes
+ */
+#include "ds_telemetry_scheduler.hpp"
+// End of Includes
+
+
+
+/*
+ * Begin of Object Definitions
+ */
+Telemetry::TELEMETRY_SCHEDULER uart3_telemetry_scheduler(&uart3);	///< Streams of the endpoints which share uart3
+//End of Object Definitions
+
+
+
+namespace Telemetry
+{
+
+
+
+/**
+  * @brief Default constructor
+  *
+  * @param[in]  Peripherals::Uart::H747_UART *uart_module : Link of the streams
+  *
+  * @return 	void
+  */
+TELEMETRY_SCHEDULER::TELEMETRY_SCHEDULER(Peripherals::Uart::H747_UART *uart_module) :
+uart_module(uart_module),
+stream_table{},
+stream_number(0),
+window_counter(0)
+{ }
+
+
+
+/**
+  * @brief 		Adds a message stream, the table is kept sorted by priority in registration order
+  *
+  * @param[in]  const char *name
+  * @param[in]  uint16_t rate_hz				 : Target rate, 0 for a message sent on request
+  * @param[in]  stream_priority_type priority
+  * @param[in]  uint16_t frame_size			 : Bytes on the wire
+  * @param[in]  bool (*send)(void *context)	 : Builds and sends one frame
+  * @param[in]  void *context
+  *
+  * @return 	bool : false if the table is full, the rate is above TELEMETRY_SCHEDULER_RATE_HZ
+  *					   or the frame does not fit into the transmit ring
+  *
+  * Example:
+  * @code
+  * uart3_telemetry_scheduler.addStream("gcs_heartbeat", 1, stream_priority_type::CRITICAL, 21, sendHeartbeat, nullptr);
+  * @endcode
+  */
+bool TELEMETRY_SCHEDULER::addStream(const char *name, uint16_t rate_hz, stream_priority_type priority, uint16_t frame_size,
+									bool (*send)(void *context), void *context)
+{
+	telemetry_stream_type entry = {};
+	uint8_t				  index = stream_number;
+
+	if( (send == nullptr) || (stream_number >= TELEMETRY_MAXIMUM_STREAM_NUMBER) || (rate_hz > TELEMETRY_SCHEDULER_RATE_HZ) ||
+		(frame_size == 0) || (frame_size > Peripherals::Uart::UART_BUFFER_SIZE) )
+	{
+		return false;
+	}
+
+	entry.name		 = name;
+	entry.send		 = send;
+	entry.context	 = context;
+	entry.rate_hz	 = rate_hz;
+	entry.frame_size = frame_size;
+	entry.priority	 = priority;
+
+	while( (index > 0) && (stream_table[index - 1].priority > priority) )
+	{
+		stream_table[index] = stream_table[index - 1];
+		index--;
+	}
+	stream_table[index] = entry;
+	stream_number++;
+
+	return true;
+}
+
+
+
+/**
+  * @brief 		Marks a frame of a stream to be sent when the link has capacity for it, more requests
+  *				before that send one frame
+  *
+  * @param[in]  bool (*send)(void *context) : send function and context given to addStream
+  * @param[in]  void *context
+  *
+  * @return 	bool : false if no such stream is registered
+  */
+bool TELEMETRY_SCHEDULER::request(bool (*send)(void *context), void *context)
+{
+	uint8_t index = 0;
+
+	for(index = 0; index < stream_number; index++)
+	{
+		if( (stream_table[index].send == send) && (stream_table[index].context == context) )
+		{
+			stream_table[index].pending = true;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+
+/**
+  * @brief 		Runs at TELEMETRY_SCHEDULER_RATE_HZ. Marks the periodic frames which are due and sends
+  *				the pending frames, CRITICAL first, while their priority fits into the link budget.
+  *				A frame held back stays pending, the periods it misses meanwhile are counted.
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void TELEMETRY_SCHEDULER::service(void)
+{
+	uint16_t queued = getQueuedBytes();
+	uint8_t	 index	= 0;
+
+	for(index = 0; index < stream_number; index++)
+	{
+		telemetry_stream_type &stream = stream_table[index];
+
+		if(stream.rate_hz != 0)
+		{
+			stream.credit += stream.rate_hz;
+			if(stream.credit >= TELEMETRY_SCHEDULER_RATE_HZ)
+			{
+				stream.credit -= TELEMETRY_SCHEDULER_RATE_HZ;
+				if(stream.pending == true)
+				{
+					stream.skipped_counter++;
+				}
+				stream.pending = true;
+			}
+		}
+
+		if(stream.pending == false)
+		{
+			continue;
+		}
+
+		if( (queued > getQueueLimit(stream.priority)) || (uart_module->isTransmitSaturated(stream.frame_size) == true) )
+		{
+			stream.deferred_counter++;
+			continue;
+		}
+
+		stream.pending = false;
+		if(stream.send(stream.context) == true)
+		{
+			stream.sent_counter++;
+			queued = getQueuedBytes();
+		}
+		else
+		{
+			stream.drop_counter++;
+		}
+	}
+
+	updateAchievedRates();
+}
+
+
+
+/**
+  * @brief 		Returns the time until a frame written now starts on the wire
+  *
+  * @param[in]  void
+  *
+  * @return 	uint32_t : Microseconds at the configured baud rate
+  */
+uint32_t TELEMETRY_SCHEDULER::getQueueDelay_us(void) const
+{
+	const uint32_t bytes_per_second = getLinkBytesPerSecond();
+
+	if(bytes_per_second == 0)
+	{
+		return 0;
+	}
+
+	return static_cast<uint32_t>( (static_cast<uint64_t>(getQueuedBytes()) * 1000000) / bytes_per_second );
+}
+
+
+
+uint8_t TELEMETRY_SCHEDULER::getStreamNumber(void) const
+{
+	return stream_number;
+}
+
+
+
+/**
+  * @brief 		Returns a stream with its counters and achieved rate, e.g. for a report
+  *
+  * @param[in]  uint8_t index
+  *
+  * @return 	const telemetry_stream_type* : nullptr if index is not below getStreamNumber()
+  */
+const telemetry_stream_type* TELEMETRY_SCHEDULER::getStream(uint8_t index) const
+{
+	return ( index < stream_number ) ? &stream_table[index] : nullptr;
+}
+
+
+
+/**
+  * @brief 		Bytes in the transmit ring, from every endpoint of the link
+  */
+uint16_t TELEMETRY_SCHEDULER::getQueuedBytes(void) const
+{
+	return static_cast<uint16_t>(Peripherals::Uart::UART_BUFFER_SIZE - uart_module->getTransmitSpace());
+}
+
+
+
+/**
+  * @brief 		Link capacity at the baud rate the UART is configured with, follows changeBaudRate
+  */
+uint32_t TELEMETRY_SCHEDULER::getLinkBytesPerSecond(void) const
+{
+	return uart_module->getHandle()->Init.BaudRate / UART_BITS_PER_BYTE;
+}
+
+
+
+/**
+  * @brief 		Largest queue a frame of the priority may be added to
+  */
+uint16_t TELEMETRY_SCHEDULER::getQueueLimit(stream_priority_type priority) const
+{
+	switch(priority)
+	{
+		case stream_priority_type::NORMAL:
+			return static_cast<uint16_t>( (getLinkBytesPerSecond() * NORMAL_STREAM_QUEUE_DELAY_MS) / 1000 );
+
+		case stream_priority_type::LOW:
+			return static_cast<uint16_t>( (getLinkBytesPerSecond() * LOW_STREAM_QUEUE_DELAY_MS) / 1000 );
+
+		case stream_priority_type::CRITICAL:
+		default:
+			return Peripherals::Uart::UART_BUFFER_SIZE;
+	}
+}
+
+
+
+/**
+  * @brief 		Closes the one second window of the achieved rates
+  */
+void TELEMETRY_SCHEDULER::updateAchievedRates(void)
+{
+	uint8_t index = 0;
+
+	if(++window_counter < TELEMETRY_SCHEDULER_RATE_HZ)
+	{
+		return;
+	}
+
+	for(index = 0; index < stream_number; index++)
+	{
+		stream_table[index].achieved_rate_hz = stream_table[index].sent_counter;
+		stream_table[index].sent_counter	 = 0;
+	}
+	window_counter = 0;
+}
+
+
+
+/**
+  * @brief Default copy constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+TELEMETRY_SCHEDULER::TELEMETRY_SCHEDULER(const TELEMETRY_SCHEDULER &orig) :
+uart_module(orig.uart_module),
+stream_table{},
+stream_number(0),
+window_counter(0)
+{ }
+
+
+
+/**
+  * @brief Default destructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+TELEMETRY_SCHEDULER::~TELEMETRY_SCHEDULER()
+{
+}
+
+
+
+} /* End of namespace Telemetry */
@@ -0,0 +1,162 @@
+/**
+ ******************************************************************************
+  * @file		: ds_telemetry_scheduler.hpp
+  * @brief		: Telemetry scheduler header file
+  *				  This file contains the bandwidth budgeted rate scheduler of the message streams of a link
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+#ifndef DS_TELEMETRY_SCHEDULER_HPP
+#define	DS_TELEMETRY_SCHEDULER_HPP
+
+
+
+/*
+ * Begin of Includes
+ */
+#include <stdint.h>
+#include "ds_telemetry_gcs.hpp"
+// End of Includes
+
+
+
+namespace Telemetry
+{
+
+
+
+/*
+ * Begin of Macro Definitions
+ */
+const uint8_t  TELEMETRY_MAXIMUM_STREAM_NUMBER	= 24;
+const uint16_t TELEMETRY_SCHEDULER_RATE_HZ		= 100;		///< service() call rate, the highest stream rate
+const uint8_t  UART_BITS_PER_BYTE				= 10;		///< Start, 8 data and stop bit
+const uint16_t NORMAL_STREAM_QUEUE_DELAY_MS		= 40;		///< NORMAL frames wait until the queued bytes drain within this time
+const uint16_t LOW_STREAM_QUEUE_DELAY_MS		= 15;		///< LOW frames wait until the queued bytes drain within this time
+//End of Macro Definitions
+
+
+
+/*
+ * Begin of Enum, Union and Struct Definitions
+ */
+enum class stream_priority_type : uint8_t
+{
+	CRITICAL = 0,	///< Heartbeat and control, sent whenever the UART can take the frame
+	NORMAL = 1,
+	LOW = 2,		///< Degraded first, e.g. TELEMETRY_1HZ and calibration
+};
+
+struct telemetry_stream_type
+{
+	const char			*name;
+	bool				(*send)(void *context);	///< Builds and sends one frame, false if the link refused it
+	void				*context;
+	uint16_t			 rate_hz;				///< Target rate, 0 for a message sent on request
+	uint16_t			 frame_size;			///< Bytes on the wire, frame header and CRC included
+	stream_priority_type priority;
+	uint16_t			 credit;				///< rate_hz is added every service call, the frame is due at TELEMETRY_SCHEDULER_RATE_HZ
+	bool				 pending;				///< Due or requested, waits for link capacity
+	uint16_t			 sent_counter;			///< Frames sent in the current one second window
+	uint16_t			 achieved_rate_hz;		///< Frames sent in the last complete second
+	uint32_t			 deferred_counter;		///< Service calls which held a pending frame back for link capacity
+	uint32_t			 skipped_counter;		///< Periods lost because the frame of the previous one was still pending
+	uint32_t			 drop_counter;			///< Frames refused by the link
+};
+// End of Enum, Union and Struct Definitions
+
+
+
+/*
+ * Begin of TELEMETRY_SCHEDULER Class Definition
+ */
+/**
+ * @brief Sends the message streams of one link at their target rates within its capacity.
+ *		  The bytes queued in the transmit ring, written by every endpoint of the link, give
+ *		  the time until a new frame reaches the wire at the configured baud rate. CRITICAL
+ *		  frames only need the UART to take them, NORMAL and LOW frames wait until the queue drains
+ *		  below their delay limit, and an overloaded link degrades the LOW streams first.
+ *		  The scheduled lower priorities never queue more than their limit. A CRITICAL frame
+ *		  waits at most NORMAL_STREAM_QUEUE_DELAY_MS plus one frame only while nothing else
+ *		  queues more: the INS, MC and radar endpoints and the router write uart3 without
+ *		  this admission check, and a burst of CRITICAL frames can fill the ring, in which
+ *		  case the UART refuses the frame and it is counted as dropped.
+ */
+class TELEMETRY_SCHEDULER
+{
+	public:
+		explicit TELEMETRY_SCHEDULER(Peripherals::Uart::H747_UART *uart_module);
+
+		bool addStream(const char *name, uint16_t rate_hz, stream_priority_type priority, uint16_t frame_size,
+					   bool (*send)(void *context), void *context);
+
+		/**
+		 * @brief 		Adds the stream of a transmit message, the frame size comes from its descriptor
+		 *
+		 * @return 		bool : false if the table is full or the rate is above TELEMETRY_SCHEDULER_RATE_HZ
+		 */
+		template <typename descriptor_type>
+		bool addStream(const char *name, stream_priority_type priority, bool (*send)(void *context), void *context,
+					   uint16_t rate_hz = descriptor_type::RATE_HZ)
+		{
+			static_assert(descriptor_type::DIRECTION == message_direction_type::TRANSMIT, "Only transmit messages are streamed");
+
+			return addStream(name, rate_hz, priority, descriptor_type::PAYLOAD_SIZE + FRAME_SIZE_WITHOUT_PAYLOAD, send, context);
+		}
+
+		bool	 request				(bool (*send)(void *context), void *context);
+		void	 service				(void);
+		uint32_t getQueueDelay_us		(void) const;
+
+		uint8_t						 getStreamNumber	(void) const;
+		const telemetry_stream_type* getStream			(uint8_t index) const;
+
+		TELEMETRY_SCHEDULER(const TELEMETRY_SCHEDULER &orig);
+		virtual ~TELEMETRY_SCHEDULER();
+
+	private:
+		Peripherals::Uart::H747_UART *uart_module;
+		telemetry_stream_type stream_table[TELEMETRY_MAXIMUM_STREAM_NUMBER];	///< Sorted by priority, CRITICAL first
+		uint8_t				  stream_number;
+		uint16_t			  window_counter;	///< Service calls in the current one second window
+
+		uint16_t getQueuedBytes		(void) const;
+		uint32_t getLinkBytesPerSecond(void) const;
+		uint16_t getQueueLimit		(stream_priority_type priority) const;
+		void	 updateAchievedRates(void);
+};
+// End of TELEMETRY_SCHEDULER Class Definition
+
+
+
+} /* End of namespace Telemetry */
+
+
+
+/*
+ * External Linkages
+ */
+extern Telemetry::TELEMETRY_SCHEDULER uart3_telemetry_scheduler;
+// End of External Linkages
+
+
+#endif	/* DS_TELEMETRY_SCHEDULER_HPP */
@@ -71,7 +71,7 @@ class BASE
 
 		virtual void 	 	initialize					(void) = 0;
 		virtual bool 	 	changeBaudRate 			(uint32_t baudrate) = 0;
-		virtual void 	 	sendData						(uint8_t buffer[], uint16_t size) = 0;
+		virtual bool 	 	sendData						(uint8_t buffer[], uint16_t size) = 0;
 		virtual uint16_t getDataFromBuffer	(uint8_t buffer[], uint16_t size_limit) = 0;
 
 		virtual void receiveByte	(uint8_t buffer)=0;
@@ -30,8 +30,10 @@
 /*
  * Begin of Includes
  */
+#include <new>
 #include "ds_uart_h747.hpp"
 #include "ds_sbus2.hpp"
+#include "ds_cache_h747.hpp"
 // End of Includes
 
 
@@ -52,6 +54,69 @@ Peripherals::Uart::H747_UART uart8  (Peripherals::Uart::uart_module_type::H747_U
 
 
 
+
+/**
+  * @brief 		Creates a ring in the UART DMA area of the AXI SRAM. The DMA transfers of the
+  *				rings get no cache maintenance, so the area has to be outside the cached memory.
+  *
+  * @param[in]  void
+  *
+  * @return 	uart_ring_type* : nullptr if the area is used up or cached
+  */
+static Peripherals::Uart::uart_ring_type* allocateDmaRing(void)
+{
+	static uint32_t next_address = Peripherals::Uart::UART_DMA_BUFFER_ADDR;
+	Peripherals::Uart::uart_ring_type *ring = nullptr;
+
+	if( ( (next_address + sizeof(Peripherals::Uart::uart_ring_type)) <= (Peripherals::Uart::UART_DMA_BUFFER_ADDR + Peripherals::Uart::UART_DMA_BUFFER_AREA_SIZE) ) &&
+		(cache.isCacheable(reinterpret_cast<const void *>(next_address)) == false) )
+	{
+		ring		  = new (reinterpret_cast<void *>(next_address)) Peripherals::Uart::uart_ring_type();
+		next_address += (sizeof(Peripherals::Uart::uart_ring_type) + 3U) & ~3U;
+	}
+
+	return ring;
+}
+
+
+
+/**
+  * @brief 		Reads one byte out of the receive FIFO
+  *
+  * @param[in]  USART_TypeDef *usart
+  *
+  * @return 	uint8_t
+  */
+static inline uint8_t readReceiveData(USART_TypeDef *usart)
+{
+#ifdef DS_SIMULATION
+	return simulateReceiveRegister(usart);
+#else
+	return static_cast<uint8_t>(READ_REG(usart->RDR));
+#endif
+}
+
+
+
+/**
+  * @brief 		Writes one byte into the transmit FIFO
+  *
+  * @param[in]  USART_TypeDef *usart
+  * @param[in]  uint8_t data
+  *
+  * @return 	void
+  */
+static inline void writeTransmitData(USART_TypeDef *usart, uint8_t data)
+{
+#ifdef DS_SIMULATION
+	simulateTransmitRegister(usart, data);
+#else
+	WRITE_REG(usart->TDR, data);
+#endif
+}
+
+
+
 /*
  * Begin of Private Interrupt Callback Functions
  */
@@ -70,36 +135,9 @@ extern "C"
   */
 static void DS_USART1_InterruptCallback(UART_HandleTypeDef *huart)
 {
-	uint32_t isrflags   		 	 = READ_REG(huart->Instance->ISR);
-	uint32_t cr1its     			 = READ_REG(huart->Instance->CR1);
-	uint32_t cr3its     			 = READ_REG(huart->Instance->CR3);
-	uint8_t  received_data 			 = 0;
-
-	bool	 is_transmit_in_progress = false;
-
-    if ( ( (isrflags & USART_ISR_RXNE_RXFNE) != 0U)     &&
-    	 ( ( (cr1its & USART_CR1_RXNEIE_RXFNEIE) != 0U) ||
-    	   ( (cr3its & USART_CR3_RXFTIE) != 0U)
-		 )
-	   )
-    {
-    	received_data = (uint8_t) READ_REG(huart->Instance->RDR);
-    	uart1.receiveByte(received_data);
-    }
+	UNUSED(huart);
 
-
-    if ( ( (isrflags & USART_ISR_TXE_TXFNF) != 0U)     &&
-    	 ( ( (cr1its & USART_CR1_TXEIE_TXFNFIE) != 0U) ||
-    	   ( (cr3its & USART_CR3_TXFTIE) != 0U)
-		 )
-	   )
-	{
-    	is_transmit_in_progress = uart1.transmit();
-    	if(is_transmit_in_progress == false)
-    	{
-  	      CLEAR_BIT(huart->Instance->CR1, USART_CR1_TXEIE_TXFNFIE);
-    	}
-	}
+	uart1.interruptHandler();
 }
 
 /**
@@ -111,36 +149,9 @@ static void DS_USART1_InterruptCallback(UART_HandleTypeDef *huart)
   */
 static void DS_USART2_InterruptCallback(UART_HandleTypeDef *huart)
 {
-	uint32_t isrflags   		 	 = READ_REG(huart->Instance->ISR);
-	uint32_t cr1its     			 = READ_REG(huart->Instance->CR1);
-	uint32_t cr3its     			 = READ_REG(huart->Instance->CR3);
-	uint8_t  received_data 			 = 0;
-
-	bool	 is_transmit_in_progress = false;
+	UNUSED(huart);
 
-    if ( ( (isrflags & USART_ISR_RXNE_RXFNE) != 0U)     &&
-    	 ( ( (cr1its & USART_CR1_RXNEIE_RXFNEIE) != 0U) ||
-    	   ( (cr3its & USART_CR3_RXFTIE) != 0U)
-		 )
-	   )
-    {
-    	received_data = (uint8_t) READ_REG(huart->Instance->RDR);
-    	uart2.receiveByte(received_data);
-    }
-
-
-    if ( ( (isrflags & USART_ISR_TXE_TXFNF) != 0U)     &&
-    	 ( ( (cr1its & USART_CR1_TXEIE_TXFNFIE) != 0U) ||
-    	   ( (cr3its & USART_CR3_TXFTIE) != 0U)
-		 )
-	   )
-	{
-    	is_transmit_in_progress = uart2.transmit();
-    	if(is_transmit_in_progress == false)
-    	{
-  	      CLEAR_BIT(huart->Instance->CR1, USART_CR1_TXEIE_TXFNFIE);
-    	}
-	}
+	uart2.interruptHandler();
 }
 
 /**
@@ -152,36 +163,9 @@ static void DS_USART2_InterruptCallback(UART_HandleTypeDef *huart)
   */
 static void DS_USART3_InterruptCallback(UART_HandleTypeDef *huart)
 {
-	uint32_t isrflags   		 	 = READ_REG(huart->Instance->ISR);
-	uint32_t cr1its     			 = READ_REG(huart->Instance->CR1);
-	uint32_t cr3its     			 = READ_REG(huart->Instance->CR3);
-	uint8_t  received_data 			 = 0;
-
-	bool	 is_transmit_in_progress = false;
-
-    if ( ( (isrflags & USART_ISR_RXNE_RXFNE) != 0U)     &&
-    	 ( ( (cr1its & USART_CR1_RXNEIE_RXFNEIE) != 0U) ||
-    	   ( (cr3its & USART_CR3_RXFTIE) != 0U)
-		 )
-	   )
-    {
-    	received_data = (uint8_t) READ_REG(huart->Instance->RDR);
-    	uart3.receiveByte(received_data);
-    }
-
+	UNUSED(huart);
 
-    if ( ( (isrflags & USART_ISR_TXE_TXFNF) != 0U)     &&
-    	 ( ( (cr1its & USART_CR1_TXEIE_TXFNFIE) != 0U) ||
-    	   ( (cr3its & USART_CR3_TXFTIE) != 0U)
-		 )
-	   )
-	{
-    	is_transmit_in_progress = uart3.transmit();
-    	if(is_transmit_in_progress == false)
-    	{
-  	      CLEAR_BIT(huart->Instance->CR1, USART_CR1_TXEIE_TXFNFIE);
-    	}
-	}
+	uart3.interruptHandler();
 }
 
 /**
@@ -193,36 +177,9 @@ static void DS_USART3_InterruptCallback(UART_HandleTypeDef *huart)
   */
 static void DS_USART4_InterruptCallback(UART_HandleTypeDef *huart)
 {
-	uint32_t isrflags   		 	 = READ_REG(huart->Instance->ISR);
-	uint32_t cr1its     			 = READ_REG(huart->Instance->CR1);
-	uint32_t cr3its     			 = READ_REG(huart->Instance->CR3);
-	uint8_t  received_data 			 = 0;
-
-	bool	 is_transmit_in_progress = false;
+	UNUSED(huart);
 
-    if ( ( (isrflags & USART_ISR_RXNE_RXFNE) != 0U)     &&
-    	 ( ( (cr1its & USART_CR1_RXNEIE_RXFNEIE) != 0U) ||
-    	   ( (cr3its & USART_CR3_RXFTIE) != 0U)
-		 )
-	   )
-    {
-    	received_data = (uint8_t) READ_REG(huart->Instance->RDR);
-    	uart4.receiveByte(received_data);
-    }
-
-
-    if ( ( (isrflags & USART_ISR_TXE_TXFNF) != 0U)     &&
-    	 ( ( (cr1its & USART_CR1_TXEIE_TXFNFIE) != 0U) ||
-    	   ( (cr3its & USART_CR3_TXFTIE) != 0U)
-		 )
-	   )
-	{
-    	is_transmit_in_progress = uart4.transmit();
-    	if(is_transmit_in_progress == false)
-    	{
-  	      CLEAR_BIT(huart->Instance->CR1, USART_CR1_TXEIE_TXFNFIE);
-    	}
-	}
+	uart4.interruptHandler();
 }
 
 /**
@@ -234,36 +191,9 @@ static void DS_USART4_InterruptCallback(UART_HandleTypeDef *huart)
   */
 static void DS_USART5_InterruptCallback(UART_HandleTypeDef *huart)
 {
-	uint32_t isrflags   		 	 = READ_REG(huart->Instance->ISR);
-	uint32_t cr1its     			 = READ_REG(huart->Instance->CR1);
-	uint32_t cr3its     			 = READ_REG(huart->Instance->CR3);
-	uint8_t  received_data 			 = 0;
-
-	bool	 is_transmit_in_progress = false;
-
-    if ( ( (isrflags & USART_ISR_RXNE_RXFNE) != 0U)     &&
-    	 ( ( (cr1its & USART_CR1_RXNEIE_RXFNEIE) != 0U) ||
-    	   ( (cr3its & USART_CR3_RXFTIE) != 0U)
-		 )
-	   )
-    {
-    	received_data = (uint8_t) READ_REG(huart->Instance->RDR);
-    	uart5.receiveByte(received_data);
-    }
-
+	UNUSED(huart);
 
-    if ( ( (isrflags & USART_ISR_TXE_TXFNF) != 0U)     &&
-    	 ( ( (cr1its & USART_CR1_TXEIE_TXFNFIE) != 0U) ||
-    	   ( (cr3its & USART_CR3_TXFTIE) != 0U)
-		 )
-	   )
-	{
-    	is_transmit_in_progress = uart5.transmit();
-    	if(is_transmit_in_progress == false)
-    	{
-  	      CLEAR_BIT(huart->Instance->CR1, USART_CR1_TXEIE_TXFNFIE);
-    	}
-	}
+	uart5.interruptHandler();
 }
 
 /**
@@ -275,36 +205,9 @@ static void DS_USART5_InterruptCallback(UART_HandleTypeDef *huart)
   */
 static void DS_USART6_InterruptCallback(UART_HandleTypeDef *huart)
 {
-	uint32_t isrflags   		 	 = READ_REG(huart->Instance->ISR);
-	uint32_t cr1its     			 = READ_REG(huart->Instance->CR1);
-	uint32_t cr3its     			 = READ_REG(huart->Instance->CR3);
-	uint8_t  received_data 			 = 0;
-
-	bool	 is_transmit_in_progress = false;
-
-    if ( ( (isrflags & USART_ISR_RXNE_RXFNE) != 0U)     &&
-    	 ( ( (cr1its & USART_CR1_RXNEIE_RXFNEIE) != 0U) ||
-    	   ( (cr3its & USART_CR3_RXFTIE) != 0U)
-		 )
-	   )
-    {
-    	received_data = (uint8_t) READ_REG(huart->Instance->RDR);
-    	uart6.receiveByte(received_data);
-    }
+	UNUSED(huart);
 
-
-    if ( ( (isrflags & USART_ISR_TXE_TXFNF) != 0U)     &&
-    	 ( ( (cr1its & USART_CR1_TXEIE_TXFNFIE) != 0U) ||
-    	   ( (cr3its & USART_CR3_TXFTIE) != 0U)
-		 )
-	   )
-	{
-    	is_transmit_in_progress = uart6.transmit();
-    	if(is_transmit_in_progress == false)
-    	{
-  	      CLEAR_BIT(huart->Instance->CR1, USART_CR1_TXEIE_TXFNFIE);
-    	}
-	}
+	uart6.interruptHandler();
 }
 
 
@@ -317,36 +220,9 @@ static void DS_USART6_InterruptCallback(UART_HandleTypeDef *huart)
   */
 static void DS_USART7_InterruptCallback(UART_HandleTypeDef *huart)
 {
-	uint32_t isrflags   		 	 = READ_REG(huart->Instance->ISR);
-	uint32_t cr1its     			 = READ_REG(huart->Instance->CR1);
-	uint32_t cr3its     			 = READ_REG(huart->Instance->CR3);
-	uint8_t  received_data 			 = 0;
-
-	bool	 is_transmit_in_progress = false;
+	UNUSED(huart);
 
-    if ( ( (isrflags & USART_ISR_RXNE_RXFNE) != 0U)     &&
-    	 ( ( (cr1its & USART_CR1_RXNEIE_RXFNEIE) != 0U) ||
-    	   ( (cr3its & USART_CR3_RXFTIE) != 0U)
-		 )
-	   )
-    {
-    	received_data = (uint8_t) READ_REG(huart->Instance->RDR);
-    	uart7.receiveByte(received_data);
-    }
-
-
-    if ( ( (isrflags & USART_ISR_TXE_TXFNF) != 0U)     &&
-    	 ( ( (cr1its & USART_CR1_TXEIE_TXFNFIE) != 0U) ||
-    	   ( (cr3its & USART_CR3_TXFTIE) != 0U)
-		 )
-	   )
-	{
-    	is_transmit_in_progress = uart7.transmit();
-    	if(is_transmit_in_progress == false)
-    	{
-  	      CLEAR_BIT(huart->Instance->CR1, USART_CR1_TXEIE_TXFNFIE);
-    	}
-	}
+	uart7.interruptHandler();
 }
 
 /**
@@ -358,37 +234,21 @@ static void DS_USART7_InterruptCallback(UART_HandleTypeDef *huart)
   */
 static void DS_USART8_InterruptCallback(UART_HandleTypeDef *huart)
 {
-	uint32_t isrflags   		 	 = READ_REG(huart->Instance->ISR);
-	uint32_t cr1its     			 = READ_REG(huart->Instance->CR1);
-	uint32_t cr3its     			 = READ_REG(huart->Instance->CR3);
-	uint8_t  received_data 			 = 0;
-
-	bool	 is_transmit_in_progress = false;
-
-    if ( ( (isrflags & USART_ISR_RXNE_RXFNE) != 0U)     &&
-    	 ( ( (cr1its & USART_CR1_RXNEIE_RXFNEIE) != 0U) ||
-    	   ( (cr3its & USART_CR3_RXFTIE) != 0U)
-		 )
-	   )
-    {
-    	received_data = (uint8_t) READ_REG(huart->Instance->RDR);
-    	//uart8.receiveByte(received_data);
-    	sbus.receiveInterruptHandler(received_data);
-    }
+	UNUSED(huart);
 
+	uart8.interruptHandler();
+}
 
-    if ( ( (isrflags & USART_ISR_TXE_TXFNF) != 0U)     &&
-    	 ( ( (cr1its & USART_CR1_TXEIE_TXFNFIE) != 0U) ||
-    	   ( (cr3its & USART_CR3_TXFTIE) != 0U)
-		 )
-	   )
-	{
-    	is_transmit_in_progress = uart8.transmit();
-    	if(is_transmit_in_progress == false)
-    	{
-  	      CLEAR_BIT(huart->Instance->CR1, USART_CR1_TXEIE_TXFNFIE);
-    	}
-	}
+/**
+  * @brief 		USART8 received bytes, they go to the SBUS2 decoder instead of the ring
+  *
+  * @param[in]  uint8_t data
+  *
+  * @return 	void
+  */
+static void DS_USART8_ReceiveCallback(uint8_t data)
+{
+	sbus.receiveInterruptHandler(data);
 }
 
 
@@ -401,35 +261,51 @@ static void DS_USART8_InterruptCallback(UART_HandleTypeDef *huart)
   */
 static void DS_LPUSART1_InterruptCallback(UART_HandleTypeDef *huart)
 {
-	uint32_t isrflags   		 	 = READ_REG(huart->Instance->ISR);
-	uint32_t cr1its     			 = READ_REG(huart->Instance->CR1);
-	uint32_t cr3its     			 = READ_REG(huart->Instance->CR3);
-	uint8_t  received_data 			 = 0;
+	UNUSED(huart);
 
-	bool	 is_transmit_in_progress = false;
+	lpuart1.interruptHandler();
+}
 
-    if ( ( (isrflags & USART_ISR_RXNE_RXFNE) != 0U)     &&
-    	 ( ( (cr1its & USART_CR1_RXNEIE_RXFNEIE) != 0U) ||
-    	   ( (cr3its & USART_CR3_RXFTIE) != 0U)
-		 )
-	   )
-    {
-    	received_data = (uint8_t) READ_REG(huart->Instance->RDR);
-    	lpuart1.receiveByte(received_data);
-    }
+/**
+  * @brief 		IDLE line interrupt of the DMA or FIFO reception and transfer complete interrupt
+  *				of the DMA transmission. It is called from the UART IRQ handlers before
+  *				HAL_UART_IRQHandler, which does not clear IDLE and would end the transfer on TC.
+  *
+  * @param[in]  UART_HandleTypeDef *huart : Uart Instance
+  *
+  * @return 	void
+  */
+void DS_UART_DmaInterruptHandler(UART_HandleTypeDef *huart)
+{
+	static Peripherals::Uart::H747_UART * const uart_list[] = { &lpuart1, &uart1, &uart2, &uart3, &uart4,
+																 &uart5,   &uart6, &uart7, &uart8 };
+	uint32_t isrflags = READ_REG(huart->Instance->ISR);
+	uint32_t cr1its	  = READ_REG(huart->Instance->CR1);
+	uint8_t  k		  = 0;
 
+	for(k = 0; k < (sizeof(uart_list) / sizeof(uart_list[0])); k++)
+	{
+		if(uart_list[k]->getHandle() == huart)
+		{
+			break;
+		}
+	}
+	if(k >= (sizeof(uart_list) / sizeof(uart_list[0])))
+	{
+		return;
+	}
 
-    if ( ( (isrflags & USART_ISR_TXE_TXFNF) != 0U)     &&
-    	 ( ( (cr1its & USART_CR1_TXEIE_TXFNFIE) != 0U) ||
-    	   ( (cr3its & USART_CR3_TXFTIE) != 0U)
-		 )
-	   )
+	if( ( (isrflags & USART_ISR_IDLE) != 0U ) && ( (cr1its & USART_CR1_IDLEIE) != 0U ) )
 	{
-    	is_transmit_in_progress = lpuart1.transmit();
-    	if(is_transmit_in_progress == false)
-    	{
-  	      CLEAR_BIT(huart->Instance->CR1, USART_CR1_TXEIE_TXFNFIE);
-    	}
+		__HAL_UART_CLEAR_IDLEFLAG(huart);
+		uart_list[k]->idleInterruptHandler();
+	}
+
+	if( ( (isrflags & USART_ISR_TC) != 0U ) && ( (cr1its & USART_CR1_TCIE) != 0U ) &&
+		( (READ_REG(huart->Instance->CR3) & USART_CR3_DMAT) != 0U ) )
+	{
+		__HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_TCF);
+		uart_list[k]->transmitCompleteHandler();
 	}
 }
 
@@ -481,9 +357,6 @@ void H747_UART::initialize(void)
 	uart_handle->RxXferCount = 1;
 	uart_handle->ErrorCode   = HAL_UART_ERROR_NONE;
 
-    SET_BIT(uart_handle->Instance->CR3, USART_CR3_EIE);
-    SET_BIT(uart_handle->Instance->CR1, USART_CR1_PEIE | USART_CR1_RXNEIE_RXFNEIE);
-
 	switch(uart_number)
 	{
 		case uart_module_type::H747_LPUART1 :
@@ -529,12 +402,31 @@ void H747_UART::initialize(void)
 		case uart_module_type::H747_UART8 :
 			uart_handle->RxISR = DS_USART8_InterruptCallback; ///< While interrupt routines are init, they are handled to ISR registers.
 			uart_handle->TxISR = DS_USART8_InterruptCallback; ///< While interrupt routines are init, they are handled to ISR registers.
+			receive_handler	   = DS_USART8_ReceiveCallback;
 			break;
 
 		default :
 			//Error
 			break;
 	}
+
+	fifo_enabled = enableFifo();
+
+	if(receive_dma_enabled == true)
+	{
+		startDmaReception();
+	}
+	else if( (fifo_enabled == true) && (receive_handler == nullptr) )
+	{
+	    __HAL_UART_CLEAR_IDLEFLAG(uart_handle);
+	    SET_BIT(uart_handle->Instance->CR3, USART_CR3_EIE | USART_CR3_RXFTIE);
+	    SET_BIT(uart_handle->Instance->CR1, USART_CR1_PEIE | USART_CR1_IDLEIE);	///< IDLE reads the bytes below the threshold
+	}
+	else
+	{
+	    SET_BIT(uart_handle->Instance->CR3, USART_CR3_EIE);	///< A receive handler, e.g. SBUS2 timing, wants every byte at once
+	    SET_BIT(uart_handle->Instance->CR1, USART_CR1_PEIE | USART_CR1_RXNEIE_RXFNEIE);
+	}
 }
 
 
@@ -553,13 +445,29 @@ void H747_UART::initialize(void)
 bool H747_UART::changeBaudRate(uint32_t baudrate)
 {
 	bool 	 change_baud_progress 		  = false;  ///< Returns the status of BaudRate Init.
-	uint8_t  change_baud_progress_counter  = 0;		///< It controls the 4 steps required for baudrate initiation.
+	uint8_t  change_baud_progress_counter  = 0;		///< It counts the failed steps of the baudrate initiation.
 
 	/* Clear Interrupt Flag*/
-	CLEAR_BIT(uart_handle->Instance->CR3, USART_CR3_EIE);
-	CLEAR_BIT(uart_handle->Instance->CR1, USART_CR1_PEIE | USART_CR1_RXNEIE_RXFNEIE);
+	CLEAR_BIT(uart_handle->Instance->CR3, USART_CR3_EIE | USART_CR3_RXFTIE | USART_CR3_TXFTIE);
+	CLEAR_BIT(uart_handle->Instance->CR1, USART_CR1_PEIE | USART_CR1_RXNEIE_RXFNEIE | USART_CR1_IDLEIE);
 	CLEAR_BIT(uart_handle->Instance->CR1, USART_CR1_TXEIE_TXFNFIE);
 
+	if(receive_dma_enabled == true)
+	{
+		CLEAR_BIT(uart_handle->Instance->CR3, USART_CR3_DMAR);
+		HAL_DMA_Abort(&receive_dma_handle);	///< Restarted by initialize()
+	}
+
+	if(transmit_dma_enabled == true)
+	{
+		CLEAR_BIT(uart_handle->Instance->CR1, USART_CR1_TCIE);
+		CLEAR_BIT(uart_handle->Instance->CR3, USART_CR3_DMAT);
+		HAL_DMA_Abort(&transmit_dma_handle);	///< Queued data is dropped, it was for the old baud rate
+		transmit_dma_active	= false;
+		transmit_queue_tail	= transmit_queue_head;
+		transmit_ring->flush();
+	}
+
 	HAL_UART_DeInit(uart_handle); ///<Reset Uart Flag, Pin Assign
 
 	/* Re-init according to the new baud value */
@@ -578,17 +486,11 @@ bool H747_UART::changeBaudRate(uint32_t baudrate)
 	 {
 		 change_baud_progress_counter++;
 	 }
-	 if (HAL_UARTEx_SetTxFifoThreshold(uart_handle, UART_TXFIFO_THRESHOLD_1_8) != HAL_OK)
-	 {
-		 change_baud_progress_counter++;
-	 }
 
-	 if (HAL_UARTEx_SetRxFifoThreshold(uart_handle, UART_RXFIFO_THRESHOLD_1_8) != HAL_OK)
-	 {
-		 change_baud_progress_counter++;
-	 }
+	 /*The init function of the related object is running, it enables the FIFO again.*/
+	 initialize();
 
-	 if (HAL_UARTEx_DisableFifoMode(uart_handle) != HAL_OK)
+	 if (fifo_enabled == false)
 	 {
 		 change_baud_progress_counter++;
 	 }
@@ -602,44 +504,190 @@ bool H747_UART::changeBaudRate(uint32_t baudrate)
 		 change_baud_progress = true;
 	 }
 
-	 /*The init function of the related object is running.*/
-	 initialize();
-
 	 return change_baud_progress;
 }
 
 
 
 /**
-  * @brief 		Transfers a byte from the corresponding serial line.
+  * @brief 		Copies the data into the transmit ring and starts the transmission, by the
+  *				transmit interrupt or by the DMA. Nothing is copied if the data does not fit.
   *
   * @param[in]  uint8_t buffer[]: The buffer entry to be sent.
   * @param[in]  uint16_t size   : The buffer size you want to send.
   *
-  * @return 	void	Nothing
+  * @return 	bool : false if the link is saturated, the caller may retry or drop the data
   *
   * Example:
   * @code
   * uart4.sendData(buffer, size);
   * @endcode
   */
-void H747_UART::sendData(uint8_t buffer[], uint16_t size)
+bool H747_UART::sendData(uint8_t buffer[], uint16_t size)
 {
-	uint16_t k = 0;
+	const uint16_t head = transmit_ring->getHead() & UART_BUFFER_SIZE_MASK;
 
-	for(k=0;k<size;k++)
+	if(size == 0)
 	{
-		transmit_buffer[ (transmit_head++) & UART_BUFFER_SIZE_MASK] = buffer[k];
+		return true;
 	}
-    SET_BIT(uart_handle->Instance->CR1, USART_CR1_TXEIE_TXFNFIE);
+
+	if(isTransmitSaturated(size) == true)
+	{
+		transmit_reject_counter++;
+		return false;
+	}
+
+	transmit_ring->pushBulk(buffer, size);
+	startTransmit(head, size);
+
+	return true;
 }
 
 
 
 /**
-  * @brief 		A function that reads one byte of data.
+  * @brief 		Gives contiguous free space of the transmit ring, so that a frame can be built
+  *				in place instead of being copied by sendData. Nothing is sent until commitTransmit.
+  *
+  * @param[in]  uint16_t size
+  *
+  * @return 	uint8_t* : nullptr if the link is saturated or the space wraps around the end of the
+  *					   ring, the caller builds the data elsewhere and uses sendData then
+  *
+  * Example:
+  * @code
+  * uint8_t *frame = uart4.reserveTransmit(size);
+  * ...
+  * uart4.commitTransmit(size);
+  * @endcode
+  */
+uint8_t* H747_UART::reserveTransmit(uint16_t size)
+{
+	const uint16_t head = transmit_ring->getHead() & UART_BUFFER_SIZE_MASK;
+
+	if( (size == 0) || ( (head + size) > UART_BUFFER_SIZE ) || (isTransmitSaturated(size) == true) )
+	{
+		return nullptr;
+	}
+
+	return &transmit_ring->getStorage()[head];
+}
+
+
+
+/**
+  * @brief 		Publishes the data written into the space given by reserveTransmit and starts the
+  *				transmission. Nothing else may be sent between the two calls.
+  *
+  * @param[in]  uint16_t size : At most the reserved size
+  *
+  * @return 	void
+  */
+void H747_UART::commitTransmit(uint16_t size)
+{
+	const uint16_t head = transmit_ring->getHead() & UART_BUFFER_SIZE_MASK;
+
+	if(size == 0)
+	{
+		return;
+	}
+
+	transmit_ring->commit(size);
+	startTransmit(head, size);
+}
+
+
+
+/**
+  * @brief 		Checks the transmit ring and, with the DMA, the descriptor queue which takes up to
+  *				two descriptors for the wrapped data
+  *
+  * @param[in]  uint16_t size
+  *
+  * @return 	bool : true if the data can not be taken now
+  */
+bool H747_UART::isTransmitSaturated(uint16_t size) const
+{
+	return (size > getTransmitSpace()) ||
+		   ( (transmit_dma_enabled == true) && ( static_cast<uint8_t>(transmit_queue_head - transmit_queue_tail) > (UART_TRANSMIT_QUEUE_SIZE - 2) ) );
+}
+
+
+
+/**
+  * @brief 		Starts sending the data which was just published at head of the transmit ring,
+  *				by the transmit interrupt or by the DMA
+  *
+  * @param[in]  uint16_t head : Ring index of the first byte
+  * @param[in]  uint16_t size
+  *
+  * @return 	void
+  */
+void H747_UART::startTransmit(uint16_t head, uint16_t size)
+{
+	uint8_t *storage	= transmit_ring->getStorage();
+	uint16_t first_size = size;
+
+	if( (head + size) > UART_BUFFER_SIZE )
+	{
+		first_size = UART_BUFFER_SIZE - head;
+	}
+
+	if(transmit_dma_enabled == true)
+	{
+		pushTransmitDescriptor(&storage[head], first_size);
+		if(size > first_size)
+		{
+			pushTransmitDescriptor(&storage[0], size - first_size);
+		}
+		startDmaTransmit();
+	}
+	else if(fifo_enabled == true)
+	{
+	    SET_BIT(uart_handle->Instance->CR3, USART_CR3_TXFTIE);
+	}
+	else
+	{
+	    SET_BIT(uart_handle->Instance->CR1, USART_CR1_TXEIE_TXFNFIE);
+	}
+}
+
+
+
+/**
+  * @brief 		Returns the free space of the transmit ring
+  *
+  * @param[in]  void
+  *
+  * @return 	uint16_t : Bytes which sendData can take at once
+  */
+uint16_t H747_UART::getTransmitSpace(void) const
+{
+	return static_cast<uint16_t>(transmit_ring->getSpace());
+}
+
+
+
+/**
+  * @brief 		Returns the number of received bytes dropped because the receive ring was full
+  *
+  * @param[in]  void
+  *
+  * @return 	uint32_t
+  */
+uint32_t H747_UART::getReceiveOverrunCounter(void) const
+{
+	return receive_ring->getOverrunCounter();
+}
+
+
+
+/**
+  * @brief 		Copies the received data out of the ring.
   *
   * @param[out]  uint8_t buffer[] : The data read from the related uart port is kept in this variable.
+  * @param[in]   uint16_t size_limit
   *
   * @return 	uint16_t size	  : Information on how many bytes are read.
   *
@@ -650,18 +698,56 @@ void H747_UART::sendData(uint8_t buffer[], uint16_t size)
   */
 uint16_t H747_UART::getDataFromBuffer(uint8_t buffer[], uint16_t size_limit)
 {
-	uint16_t size = 0;
+	if(receive_dma_enabled == true)
+	{
+		updateDmaReceiveHead();
+	}
+
+	return static_cast<uint16_t>(receive_ring->popBulk(buffer, size_limit));
+}
+
 
-	while( (receive_tail & UART_BUFFER_SIZE_MASK) != (receive_head & UART_BUFFER_SIZE_MASK) )
+
+/**
+  * @brief 		Gives the received data in place, as one span or as two spans when it wraps
+  *				around the end of the ring. The spans stay valid until they are consumed,
+  *				or in DMA mode until UART_BUFFER_SIZE more bytes are received.
+  *
+  * @param[out] receive_span_type &span
+  *
+  * @return 	uint16_t : Number of unread bytes
+  *
+  * Example:
+  * @code
+  * Peripherals::Uart::receive_span_type span;
+  * uint16_t size = uart2.peek(span);
+  * parse(span.first, span.first_size);
+  * parse(span.second, span.second_size);
+  * uart2.consume(size);
+  * @endcode
+  */
+uint16_t H747_UART::peek(receive_span_type &span)
+{
+	if(receive_dma_enabled == true)
 	{
-		buffer[size++] = receive_buffer[(receive_tail++) & UART_BUFFER_SIZE_MASK ];
-		if(size >= size_limit)
-		{
-			break;
-		}
+		updateDmaReceiveHead();
 	}
 
-	return size;
+	return static_cast<uint16_t>(receive_ring->peek(span));
+}
+
+
+
+/**
+  * @brief 		Releases bytes given by peek
+  *
+  * @param[in]  uint16_t size : Bytes to release, limited to the unread bytes
+  *
+  * @return 	void
+  */
+void H747_UART::consume(uint16_t size)
+{
+	receive_ring->consume(size);
 }
 
 
@@ -675,12 +761,432 @@ uint16_t H747_UART::getDataFromBuffer(uint8_t buffer[], uint16_t size_limit)
   */
 void H747_UART::receiveByte(uint8_t buffer)
 {
-	receive_buffer[ (receive_head++) & UART_BUFFER_SIZE_MASK ] = buffer;
-	if(receive_head == receive_tail)
+	receive_ring->push(buffer);		///< A full ring drops the byte and counts it
+
+	if(data_ready_notify != nullptr)
+	{
+		data_ready_counter++;
+		if( ( (data_ready_threshold != 0) && (data_ready_counter >= data_ready_threshold) ) ||
+			( static_cast<int16_t>(buffer) == data_ready_delimiter ) )
+		{
+			data_ready_counter = 0;
+			data_ready_notify();
+		}
+	}
+}
+
+
+
+/**
+  * @brief 		Sets the function called from the receive interrupt when a parser has
+  *				work to do, so the parser does not need to poll the buffer.
+  *
+  * @param[in]  void (*notify)(void)	: Called in the interrupt, it must only signal, nullptr disables
+  * @param[in]  uint16_t threshold		: Notify after this many bytes, 0 disables the byte count
+  * @param[in]  int16_t delimiter		: Notify on this byte, e.g. '\n', or UART_DELIMITER_NONE
+  *
+  * @return 	void
+  *
+  * Example:
+  * @code
+  * uart2.setDataReadyNotification(lw20DataReady, 64, '\n');
+  * @endcode
+  */
+void H747_UART::setDataReadyNotification(void (*notify)(void), uint16_t threshold, int16_t delimiter)
+{
+	data_ready_notify	 = nullptr;
+	data_ready_threshold = threshold;
+	data_ready_delimiter = delimiter;
+	data_ready_counter	 = 0;
+	data_ready_notify	 = notify;
+}
+
+
+
+/**
+  * @brief 		Moves the reception to a circular DMA transfer. The DMA writes the bytes
+  *				without interrupts into a ring in AXI SRAM. The reader publishes the DMA
+  *				position as the ring head before every read, so the buffer API stays the
+  *				same. A notification set by setDataReadyNotification is called on the IDLE
+  *				interrupt in this mode.
+  *
+  * @param[in]  DMA_Stream_TypeDef *stream	: Free DMA1 or DMA2 stream
+  * @param[in]  uint32_t request			: DMAMUX request of the receiver, e.g. DMA_REQUEST_USART6_RX
+  *
+  * @return 	bool : false if the DMA can not be initialized or the DMA area is used up,
+  *					   the port stays in interrupt mode
+  *
+  * Example:
+  * @code
+  * uart6.enableDmaReception(DMA1_Stream1, DMA_REQUEST_USART6_RX);
+  * @endcode
+  */
+bool H747_UART::enableDmaReception(DMA_Stream_TypeDef *stream, uint32_t request)
+{
+	uart_ring_type *dma_ring = receive_ring;
+
+	__HAL_RCC_DMA1_CLK_ENABLE();
+	__HAL_RCC_DMA2_CLK_ENABLE();
+
+	receive_dma_handle.Instance					= stream;
+	receive_dma_handle.Init.Request				= request;
+	receive_dma_handle.Init.Direction			= DMA_PERIPH_TO_MEMORY;
+	receive_dma_handle.Init.PeriphInc			= DMA_PINC_DISABLE;
+	receive_dma_handle.Init.MemInc				= DMA_MINC_ENABLE;
+	receive_dma_handle.Init.PeriphDataAlignment	= DMA_PDATAALIGN_BYTE;
+	receive_dma_handle.Init.MemDataAlignment	= DMA_MDATAALIGN_BYTE;
+	receive_dma_handle.Init.Mode				= DMA_CIRCULAR;
+	receive_dma_handle.Init.Priority			= DMA_PRIORITY_HIGH;
+	receive_dma_handle.Init.FIFOMode			= DMA_FIFOMODE_DISABLE;
+
+	if(receive_ring == &receive_ring_buffer)
+	{
+		dma_ring = allocateDmaRing();
+	}
+
+	if( (dma_ring == nullptr) || (HAL_DMA_Init(&receive_dma_handle) != HAL_OK) )
+	{
+		return false;
+	}
+
+	CLEAR_BIT(uart_handle->Instance->CR3, USART_CR3_EIE);
+	CLEAR_BIT(uart_handle->Instance->CR1, USART_CR1_PEIE | USART_CR1_RXNEIE_RXFNEIE);
+	__HAL_LINKDMA(uart_handle, hdmarx, receive_dma_handle);
+
+	receive_ring		= dma_ring;
+	receive_dma_enabled = true;
+
+	initialize();
+
+	return true;
+}
+
+
+
+/**
+  * @brief 		IDLE line interrupt of the DMA or FIFO reception, called by DS_UART_DmaInterruptHandler.
+  *				In FIFO mode it reads the end of a frame, which stays below the threshold.
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void H747_UART::idleInterruptHandler(void)
+{
+	uint16_t dma_position = 0;
+
+	if(receive_dma_enabled == false)
+	{
+		drainReceiveFifo();
+		return;
+	}
+
+	dma_position = static_cast<uint16_t>( (UART_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(&receive_dma_handle)) & UART_BUFFER_SIZE_MASK );
+	if( (data_ready_notify != nullptr) && ( (receive_ring->getHead() & UART_BUFFER_SIZE_MASK) != dma_position ) )
+	{
+		data_ready_notify();		///< The head is only moved by the reader, the ring keeps a single producer
+	}
+}
+
+
+
+/**
+  * @brief 		Receive and transmit interrupt of the port, called through RxISR and TxISR of
+  *				the HAL handle. In FIFO mode one interrupt moves a burst of bytes.
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void H747_UART::interruptHandler(void)
+{
+	uint32_t isrflags = READ_REG(uart_handle->Instance->ISR);
+	uint32_t cr1its	  = READ_REG(uart_handle->Instance->CR1);
+	uint32_t cr3its	  = READ_REG(uart_handle->Instance->CR3);
+
+	if( ( (isrflags & USART_ISR_RXNE_RXFNE) != 0U ) &&
+		( ( (cr1its & USART_CR1_RXNEIE_RXFNEIE) != 0U ) || ( (cr3its & USART_CR3_RXFTIE) != 0U ) ) )
+	{
+		drainReceiveFifo();
+	}
+
+	if( ( (isrflags & USART_ISR_TXE_TXFNF) != 0U ) &&
+		( ( (cr1its & USART_CR1_TXEIE_TXFNFIE) != 0U ) || ( (cr3its & USART_CR3_TXFTIE) != 0U ) ) )
+	{
+		fillTransmitFifo();
+	}
+}
+
+
+
+/**
+  * @brief 		Sets the FIFO thresholds and enables the FIFO mode
+  *
+  * @param[in]  void
+  *
+  * @return 	bool : false if the HAL refused it, the port stays with one interrupt per byte
+  */
+bool H747_UART::enableFifo(void)
+{
+	if( (HAL_UARTEx_SetTxFifoThreshold(uart_handle, UART_TRANSMIT_FIFO_THRESHOLD) != HAL_OK) ||
+		(HAL_UARTEx_SetRxFifoThreshold(uart_handle, UART_RECEIVE_FIFO_THRESHOLD)  != HAL_OK) ||
+		(HAL_UARTEx_EnableFifoMode(uart_handle) != HAL_OK) )
+	{
+		HAL_UARTEx_DisableFifoMode(uart_handle);
+		return false;
+	}
+
+	return true;
+}
+
+
+
+/**
+  * @brief 		Moves the received bytes out of the RX FIFO, at most one FIFO depth per call
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void H747_UART::drainReceiveFifo(void)
+{
+	uint8_t count = 0;
+	uint8_t data  = 0;
+
+	while( (count < UART_FIFO_DEPTH) && ( (READ_REG(uart_handle->Instance->ISR) & USART_ISR_RXNE_RXFNE) != 0U ) )
+	{
+		data = readReceiveData(uart_handle->Instance);
+		if(receive_handler != nullptr)
+		{
+			receive_handler(data);
+		}
+		else
+		{
+			receiveByte(data);
+		}
+		count++;
+	}
+}
+
+
+
+/**
+  * @brief 		Fills the TX FIFO from the transmit ring and stops the transmit interrupt
+  *				when the ring is empty
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void H747_UART::fillTransmitFifo(void)
+{
+	uint8_t count = 0;
+
+	while( (count < UART_FIFO_DEPTH) && ( (READ_REG(uart_handle->Instance->ISR) & USART_ISR_TXE_TXFNF) != 0U ) )
+	{
+		if(transmit() == false)
+		{
+			CLEAR_BIT(uart_handle->Instance->CR1, USART_CR1_TXEIE_TXFNFIE);
+			CLEAR_BIT(uart_handle->Instance->CR3, USART_CR3_TXFTIE);
+			break;
+		}
+		count++;
+	}
+}
+
+
+
+/**
+  * @brief 		Returns the HAL handle of the port
+  *
+  * @param[in]  void
+  *
+  * @return 	UART_HandleTypeDef*
+  */
+UART_HandleTypeDef* H747_UART::getHandle(void) const
+{
+	return uart_handle;
+}
+
+
+
+/**
+  * @brief 		Starts the circular DMA transfer into the receive ring and enables the IDLE interrupt
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void H747_UART::startDmaReception(void)
+{
+	uart_handle->RxXferSize = UART_BUFFER_SIZE;
+	receive_ring->reset();
+
+	HAL_DMA_Start(&receive_dma_handle, static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&uart_handle->Instance->RDR)),
+				  static_cast<uint32_t>(reinterpret_cast<uintptr_t>(receive_ring->getStorage())), UART_BUFFER_SIZE);
+
+	__HAL_UART_CLEAR_IDLEFLAG(uart_handle);
+	SET_BIT(uart_handle->Instance->CR3, USART_CR3_DMAR);
+	SET_BIT(uart_handle->Instance->CR1, USART_CR1_IDLEIE);
+}
+
+
+
+/**
+  * @brief 		Commits the bytes written by the DMA since the last read to the receive ring.
+  *				Only the reader calls it, so the ring has a single producer. If the reader fell
+  *				behind, the overwritten bytes are dropped and counted as receive overrun.
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void H747_UART::updateDmaReceiveHead(void)
+{
+	const uint16_t dma_position = static_cast<uint16_t>( (UART_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(&receive_dma_handle)) & UART_BUFFER_SIZE_MASK );
+
+	receive_ring->commitOverwrite( (dma_position - receive_ring->getHead()) & UART_BUFFER_SIZE_MASK );
+}
+
+
+
+/**
+  * @brief 		Moves the transmission to the DMA. sendData copies the data into a transmit
+  *				ring in AXI SRAM and queues its spans.
+  *				Every queued transfer is started by the transfer complete interrupt of the
+  *				previous one, so there is one interrupt per transfer instead of per byte.
+  *
+  * @param[in]  DMA_Stream_TypeDef *stream	: Free DMA1 or DMA2 stream
+  * @param[in]  uint32_t request			: DMAMUX request of the transmitter, e.g. DMA_REQUEST_USART3_TX
+  *
+  * @return 	bool : false if the DMA can not be initialized or the DMA area is used up,
+  *					   the port stays in interrupt mode
+  *
+  * Example:
+  * @code
+  * uart3.enableDmaTransmission(DMA1_Stream2, DMA_REQUEST_USART3_TX);
+  * @endcode
+  */
+bool H747_UART::enableDmaTransmission(DMA_Stream_TypeDef *stream, uint32_t request)
+{
+	uart_ring_type *dma_ring = transmit_ring;
+
+	__HAL_RCC_DMA1_CLK_ENABLE();
+	__HAL_RCC_DMA2_CLK_ENABLE();
+
+	transmit_dma_handle.Instance					= stream;
+	transmit_dma_handle.Init.Request				= request;
+	transmit_dma_handle.Init.Direction				= DMA_MEMORY_TO_PERIPH;
+	transmit_dma_handle.Init.PeriphInc				= DMA_PINC_DISABLE;
+	transmit_dma_handle.Init.MemInc					= DMA_MINC_ENABLE;
+	transmit_dma_handle.Init.PeriphDataAlignment	= DMA_PDATAALIGN_BYTE;
+	transmit_dma_handle.Init.MemDataAlignment		= DMA_MDATAALIGN_BYTE;
+	transmit_dma_handle.Init.Mode					= DMA_NORMAL;
+	transmit_dma_handle.Init.Priority				= DMA_PRIORITY_MEDIUM;
+	transmit_dma_handle.Init.FIFOMode				= DMA_FIFOMODE_DISABLE;
+
+	if(transmit_ring == &transmit_ring_buffer)
+	{
+		dma_ring = allocateDmaRing();
+	}
+
+	if( (dma_ring == nullptr) || (HAL_DMA_Init(&transmit_dma_handle) != HAL_OK) )
+	{
+		return false;
+	}
+
+	CLEAR_BIT(uart_handle->Instance->CR1, USART_CR1_TXEIE_TXFNFIE);
+	__HAL_LINKDMA(uart_handle, hdmatx, transmit_dma_handle);
+
+	transmit_ring		 = dma_ring;
+	transmit_queue_head	 = 0;
+	transmit_queue_tail	 = 0;
+	transmit_dma_active	 = false;
+	transmit_dma_enabled = true;
+
+	return true;
+}
+
+
+
+/**
+  * @brief 		Transfer complete interrupt of the transmit DMA, called by DS_UART_DmaInterruptHandler
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void H747_UART::transmitCompleteHandler(void)
+{
+	const transmit_descriptor_type &descriptor = transmit_queue[transmit_queue_tail & UART_TRANSMIT_QUEUE_SIZE_MASK];
+
+	transmit_ring->consume(descriptor.size);
+	transmit_queue_tail = transmit_queue_tail + 1;
+	transmit_dma_active = false;
+
+	if(transmit_queue_tail == transmit_queue_head)
+	{
+		CLEAR_BIT(uart_handle->Instance->CR1, USART_CR1_TCIE);
+	}
+	else
 	{
-		receive_buffer_overrun = true;
+		startDmaTransmit();
 	}
+}
+
+
+
+/**
+  * @brief 		Adds a span of the transmit ring to the transmit DMA queue
+  *
+  * @param[in]  const uint8_t data[]
+  * @param[in]  uint16_t size
+  *
+  * @return 	bool : false if the queue is full
+  */
+bool H747_UART::pushTransmitDescriptor(const uint8_t data[], uint16_t size)
+{
+	transmit_descriptor_type &descriptor = transmit_queue[transmit_queue_head & UART_TRANSMIT_QUEUE_SIZE_MASK];
+
+	if( static_cast<uint8_t>(transmit_queue_head - transmit_queue_tail) >= UART_TRANSMIT_QUEUE_SIZE )
+	{
+		return false;
+	}
+
+	descriptor.data		 = data;
+	descriptor.size		 = size;
+	transmit_queue_head	 = transmit_queue_head + 1;		///< Published after the descriptor, the interrupt may start it
+
+	return true;
+}
+
+
+
+/**
+  * @brief 		Starts the oldest queued transfer if the transmit DMA is idle
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void H747_UART::startDmaTransmit(void)
+{
+	const transmit_descriptor_type *descriptor = nullptr;
+
+	if( (transmit_dma_active == true) || (transmit_queue_tail == transmit_queue_head) )
+	{
+		return;
+	}
+
+	transmit_dma_active = true;
+	descriptor			= &transmit_queue[transmit_queue_tail & UART_TRANSMIT_QUEUE_SIZE_MASK];
 
+	HAL_DMA_Abort(&transmit_dma_handle);		///< The stream of the last transfer is already stopped, this resets its flags and state
+	__HAL_UART_CLEAR_FLAG(uart_handle, UART_CLEAR_TCF);
+	HAL_DMA_Start(&transmit_dma_handle, static_cast<uint32_t>(reinterpret_cast<uintptr_t>(descriptor->data)),
+				  static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&uart_handle->Instance->TDR)), descriptor->size);
+	SET_BIT(uart_handle->Instance->CR3, USART_CR3_DMAT);
+	SET_BIT(uart_handle->Instance->CR1, USART_CR1_TCIE);
 }
 
 
@@ -692,11 +1198,12 @@ void H747_UART::receiveByte(uint8_t buffer)
   */
 bool H747_UART::transmit(void)
 {
-	bool transmit_in_progress = false;
+	bool	transmit_in_progress = false;
+	uint8_t data				 = 0;
 
-	if( ( transmit_tail & UART_BUFFER_SIZE_MASK ) != ( transmit_head & UART_BUFFER_SIZE_MASK ) )
+	if(transmit_ring->pop(data) == true)
 	{
-		uart_handle->Instance->TDR = transmit_buffer[ (transmit_tail++) & UART_BUFFER_SIZE_MASK ];
+		writeTransmitData(uart_handle->Instance, data);
 		transmit_in_progress = true;
 	}
 	else
@@ -35,6 +35,7 @@
  */
 #include <stdint.h>
 #include "ds_uart.hpp"
+#include "ds_ring_buffer.hpp"
 #include "usart.h"
 // End of Includes
 
@@ -53,6 +54,14 @@ namespace Uart
 const uint16_t UART_BUFFER_SIZE 					= 2048;
 const uint16_t UART_BUFFER_SIZE_MASK 			= UART_BUFFER_SIZE -1;
 const uint16_t UART_BUFFER_TRANSFER_LIMIT	= 256;
+const int16_t  UART_DELIMITER_NONE			= -1;
+const uint32_t UART_DMA_BUFFER_ADDR			= 0x24078000;	///< AXI SRAM above the serializer buffers, DMA1/2 can not reach the DTCM
+const uint32_t UART_DMA_BUFFER_AREA_SIZE	= 0x6000;		///< Room for 11 DMA rings
+const uint8_t  UART_TRANSMIT_QUEUE_SIZE		= 8;			///< Must be a power of two
+const uint8_t  UART_TRANSMIT_QUEUE_SIZE_MASK	= UART_TRANSMIT_QUEUE_SIZE - 1;
+const uint8_t  UART_FIFO_DEPTH				= 16;			///< Bytes in the RX and in the TX FIFO of every port
+const uint32_t UART_RECEIVE_FIFO_THRESHOLD	= UART_RXFIFO_THRESHOLD_1_2;	///< One interrupt per 8 received bytes, the rest is read on IDLE
+const uint32_t UART_TRANSMIT_FIFO_THRESHOLD	= UART_TXFIFO_THRESHOLD_1_2;	///< One interrupt per 8 free places in the TX FIFO
  //End of Macro Definitions
 
 
@@ -76,6 +85,25 @@ enum class uart_module_type : uint8_t
 	H747_UART7   = 7,	/*!<UART7 handle*/
 	H747_UART8   = 8,	/*!<UART8 handle*/
 };
+
+
+
+/**
+ * @brief One DMA transmit transfer
+ */
+struct transmit_descriptor_type
+{
+	const uint8_t	*data;
+	uint16_t		 size;			///< The ring tail moves by size when it is sent
+};
+
+
+
+/**
+ * @brief Rings of the port, the receive ring is filled by the interrupt or by the DMA
+ */
+typedef Tools::RING_BUFFER<uint8_t, UART_BUFFER_SIZE> uart_ring_type;
+typedef Tools::ring_span_type<uint8_t>				  receive_span_type;	///< Unread bytes without a copy, two spans when the data wraps
 // End of Enum, Union and Struct Definitions
 
 
@@ -90,13 +118,30 @@ class H747_UART: public BASE
 
 		void 	 		initialize				(void) override;
 		bool 	 		changeBaudRate 		(uint32_t baudrate) override;
-		void 	 		sendData					(uint8_t buffer[], uint16_t size) override;
+		bool 	 		sendData					(uint8_t buffer[], uint16_t size) override;
+		uint8_t*	reserveTransmit		(uint16_t size);
+		void		commitTransmit		(uint16_t size);
+		uint16_t	getTransmitSpace	(void) const;
+		bool		isTransmitSaturated	(uint16_t size) const;
 		uint16_t 	getDataFromBuffer	(uint8_t buffer[], uint16_t size_limit = UART_BUFFER_TRANSFER_LIMIT) override;
+		uint16_t	peek				(receive_span_type &span);
+		void		consume				(uint16_t size);
 		float 	 	getBaudRateError	(uint32_t usart_ker_ck_pres);
+		void		setDataReadyNotification(void (*notify)(void), uint16_t threshold, int16_t delimiter = UART_DELIMITER_NONE);
+		bool		enableDmaReception	(DMA_Stream_TypeDef *stream, uint32_t request);
+		void		idleInterruptHandler(void);
+		void		interruptHandler	(void);
+		bool		enableDmaTransmission	(DMA_Stream_TypeDef *stream, uint32_t request);
+		void		transmitCompleteHandler	(void);
+		UART_HandleTypeDef* getHandle	(void) const;
 
 		void		receiveByte		(uint8_t buffer) override;
 		bool 	 	transmit			(void) override;
 
+		uint32_t	getReceiveOverrunCounter(void) const;
+
+		uint32_t	transmit_reject_counter = 0;	///< sendData calls refused because the link is saturated
+
 		H747_UART(const H747_UART& orig);
 		virtual ~H747_UART();
 
@@ -106,14 +151,40 @@ class H747_UART: public BASE
 		uart_module_type    uart_number;
 		UART_HandleTypeDef *uart_handle;
 
-		uint8_t  receive_buffer[UART_BUFFER_SIZE]	= {0};
-		uint16_t receive_head 		  			   			=  0;
-		uint16_t receive_tail 		  			   			=  0;
-		bool	 receive_buffer_overrun 	  	   		= false;
+		uart_ring_type	receive_ring_buffer;
+		uart_ring_type *receive_ring					= &receive_ring_buffer;	///< receive_ring_buffer, or a ring in AXI SRAM for the DMA
+
+		void	 (*data_ready_notify)(void)				= nullptr;
+		uint16_t data_ready_threshold					=  0;
+		int16_t	 data_ready_delimiter					= UART_DELIMITER_NONE;
+		uint16_t data_ready_counter						=  0;	///< Bytes received since the last notification
+
+		bool	 fifo_enabled							= false;	///< Threshold interrupts and burst loops, otherwise one interrupt per byte
+		void	 (*receive_handler)(uint8_t data)		= nullptr;	///< Takes the received bytes instead of the receive ring, e.g. the SBUS2 decoder
+
+		bool	 enableFifo				(void);
+		void	 drainReceiveFifo		(void);
+		void	 fillTransmitFifo		(void);
 
-		uint8_t  transmit_buffer[UART_BUFFER_SIZE]	= {0};
-		uint16_t transmit_head 		  			   				=  0;
-		uint16_t transmit_tail 		   			   				=  0;
+		DMA_HandleTypeDef receive_dma_handle			= {};
+		bool	 receive_dma_enabled					= false;
+
+		void	 startDmaReception		(void);
+		void	 updateDmaReceiveHead	(void);
+
+		DMA_HandleTypeDef		 transmit_dma_handle		= {};
+		bool					 transmit_dma_enabled		= false;
+		volatile bool			 transmit_dma_active		= false;
+		transmit_descriptor_type transmit_queue[UART_TRANSMIT_QUEUE_SIZE] = {};
+		volatile uint8_t		 transmit_queue_head		= 0;
+		volatile uint8_t		 transmit_queue_tail		= 0;
+
+		bool	 pushTransmitDescriptor	(const uint8_t data[], uint16_t size);
+		void	 startTransmit			(uint16_t head, uint16_t size);
+		void	 startDmaTransmit		(void);
+
+		uart_ring_type	transmit_ring_buffer;
+		uart_ring_type *transmit_ring					= &transmit_ring_buffer;	///< transmit_ring_buffer, or a ring in AXI SRAM for the DMA
 };
 // End of H747_UART Class Definition
 
@@ -136,6 +207,11 @@ extern Peripherals::Uart::H747_UART uart5;
 extern Peripherals::Uart::H747_UART uart6;
 extern Peripherals::Uart::H747_UART uart7;
 extern Peripherals::Uart::H747_UART uart8;
+
+#ifdef DS_SIMULATION
+extern uint8_t simulateReceiveRegister	( USART_TypeDef *usart );				///< Host simulation, reads RDR out of the modelled receive FIFO
+extern void	   simulateTransmitRegister	( USART_TypeDef *usart, uint8_t data );	///< Host simulation, writes TDR into the modelled transmit FIFO
+#endif
 // End of External Linkages
 
 
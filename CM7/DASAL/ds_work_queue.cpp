@@ -0,0 +1,216 @@
+/**
+ ******************************************************************************
+  * @file		: ds_work_queue.cpp
+  * @brief		: Deferred work queue source file
+  *				  Interrupts post small work items, the scheduler runs them between
+  *				  the tasks. Posting is lock free for any number of interrupt levels.
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+
+/*
+ * Begin of Includes
+ */
+#include "ds_work_queue.hpp"
+#include "ds_debug_tools.hpp"
+// End of Includes
+
+
+
+/*
+ * Begin of Object Definitions
+ */
+Tools::WORK_QUEUE work_queue;
+//End of Object Definitions
+
+
+
+namespace Tools
+{
+
+
+
+/**
+  * @brief Default constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+WORK_QUEUE::WORK_QUEUE():
+post_counter(0),
+drop_counter(0),
+execution_counter(0),
+maximum_depth(0),
+maximum_drain_time_us(0),
+enqueue_position(0),
+dequeue_position(0)
+{
+	uint32_t index = 0;
+
+	for(index = 0; index < WORK_QUEUE_SIZE; index++)
+	{
+		item[index].function = nullptr;
+		item[index].context	 = nullptr;
+		item[index].argument = 0;
+		item[index].sequence.store(index, std::memory_order_relaxed);
+	}
+}
+
+
+
+/**
+  * @brief 		Posts a work item, it may be called from any interrupt. A slot is reserved
+  *				with a compare and swap on the enqueue position and published by its
+  *				sequence, so an interrupt preempting another post can not corrupt it.
+  *
+  * @param[in]  void (*function)( void *context, uint32_t argument ) : Runs in the main loop
+  * @param[in]  void *context		: Object of the work, e.g. the driver
+  * @param[in]  uint32_t argument	: Small value copied with the item
+  *
+  * @return 	bool : false if the queue is full, the caller keeps the work
+  *
+  * Example:
+  * @code
+  * work_queue.post(latchFrameWork, this, buffer_index);
+  * @endcode
+  */
+bool WORK_QUEUE::post( void (*function)( void *context, uint32_t argument ), void *context, uint32_t argument )
+{
+	uint32_t		position = enqueue_position.load(std::memory_order_relaxed);
+	uint32_t		sequence = 0;
+	work_item_type *entry	 = nullptr;
+
+	while(true)
+	{
+		entry	 = &item[position & WORK_QUEUE_SIZE_MASK];
+		sequence = entry->sequence.load(std::memory_order_acquire);
+
+		if(sequence == position)
+		{
+			if(enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) == true)
+			{
+				break;
+			}
+		}
+		else if(static_cast<int32_t>(sequence - position) < 0)
+		{
+			drop_counter.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		else
+		{
+			position = enqueue_position.load(std::memory_order_relaxed);
+		}
+	}
+
+	entry->function = function;
+	entry->context	= context;
+	entry->argument = argument;
+	entry->sequence.store(position + 1, std::memory_order_release);
+	post_counter.fetch_add(1, std::memory_order_relaxed);
+
+	return true;
+}
+
+
+
+/**
+  * @brief 		Runs the posted work items in post order until the queue is empty or the
+  *				time limit is spent. At least one item runs, so the queue always advances.
+  *
+  * @param[in]  uint32_t time_limit_us
+  *
+  * @return 	uint8_t : Number of executed items
+  */
+uint8_t WORK_QUEUE::drain( uint32_t time_limit_us )
+{
+	work_item_type *entry	   = &item[dequeue_position & WORK_QUEUE_SIZE_MASK];
+	uint32_t		start_us   = 0;
+	uint32_t		elapsed_us = 0;
+	uint32_t		depth	   = 0;
+	uint8_t			result	   = 0;
+
+	if(entry->sequence.load(std::memory_order_acquire) != (dequeue_position + 1))
+	{
+		return 0;
+	}
+
+	depth = enqueue_position.load(std::memory_order_relaxed) - dequeue_position;
+	if(depth > maximum_depth)
+	{
+		maximum_depth = depth;
+	}
+
+	start_us = monitor.getMicros();
+	do
+	{
+		entry->function(entry->context, entry->argument);
+		entry->sequence.store(dequeue_position + WORK_QUEUE_SIZE, std::memory_order_release);
+		dequeue_position++;
+		execution_counter++;
+		result++;
+
+		elapsed_us = monitor.getMicros() - start_us;
+		entry	   = &item[dequeue_position & WORK_QUEUE_SIZE_MASK];
+	}
+	while( (elapsed_us < time_limit_us) && (entry->sequence.load(std::memory_order_acquire) == (dequeue_position + 1)) );
+
+	if(elapsed_us > maximum_drain_time_us)
+	{
+		maximum_drain_time_us = elapsed_us;
+	}
+
+	return result;
+}
+
+
+
+/**
+  * @brief 		Default copy constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+WORK_QUEUE::WORK_QUEUE(const WORK_QUEUE& orig)
+{
+
+}
+
+
+
+/**
+  * @brief 		Default destructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+WORK_QUEUE::~WORK_QUEUE()
+{
+
+}
+
+
+
+} //End of namespace Tools
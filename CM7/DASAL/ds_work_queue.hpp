@@ -0,0 +1,113 @@
+/**
+ ******************************************************************************
+  * @file		: ds_work_queue.hpp
+  * @brief		: Deferred work queue header file
+  *				  This file contains the queue which moves the interrupt work to the main loop
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+#ifndef DS_WORK_QUEUE_HPP
+#define	DS_WORK_QUEUE_HPP
+
+
+
+/*
+ * Begin of Includes
+ */
+#include <stdint.h>
+#include <atomic>
+// End of Includes
+
+
+
+namespace Tools
+{
+
+
+
+/*
+ * Begin of Macro Definitions
+ */
+const uint32_t WORK_QUEUE_SIZE		= 32;		///< Must be a power of two
+const uint32_t WORK_QUEUE_SIZE_MASK	= WORK_QUEUE_SIZE - 1;
+const uint32_t WORK_DRAIN_LIMIT_US	= 50;		///< Time given to one drain between two scheduled tasks
+//End of Macro Definitions
+
+
+
+/*
+ * Begin of Enum, Union and Struct Definitions
+ */
+struct work_item_type
+{
+	void					(*function)( void *context, uint32_t argument );
+	void					*context;
+	uint32_t				argument;
+	std::atomic<uint32_t>	sequence;		///< Position + 1 when the item is ready, position + size when it is free
+};
+// End of Enum, Union and Struct Definitions
+
+
+
+/*
+ * Begin of WORK_QUEUE Class Definition
+ */
+class WORK_QUEUE
+{
+	public:
+		WORK_QUEUE();
+
+		bool	 post	( void (*function)( void *context, uint32_t argument ), void *context, uint32_t argument );
+		uint8_t	 drain	( uint32_t time_limit_us );
+
+		std::atomic<uint32_t> post_counter;
+		std::atomic<uint32_t> drop_counter;			///< Items which could not be posted because the queue was full
+		uint32_t			  execution_counter;
+		uint32_t			  maximum_depth;
+		uint32_t			  maximum_drain_time_us;
+
+		WORK_QUEUE(const WORK_QUEUE& orig);
+		virtual ~WORK_QUEUE();
+
+	protected:
+
+	private:
+		work_item_type		  item[WORK_QUEUE_SIZE];
+		std::atomic<uint32_t> enqueue_position;		///< Shared by every interrupt which posts
+		uint32_t			  dequeue_position;		///< Only the main loop drains
+};
+// End of WORK_QUEUE Class Definition
+
+
+
+} //End of namespace Tools
+
+
+
+/*
+ * External Linkages
+ */
+extern Tools::WORK_QUEUE work_queue;
+// End of External Linkages
+
+
+#endif	/* DS_WORK_QUEUE_HPP */
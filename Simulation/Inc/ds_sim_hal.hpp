@@ -0,0 +1,361 @@
+/**
+ ******************************************************************************
+  * @file		: ds_sim_hal.hpp
+  * @brief		: Host side HAL stand-in header file
+  *				  This file contains the simulated memory map, the virtual clock
+  *				  and the loopback peripherals used by the Linux build of DASAL
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+#ifndef DS_SIM_HAL_HPP
+#define	DS_SIM_HAL_HPP
+
+
+
+/*
+ * Begin of Includes
+ */
+#include <stdint.h>
+#include "main.h"
+// End of Includes
+
+
+
+namespace Simulation
+{
+
+
+
+/*
+ * Begin of Macro Definitions
+ */
+const uint32_t TIMER_KERNEL_CLOCK_MHZ	= 240;			///< APB1 timer clock of both cores, TIM2/5/6/7/13 prescalers are based on it.
+const uint32_t UART_KERNEL_CLOCK_HZ		= 100000000;	///< Used only to fill BRR, so getBaudRateError() returns a sane value.
+const uint8_t  TIMER_SLOT_NUMBER		= 4;
+const uint32_t UART_CAPTURE_SIZE		= 65536;
+const uint32_t UART_CAPTURE_SIZE_MASK	= UART_CAPTURE_SIZE - 1;
+const uint8_t  UART_FIFO_DEPTH			= 16;			///< RX and TX FIFO of every U(S)ART, one place while the FIFO mode is off
+const uint16_t SPI_MAXIMUM_FRAME_COUNT	= 1024;			///< Safety limit for one emulated SPI transaction
+const uint8_t  SPI_MAXIMUM_DMA_COUNT	= 16;			///< Safety limit for the DMA transactions completed by one service call
+const uint16_t I2C_MAXIMUM_STEP_COUNT	= 4096;			///< Safety limit for the bus events of one service call
+const uint32_t I2C_TXDR_SENTINEL		= 0xFFFFFFFF;	///< TXDR value while the interrupt has not written a byte
+const uint8_t  CAN_ELEMENT_WORDS		= 18;			///< FDCAN RX and TX elements with 64 byte payload, the only size H747_CAN uses
+const uint32_t POLL_COST_US				= 1;			///< Virtual time consumed by every HAL_GetTick() call, keeps busy-wait loops finite.
+const uint16_t SD_SECTOR_SIZE			= 512;
+const uint32_t SD_SECTOR_COUNT			= 16777216;		///< 8GB, DATA_LOGGER wants more than 3GB free space before logging
+const uint32_t SD_FORMAT_BUFFER_SIZE	= 4096;
+//End of Macro Definitions
+
+
+
+/*
+ * Begin of Enum, Union and Struct Definitions
+ */
+struct memory_region_type
+{
+	uint32_t	address;
+	uint32_t	size;
+	bool		is_shared;		///< Inter-core RAM, can be backed by a file shared with the other core process.
+	bool		is_optional;	///< Region is not touched by DASAL, a failed mapping is only reported.
+};
+
+
+
+struct timer_slot_type
+{
+	TIM_HandleTypeDef  *handle;
+	uint64_t			next_event_us;
+	bool				active;
+};
+// End of Enum, Union and Struct Definitions
+
+
+
+/*
+ * Begin of MEMORY_MAP Class Definition
+ */
+class MEMORY_MAP
+{
+	public:
+		MEMORY_MAP();
+
+		bool isMapped( void ) const;
+
+		MEMORY_MAP(const MEMORY_MAP& orig);
+		virtual ~MEMORY_MAP();
+
+	private:
+		bool mapped;
+
+		bool mapRegion( const memory_region_type &region, int shared_fd, uint32_t shared_offset );
+};
+// End of MEMORY_MAP Class Definition
+
+
+
+/*
+ * Begin of VIRTUAL_CLOCK Class Definition
+ */
+class VIRTUAL_CLOCK
+{
+	public:
+		VIRTUAL_CLOCK();
+
+		void	 advance_us	( uint32_t time_us );
+		uint64_t getTime_us	( void ) const;
+		uint32_t getTick_ms	( void ) const;
+		uint64_t getNextEvent_us( void ) const;
+		void	 startTimer	( TIM_HandleTypeDef *htim );
+		void	 stopTimer	( TIM_HandleTypeDef *htim );
+
+		VIRTUAL_CLOCK(const VIRTUAL_CLOCK& orig);
+		virtual ~VIRTUAL_CLOCK();
+
+	private:
+		uint64_t		time_us;
+		bool			in_advance;
+		timer_slot_type	timer_slot[TIMER_SLOT_NUMBER];
+
+		uint32_t getPeriod_us		( const TIM_HandleTypeDef *htim ) const;
+		void	 updateCounters		( void );
+		void	 moveTo				( uint64_t target_time_us );
+};
+// End of VIRTUAL_CLOCK Class Definition
+
+
+
+#ifdef CORE_CM7
+/*
+ * Begin of UART_PORT Class Definition
+ */
+class UART_PORT
+{
+	public:
+		explicit UART_PORT(UART_HandleTypeDef *handle);
+
+		uint32_t received_byte_counter		= 0;
+		uint32_t transmitted_byte_counter	= 0;
+		uint32_t capture_overrun_counter	= 0;
+		uint32_t fifo_overrun_counter		= 0;
+		uint32_t interrupt_counter			= 0;	///< Receive, transmit and IDLE interrupts run on the port
+
+		void	 injectData				( const uint8_t buffer[], uint16_t size );
+		uint16_t getTransmittedData		( uint8_t buffer[], uint16_t size_limit );
+		void	 setLoopback			( bool active );
+		void	 service				( uint32_t elapsed_us );
+		bool	 isInstance				( const USART_TypeDef *usart ) const;
+		uint8_t	 readReceiveRegister	( void );
+		void	 writeTransmitRegister	( uint8_t data );
+
+		UART_PORT(const UART_PORT& orig);
+		virtual ~UART_PORT();
+
+	private:
+		UART_HandleTypeDef *uart_handle;
+		bool	 loopback					= false;
+		bool	 loopback_idle_pending		= false;	///< Looped back bytes are followed by an IDLE when the line stops
+		uint64_t transmit_credit			= 0;
+		uint8_t	 capture_buffer[UART_CAPTURE_SIZE] = {0};
+		uint32_t capture_head				= 0;
+		uint32_t capture_tail				= 0;
+		uint8_t	 receive_fifo[UART_FIFO_DEPTH]	= {0};
+		uint8_t	 receive_fifo_tail			= 0;
+		uint8_t	 receive_fifo_level			= 0;
+		uint8_t	 transmit_fifo[UART_FIFO_DEPTH]	= {0};
+		uint8_t	 transmit_fifo_tail			= 0;
+		uint8_t	 transmit_fifo_level		= 0;
+
+		void	 receiveByte			( uint8_t data );
+		bool	 transmitByte			( void );
+		bool	 isTransmitting			( void ) const;
+		bool	 isTransmitInterruptPending( void ) const;
+		void	 captureByte			( uint8_t data );
+		void	 raiseIdle				( void );
+		uint8_t	 getFifoDepth			( void ) const;
+		uint8_t	 getFifoThreshold		( uint32_t configuration ) const;
+		void	 updateFifoStatus		( void );
+};
+// End of UART_PORT Class Definition
+
+
+
+/*
+ * Begin of SPI_PORT Class Definition
+ */
+class SPI_PORT
+{
+	public:
+		explicit SPI_PORT(SPI_HandleTypeDef *handle);
+
+		uint32_t transaction_counter	= 0;
+
+		void service( void );
+
+		SPI_PORT(const SPI_PORT& orig);
+		virtual ~SPI_PORT();
+
+	private:
+		SPI_HandleTypeDef *spi_handle;
+
+		void serviceDma( void );
+};
+// End of SPI_PORT Class Definition
+
+
+
+/*
+ * Begin of I2C_PORT Class Definition
+ */
+class I2C_PORT
+{
+	public:
+		explicit I2C_PORT(I2C_HandleTypeDef *handle);
+
+		uint32_t transfer_counter		= 0;
+		uint8_t	 device_register[256]	= {};	///< Register file of the emulated device
+
+		void service( void );
+
+		I2C_PORT(const I2C_PORT& orig);
+		virtual ~I2C_PORT();
+
+	private:
+		I2C_HandleTypeDef *i2c_handle;
+		bool	 active					= false;
+		bool	 reading				= false;
+		bool	 pointer_write			= false;	///< The next written byte is the register address
+		uint8_t	 remaining				= 0;		///< Bytes left of NBYTES
+		uint8_t	 register_pointer		= 0;
+
+		bool	 step					( void );
+		void	 loadNext				( void );
+};
+// End of I2C_PORT Class Definition
+
+
+
+/*
+ * Begin of CAN_PORT Class Definition
+ */
+class CAN_PORT
+{
+	public:
+		explicit CAN_PORT(FDCAN_GlobalTypeDef *instance);
+
+		uint32_t frame_counter		= 0;	///< Frames sent and looped back onto the bus
+		uint32_t filtered_counter	= 0;	///< Frames dropped by the filters
+
+		void service				( void );
+		bool isInstance				( const FDCAN_GlobalTypeDef *instance ) const;
+		void requestTransmission	( uint32_t buffers );
+		void acknowledge			( uint8_t fifo, uint32_t index );
+
+		CAN_PORT(const CAN_PORT& orig);
+		virtual ~CAN_PORT();
+
+	private:
+		FDCAN_GlobalTypeDef *fdcan;
+
+		bool filterFrame			( const uint32_t element[], uint8_t &fifo ) const;
+		void storeFrame				( const uint32_t element[], uint8_t fifo );
+		void updateTransmitStatus	( void );
+};
+// End of CAN_PORT Class Definition
+#endif
+
+
+
+#ifdef CORE_CM4
+/*
+ * Begin of SD_CARD Class Definition
+ */
+class SD_CARD
+{
+	public:
+		SD_CARD();
+
+		bool	 format			( void );
+		bool	 readSectors	( uint8_t buffer[], uint32_t sector, uint32_t count );
+		bool	 writeSectors	( const uint8_t buffer[], uint32_t sector, uint32_t count );
+
+		SD_CARD(const SD_CARD& orig);
+		virtual ~SD_CARD();
+
+	private:
+		int		 image_fd;		///< Sparse temporary file, only written sectors take host disk space
+
+		bool	 openImage		( void );
+};
+// End of SD_CARD Class Definition
+#endif
+
+
+
+/*
+ * Begin of BOARD Class Definition
+ */
+class BOARD
+{
+	public:
+		BOARD();
+
+		void initialize			( void );
+		void servicePeripherals	( uint32_t elapsed_us );
+
+		BOARD(const BOARD& orig);
+		virtual ~BOARD();
+};
+// End of BOARD Class Definition
+
+
+
+} //End of namespace Simulation
+
+
+
+/*
+ * External Linkages
+ */
+extern Simulation::MEMORY_MAP	 memory_map;
+extern Simulation::VIRTUAL_CLOCK virtual_clock;
+extern Simulation::BOARD		 board;
+
+#ifdef CORE_CM7
+extern Simulation::UART_PORT	 sim_lpuart1;
+extern Simulation::UART_PORT	 sim_uart1;
+extern Simulation::UART_PORT	 sim_uart2;
+extern Simulation::UART_PORT	 sim_uart3;
+extern Simulation::UART_PORT	 sim_uart4;
+extern Simulation::UART_PORT	 sim_uart5;
+extern Simulation::UART_PORT	 sim_uart6;
+extern Simulation::UART_PORT	 sim_uart7;
+extern Simulation::UART_PORT	 sim_uart8;
+extern Simulation::SPI_PORT		 sim_spi2;
+extern Simulation::I2C_PORT		 sim_i2c4;
+extern Simulation::CAN_PORT		 sim_fdcan1;
+#endif
+
+#ifdef CORE_CM4
+extern Simulation::SD_CARD		 sd_card;
+#endif
+// End of External Linkages
+
+#endif	/* DS_SIM_HAL_HPP */
@@ -0,0 +1,138 @@
+/**
+ ******************************************************************************
+  * @file		: ds_sim_scheduler.hpp
+  * @brief		: Host side scheduler simulator header file
+  *				  This file contains the virtual time stepper of SCHEDULER which
+  *				  models the run time of every task and reports the deadlines
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+#ifndef DS_SIM_SCHEDULER_HPP
+#define	DS_SIM_SCHEDULER_HPP
+
+
+
+/*
+ * Begin of Includes
+ */
+#include <stdint.h>
+#include "ds_sim_hal.hpp"
+#include "ds_main.hpp"
+#include "ds_debug_tools.hpp"
+#include "ds_work_queue.hpp"
+// End of Includes
+
+
+
+namespace Simulation
+{
+
+
+
+/*
+ * Begin of Macro Definitions
+ */
+const uint32_t FRAME_PERIOD_US			= 1250;		///< TIM6 tick of SCHEDULER, 800Hz
+const uint8_t  RECEIVE_STREAM_NUMBER	= 8;
+//End of Macro Definitions
+
+
+
+/*
+ * Begin of Enum, Union and Struct Definitions
+ */
+struct task_statistics_type
+{
+	const char	*name;				///< Name pointer of the scheduler task table entry
+	uint32_t	 load_us;			///< Modelled run time spent in virtual time on every call
+	uint32_t	 call_counter;
+	uint64_t	 total_time_us;
+	uint32_t	 maximum_time_us;
+};
+
+
+
+struct receive_stream_type
+{
+	UART_PORT		*port;
+	const uint8_t	*data;
+	uint16_t		 size;
+	uint32_t		 period_us;
+	uint64_t		 next_time_us;
+};
+// End of Enum, Union and Struct Definitions
+
+
+
+/*
+ * Begin of SCHEDULER_SIMULATOR Class Definition
+ */
+class SCHEDULER_SIMULATOR
+{
+	public:
+		SCHEDULER_SIMULATOR();
+
+		uint32_t frame_counter				= 0;
+		uint32_t missed_deadline_counter	= 0;	///< Frames which did not finish in FRAME_PERIOD_US
+		uint32_t skipped_tick_counter		= 0;	///< TIM6 ticks lost because the previous frame was still running
+		uint32_t maximum_frame_time_us		= 0;
+		float	 cpu_load_active_maximum	= 0;
+
+		bool	 setTaskLoad		( const char *name, uint32_t load_us );
+		bool	 addModelTask		( const char *name, uint16_t rate_hz, uint16_t budget_us, uint32_t load_us );
+		bool	 addReceiveStream	( UART_PORT *port, const uint8_t data[], uint16_t size, uint32_t period_us, uint32_t phase_us );
+		void	 run				( uint64_t duration_us );
+		void	 chargeTaskLoad		( const char *name );
+		void	 printReport		( void ) const;
+
+		SCHEDULER_SIMULATOR(const SCHEDULER_SIMULATOR& orig);
+		virtual ~SCHEDULER_SIMULATOR();
+
+	private:
+		task_statistics_type statistics[MAXIMUM_TASK_NUMBER];
+		uint8_t				 statistics_number;
+		receive_stream_type	 stream[RECEIVE_STREAM_NUMBER];
+		uint8_t				 stream_number;
+		uint64_t			 task_start_us;
+		uint64_t			 tick_origin_us;		///< Start of the first frame, TIM6 ticks are on this grid
+		uint64_t			 busy_time_us;
+		uint64_t			 run_time_us;
+
+		void				  wrapTasks				( void );
+		void				  serviceReceiveStreams	( void );
+		uint64_t			  getNextStream_us		( void ) const;
+		task_statistics_type* getStatistics			( const char *name );
+};
+// End of SCHEDULER_SIMULATOR Class Definition
+
+
+
+} //End of namespace Simulation
+
+
+
+/*
+ * External Linkages
+ */
+extern Simulation::SCHEDULER_SIMULATOR scheduler_simulator;
+// End of External Linkages
+
+#endif	/* DS_SIM_SCHEDULER_HPP */
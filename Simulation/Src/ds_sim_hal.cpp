@@ -0,0 +1,2343 @@
+/**
+ ******************************************************************************
+  * @file		: ds_sim_hal.cpp
+  * @brief		: Host side HAL stand-in source file
+  *				  This file contains the simulated memory map, the virtual clock,
+  *				  the loopback peripherals and the HAL functions which DASAL and
+  *				  the CubeMX init code link against in the Linux build
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+
+/*
+ * Begin of Includes
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "ds_sim_hal.hpp"
+#include "gpio.h"
+#include "tim.h"
+#include "ds_crc16.hpp"
+#ifdef CORE_CM7
+#include "usart.h"
+#include "spi.h"
+#include "i2c.h"
+#endif
+#ifdef CORE_CM4
+#include "fatfs.h"
+#endif
+// End of Includes
+
+
+
+/*
+ * Begin of Macro Definitions
+ */
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0x100000
+#endif
+
+static const char	  SHARED_MEMORY_ENV[]	= "DS_SIM_SHARED_MEMORY";
+static const uint64_t UART_BIT_TIME_SCALE	= 1000000;
+static const uint64_t UART_BITS_PER_FRAME	= 10;				///< 8N1
+
+/**
+ * @brief Memory map of STM32H747, addresses are identical for both cores.
+ * 		  The HSEM page is split from the peripheral space so that it can be shared between the core processes.
+ */
+static const Simulation::memory_region_type MEMORY_REGION[] =
+{
+	{ 0x08000000, 0x00200000, false, false },	///< FLASH bank 1 and 2
+	{ 0x24000000, 0x00080000, true,  false },	///< D1 AXI SRAM
+	{ 0x30000000, 0x00048000, true,  false },	///< D2 SRAM1, SRAM2, SRAM3
+	{ 0x38000000, 0x00010000, true,  false },	///< D3 SRAM4
+	{ 0x38800000, 0x00001000, true,  false },	///< Backup SRAM
+	{ 0x40000000, 0x18026000, false, false },	///< APB/AHB peripherals up to HSEM
+	{ 0x58026000, 0x00001000, true,  false },	///< HSEM
+	{ 0x58027000, 0x07FD9000, false, false },	///< Remaining D3 peripherals
+	{ 0xE0000000, 0x00100000, false, true  },	///< Cortex-M private peripherals, collides with ASan shadow gap
+};
+static const uint8_t MEMORY_REGION_NUMBER = sizeof(MEMORY_REGION) / sizeof(MEMORY_REGION[0]);
+//End of Macro Definitions
+
+
+
+/*
+ * Begin of Object Definitions
+ */
+Simulation::MEMORY_MAP	  memory_map __attribute__((init_priority(101)));	///< Must be ready before any DASAL constructor touches a register
+Simulation::VIRTUAL_CLOCK virtual_clock;
+Simulation::BOARD		  board;
+
+#ifdef CORE_CM7
+Simulation::UART_PORT sim_lpuart1	(&hlpuart1);
+Simulation::UART_PORT sim_uart1		(&huart1);
+Simulation::UART_PORT sim_uart2		(&huart2);
+Simulation::UART_PORT sim_uart3		(&huart3);
+Simulation::UART_PORT sim_uart4		(&huart4);
+Simulation::UART_PORT sim_uart5		(&huart5);
+Simulation::UART_PORT sim_uart6		(&huart6);
+Simulation::UART_PORT sim_uart7		(&huart7);
+Simulation::UART_PORT sim_uart8		(&huart8);
+Simulation::SPI_PORT  sim_spi2		(&hspi2);
+Simulation::I2C_PORT  sim_i2c4		(&hi2c4);
+Simulation::CAN_PORT  sim_fdcan1	(FDCAN1);
+#endif
+// End of Object Definitions
+
+
+
+namespace Simulation
+{
+
+
+
+/**
+  * @brief 		Maps the RAM and peripheral regions of the MCU at their real addresses.
+  *				Registers are plain memory afterwards, so DASAL runs without any change.
+  *				When DS_SIM_SHARED_MEMORY holds a file path, inter-core RAM is backed by
+  *				that file and a CM7 and a CM4 process can talk to each other.
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+MEMORY_MAP::MEMORY_MAP() :
+mapped(true)
+{
+	const char *shared_path   = std::getenv(SHARED_MEMORY_ENV);
+	int			shared_fd	  = -1;
+	uint32_t	shared_size   = 0;
+	uint32_t	shared_offset = 0;
+	uint8_t		index		  = 0;
+
+	for(index = 0; index < MEMORY_REGION_NUMBER; index++)
+	{
+		if(MEMORY_REGION[index].is_shared == true)
+		{
+			shared_size += MEMORY_REGION[index].size;
+		}
+	}
+
+	if(shared_path != nullptr)
+	{
+		shared_fd = open(shared_path, O_RDWR | O_CREAT, 0600);
+		if( (shared_fd < 0) || (ftruncate(shared_fd, shared_size) != 0) )
+		{
+			std::fprintf(stderr, "[sim] shared memory file %s can not be used\n", shared_path);
+			std::exit(EXIT_FAILURE);
+		}
+	}
+
+	for(index = 0; index < MEMORY_REGION_NUMBER; index++)
+	{
+		if(mapRegion(MEMORY_REGION[index], shared_fd, shared_offset) == false)
+		{
+			std::fprintf(stderr, "[sim] region 0x%08X (0x%X bytes) can not be mapped\n",
+						 static_cast<unsigned int>(MEMORY_REGION[index].address),
+						 static_cast<unsigned int>(MEMORY_REGION[index].size));
+			if(MEMORY_REGION[index].is_optional == false)
+			{
+				mapped = false;
+			}
+		}
+		if(MEMORY_REGION[index].is_shared == true)
+		{
+			shared_offset += MEMORY_REGION[index].size;
+		}
+	}
+
+	if(shared_fd >= 0)
+	{
+		close(shared_fd);
+	}
+
+	if(mapped == false)
+	{
+		std::exit(EXIT_FAILURE);
+	}
+}
+
+
+
+/**
+  * @brief 		Returns whether all mandatory regions are mapped
+  *
+  * @param[in]  void
+  *
+  * @return 	bool
+  */
+bool MEMORY_MAP::isMapped( void ) const
+{
+	return mapped;
+}
+
+
+
+/**
+  * @brief 		Maps one region at its fixed address
+  *
+  * @param[in]  const memory_region_type &region : Region to be mapped
+  * @param[in]  int shared_fd					 : Backing file of shared regions, -1 for private memory
+  * @param[in]  uint32_t shared_offset			 : Offset of the region inside the backing file
+  *
+  * @return 	bool
+  */
+bool MEMORY_MAP::mapRegion( const memory_region_type &region, int shared_fd, uint32_t shared_offset )
+{
+	void *address = reinterpret_cast<void *>(static_cast<uintptr_t>(region.address));
+	void *result  = MAP_FAILED;
+
+	if( (region.is_shared == true) && (shared_fd >= 0) )
+	{
+		result = mmap(address, region.size, PROT_READ | PROT_WRITE,
+					  MAP_SHARED | MAP_FIXED_NOREPLACE, shared_fd, shared_offset);
+	}
+	else
+	{
+		result = mmap(address, region.size, PROT_READ | PROT_WRITE,
+					  MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED_NOREPLACE, -1, 0);
+	}
+
+	if( (result != MAP_FAILED) && (result != address) )	///< Old kernels ignore MAP_FIXED_NOREPLACE and return another address
+	{
+		munmap(result, region.size);
+		result = MAP_FAILED;
+	}
+
+	return (result != MAP_FAILED);
+}
+
+
+
+/**
+  * @brief Default copy constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+MEMORY_MAP::MEMORY_MAP(const MEMORY_MAP& orig)
+{
+}
+
+
+
+/**
+  * @brief Default destructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+MEMORY_MAP::~MEMORY_MAP()
+{
+}
+
+
+
+/**
+  * @brief Default constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+VIRTUAL_CLOCK::VIRTUAL_CLOCK() :
+time_us(0),
+in_advance(false),
+timer_slot{}
+{ }
+
+
+
+/**
+  * @brief 		Moves the virtual time forward. Timer update interrupts which fall into
+  *				the interval are fired in order and the peripherals are serviced between them.
+  *				A call from inside an interrupt only moves the time, the outer call fires the events.
+  *
+  * @param[in]  uint32_t time_us : Time to be elapsed
+  *
+  * @return 	void
+  */
+void VIRTUAL_CLOCK::advance_us( uint32_t time_us )
+{
+	if(in_advance == true)
+	{
+		this->time_us += time_us;
+		updateCounters();
+		return;
+	}
+
+	in_advance = true;
+	moveTo(this->time_us + time_us);
+	in_advance = false;
+}
+
+
+
+/**
+  * @brief 		Returns the virtual time since start
+  *
+  * @param[in]  void
+  *
+  * @return 	uint64_t
+  */
+uint64_t VIRTUAL_CLOCK::getTime_us( void ) const
+{
+	return time_us;
+}
+
+
+
+/**
+  * @brief 		Returns the HAL tick
+  *
+  * @param[in]  void
+  *
+  * @return 	uint32_t
+  */
+uint32_t VIRTUAL_CLOCK::getTick_ms( void ) const
+{
+	return static_cast<uint32_t>(time_us / 1000);
+}
+
+
+
+/**
+  * @brief 		Returns the time of the next timer update interrupt
+  *
+  * @param[in]  void
+  *
+  * @return 	uint64_t : UINT64_MAX if no timer is running
+  */
+uint64_t VIRTUAL_CLOCK::getNextEvent_us( void ) const
+{
+	uint64_t result = UINT64_MAX;
+	uint8_t	 index	= 0;
+
+	for(index = 0; index < TIMER_SLOT_NUMBER; index++)
+	{
+		if( (timer_slot[index].active == true) && (timer_slot[index].next_event_us < result) )
+		{
+			result = timer_slot[index].next_event_us;
+		}
+	}
+
+	return result;
+}
+
+
+
+/**
+  * @brief 		Starts firing the update interrupt of a timer
+  *
+  * @param[in]  TIM_HandleTypeDef *htim : Timer Instance
+  *
+  * @return 	void
+  */
+void VIRTUAL_CLOCK::startTimer( TIM_HandleTypeDef *htim )
+{
+	uint8_t index = 0;
+	uint8_t free_index = TIMER_SLOT_NUMBER;
+
+	for(index = 0; index < TIMER_SLOT_NUMBER; index++)
+	{
+		if(timer_slot[index].handle == htim)
+		{
+			free_index = index;
+			break;
+		}
+		if( (timer_slot[index].handle == nullptr) && (free_index == TIMER_SLOT_NUMBER) )
+		{
+			free_index = index;
+		}
+	}
+
+	if(free_index < TIMER_SLOT_NUMBER)
+	{
+		timer_slot[free_index].handle		 = htim;
+		timer_slot[free_index].next_event_us = time_us + getPeriod_us(htim);
+		timer_slot[free_index].active		 = true;
+	}
+}
+
+
+
+/**
+  * @brief 		Stops the update interrupt of a timer
+  *
+  * @param[in]  TIM_HandleTypeDef *htim : Timer Instance
+  *
+  * @return 	void
+  */
+void VIRTUAL_CLOCK::stopTimer( TIM_HandleTypeDef *htim )
+{
+	uint8_t index = 0;
+
+	for(index = 0; index < TIMER_SLOT_NUMBER; index++)
+	{
+		if(timer_slot[index].handle == htim)
+		{
+			timer_slot[index].active = false;
+		}
+	}
+}
+
+
+
+/**
+  * @brief 		Calculates the update period from the live PSC and ARR registers,
+  *				so run time changes like TIM13->ARR in SBUS2 are followed.
+  *
+  * @param[in]  const TIM_HandleTypeDef *htim : Timer Instance
+  *
+  * @return 	uint32_t period_us
+  */
+uint32_t VIRTUAL_CLOCK::getPeriod_us( const TIM_HandleTypeDef *htim ) const
+{
+	uint64_t period_us = ( static_cast<uint64_t>(htim->Instance->PSC) + 1 ) *
+						 ( static_cast<uint64_t>(htim->Instance->ARR) + 1 ) / TIMER_KERNEL_CLOCK_MHZ;
+
+	if(period_us == 0)
+	{
+		period_us = 1;
+	}
+
+	return static_cast<uint32_t>(period_us);
+}
+
+
+
+/**
+  * @brief 		Writes the virtual time into the free running TIM2 (us) and TIM5 counters
+  *				which are read by PERF_MONITOR::getMicros and PERF_MONITOR::getMillis
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void VIRTUAL_CLOCK::updateCounters( void )
+{
+	TIM_TypeDef *free_running_timer[] = { TIM2, TIM5 };
+	uint8_t		 index = 0;
+
+	for(index = 0; index < sizeof(free_running_timer) / sizeof(free_running_timer[0]); index++)
+	{
+		TIM_TypeDef *timer = free_running_timer[index];
+		if( (timer->CR1 & TIM_CR1_CEN) != 0U )
+		{
+			timer->CNT = static_cast<uint32_t>( (time_us * TIMER_KERNEL_CLOCK_MHZ) / (static_cast<uint64_t>(timer->PSC) + 1) );
+		}
+	}
+}
+
+
+
+/**
+  * @brief 		Fires every timer event up to target time
+  *
+  * @param[in]  uint64_t target_time_us
+  *
+  * @return 	void
+  */
+void VIRTUAL_CLOCK::moveTo( uint64_t target_time_us )
+{
+	uint8_t	 index		= 0;
+	uint8_t	 next_index	= 0;
+	uint64_t elapsed_us	= 0;
+
+	while(true)
+	{
+		next_index = TIMER_SLOT_NUMBER;
+		for(index = 0; index < TIMER_SLOT_NUMBER; index++)
+		{
+			if( (timer_slot[index].active == true) && (timer_slot[index].next_event_us <= target_time_us) )
+			{
+				if( (next_index == TIMER_SLOT_NUMBER) ||
+					(timer_slot[index].next_event_us < timer_slot[next_index].next_event_us) )
+				{
+					next_index = index;
+				}
+			}
+		}
+
+		if(next_index == TIMER_SLOT_NUMBER)
+		{
+			break;
+		}
+
+		if(timer_slot[next_index].next_event_us > time_us)
+		{
+			elapsed_us = timer_slot[next_index].next_event_us - time_us;
+			time_us	   = timer_slot[next_index].next_event_us;
+			updateCounters();
+			board.servicePeripherals(static_cast<uint32_t>(elapsed_us));
+		}
+
+		timer_slot[next_index].next_event_us += getPeriod_us(timer_slot[next_index].handle);
+		HAL_TIM_PeriodElapsedCallback(timer_slot[next_index].handle);
+	}
+
+	if(target_time_us > time_us)
+	{
+		elapsed_us = target_time_us - time_us;
+		time_us	   = target_time_us;
+		updateCounters();
+		board.servicePeripherals(static_cast<uint32_t>(elapsed_us));
+	}
+}
+
+
+
+/**
+  * @brief Default copy constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+VIRTUAL_CLOCK::VIRTUAL_CLOCK(const VIRTUAL_CLOCK& orig)
+{
+}
+
+
+
+/**
+  * @brief Default destructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+VIRTUAL_CLOCK::~VIRTUAL_CLOCK()
+{
+}
+
+
+
+#ifdef CORE_CM7
+/**
+  * @brief Default constructor
+  *
+  * @param[in]  UART_HandleTypeDef *handle : Uart Instance
+  *
+  * @return 	void
+  */
+UART_PORT::UART_PORT(UART_HandleTypeDef *handle) :
+uart_handle(handle)
+{ }
+
+
+
+/**
+  * @brief 		Delivers bytes to the receive FIFO and its interrupts, or to the receive DMA,
+  *				followed by one IDLE interrupt
+  *
+  * @param[in]  const uint8_t buffer[] : Received bytes
+  * @param[in]  uint16_t size		   : Number of bytes
+  *
+  * @return 	void
+  */
+void UART_PORT::injectData( const uint8_t buffer[], uint16_t size )
+{
+	USART_TypeDef *usart = uart_handle->Instance;
+	uint16_t	   index = 0;
+
+	for(index = 0; index < size; index++)
+	{
+		receiveByte(buffer[index]);
+	}
+
+	if(usart != nullptr)
+	{
+		raiseIdle();	///< The burst is one frame, the line goes idle after it
+	}
+}
+
+
+
+/**
+  * @brief 		Pops the bytes which were sent by DASAL over this port
+  *
+  * @param[out] uint8_t buffer[]	: Transmitted bytes
+  * @param[in]  uint16_t size_limit : Capacity of buffer
+  *
+  * @return 	uint16_t size
+  */
+uint16_t UART_PORT::getTransmittedData( uint8_t buffer[], uint16_t size_limit )
+{
+	uint16_t size = 0;
+
+	while( (capture_tail != capture_head) && (size < size_limit) )
+	{
+		buffer[size++] = capture_buffer[(capture_tail++) & UART_CAPTURE_SIZE_MASK];
+	}
+
+	return size;
+}
+
+
+
+/**
+  * @brief 		Connects TX to RX of the same port
+  *
+  * @param[in]  bool active
+  *
+  * @return 	void
+  */
+void UART_PORT::setLoopback( bool active )
+{
+	loopback = active;
+}
+
+
+
+/**
+  * @brief 		Drains the transmit interrupt or the transmit DMA with the line speed of the configured baud rate.
+  *				A zero baud rate drains everything at once.
+  *
+  * @param[in]  uint32_t elapsed_us : Virtual time since the last call
+  *
+  * @return 	void
+  */
+void UART_PORT::service( uint32_t elapsed_us )
+{
+	const uint64_t FRAME_COST = UART_BITS_PER_FRAME * UART_BIT_TIME_SCALE;
+	uint32_t	   baudrate	  = uart_handle->Init.BaudRate;
+
+	if(isTransmitting() == false)
+	{
+		transmit_credit = 0;	///< An idle line can not save time for later
+		if(loopback_idle_pending == true)
+		{
+			loopback_idle_pending = false;
+			raiseIdle();
+		}
+		return;
+	}
+
+	transmit_credit += static_cast<uint64_t>(elapsed_us) * baudrate;
+	while(isTransmitting() == true)
+	{
+		if( (baudrate != 0) && (transmit_credit < FRAME_COST) )
+		{
+			break;
+		}
+		if(transmitByte() == false)
+		{
+			break;
+		}
+		if(baudrate != 0)
+		{
+			transmit_credit -= FRAME_COST;
+		}
+	}
+}
+
+
+
+/**
+  * @brief 		Puts one byte into the receive FIFO and runs the receive interrupt when the
+  *				FIFO reaches its threshold, or writes the byte with the receive DMA
+  *
+  * @param[in]  uint8_t data
+  *
+  * @return 	void
+  */
+void UART_PORT::receiveByte( uint8_t data )
+{
+	USART_TypeDef	   *usart  = uart_handle->Instance;
+	DMA_Stream_TypeDef *stream = nullptr;
+
+	if( (usart != nullptr) && ( (usart->CR3 & USART_CR3_DMAR) != 0U ) && (uart_handle->hdmarx != nullptr) )
+	{
+		stream = static_cast<DMA_Stream_TypeDef *>(uart_handle->hdmarx->Instance);
+		if( ( (stream->CR & DMA_SxCR_EN) != 0U ) && (stream->NDTR != 0U) )
+		{
+			*reinterpret_cast<uint8_t *>(static_cast<uintptr_t>(stream->M0AR + uart_handle->RxXferSize - stream->NDTR)) = data;
+			stream->NDTR--;
+			if(stream->NDTR == 0U)
+			{
+				stream->NDTR = uart_handle->RxXferSize;		///< Circular mode reload
+			}
+			received_byte_counter++;
+		}
+		return;
+	}
+
+	if( (usart == nullptr) || (uart_handle->RxISR == nullptr) ||
+		( ( (usart->CR1 & USART_CR1_RXNEIE_RXFNEIE) == 0U ) && ( (usart->CR3 & USART_CR3_RXFTIE) == 0U ) ) )
+	{
+		return;
+	}
+
+	if(receive_fifo_level >= getFifoDepth())
+	{
+		fifo_overrun_counter++;		///< ORE, the byte is lost
+		return;
+	}
+
+	receive_fifo[(receive_fifo_tail + receive_fifo_level) % UART_FIFO_DEPTH] = data;
+	receive_fifo_level++;
+	received_byte_counter++;
+	updateFifoStatus();
+
+	if( ( (usart->CR1 & USART_CR1_RXNEIE_RXFNEIE) != 0U ) ||
+		( receive_fifo_level >= getFifoThreshold( (usart->CR3 & USART_CR3_RXFTCFG) >> USART_CR3_RXFTCFG_Pos ) ) )
+	{
+		interrupt_counter++;
+		uart_handle->RxISR(uart_handle);
+	}
+}
+
+
+
+/**
+  * @brief 		Runs the transmit interrupt when the TX FIFO needs data and shifts one byte out of it
+  *
+  * @param[in]  void
+  *
+  * @return 	bool	false when DASAL had nothing to send
+  */
+bool UART_PORT::transmitByte( void )
+{
+	USART_TypeDef	   *usart  = uart_handle->Instance;
+	DMA_Stream_TypeDef *stream = nullptr;
+	uint8_t				data   = 0;
+
+	if( ( (usart->CR3 & USART_CR3_DMAT) != 0U ) && (uart_handle->hdmatx != nullptr) )
+	{
+		stream = static_cast<DMA_Stream_TypeDef *>(uart_handle->hdmatx->Instance);
+		if( ( (stream->CR & DMA_SxCR_EN) == 0U ) || (stream->NDTR == 0U) )
+		{
+			return false;
+		}
+
+		data = *reinterpret_cast<const uint8_t *>(static_cast<uintptr_t>(stream->M0AR++));
+		stream->NDTR--;
+		captureByte(data);
+
+		if(stream->NDTR == 0U)
+		{
+			stream->CR &= ~DMA_SxCR_EN;
+			usart->ISR |= USART_ISR_TC;		///< The last byte has left the shift register
+			if( (usart->CR1 & USART_CR1_TCIE) != 0U )
+			{
+				interrupt_counter++;
+				DS_UART_DmaInterruptHandler(uart_handle);
+			}
+			usart->ISR &= ~USART_ISR_TC;
+		}
+		return true;
+	}
+
+	updateFifoStatus();
+	if( (uart_handle->TxISR != nullptr) && (isTransmitInterruptPending() == true) )
+	{
+		interrupt_counter++;
+		uart_handle->TxISR(uart_handle);
+	}
+
+	if(transmit_fifo_level == 0)
+	{
+		return false;
+	}
+
+	data = transmit_fifo[transmit_fifo_tail];
+	transmit_fifo_tail = (transmit_fifo_tail + 1) % UART_FIFO_DEPTH;
+	transmit_fifo_level--;
+	updateFifoStatus();
+	captureByte(data);
+
+	return true;
+}
+
+
+
+/**
+  * @brief 		Checks whether the transmit interrupt or the transmit DMA is running
+  *
+  * @param[in]  void
+  *
+  * @return 	bool
+  */
+bool UART_PORT::isTransmitting( void ) const
+{
+	const USART_TypeDef *usart = uart_handle->Instance;
+
+	if(usart == nullptr)
+	{
+		return false;
+	}
+	if( ( (usart->CR3 & USART_CR3_DMAT) != 0U ) && (uart_handle->hdmatx != nullptr) )
+	{
+		return ( (static_cast<DMA_Stream_TypeDef *>(uart_handle->hdmatx->Instance)->CR & DMA_SxCR_EN) != 0U );
+	}
+
+	return ( ( (usart->CR1 & USART_CR1_TXEIE_TXFNFIE) != 0U ) || ( (usart->CR3 & USART_CR3_TXFTIE) != 0U ) || (transmit_fifo_level != 0) );
+}
+
+
+
+/**
+  * @brief 		Checks the transmit interrupt sources against the free places of the TX FIFO
+  *
+  * @param[in]  void
+  *
+  * @return 	bool
+  */
+bool UART_PORT::isTransmitInterruptPending( void ) const
+{
+	const USART_TypeDef *usart = uart_handle->Instance;
+	const uint8_t		 space = getFifoDepth() - transmit_fifo_level;
+
+	if( ( (usart->CR1 & USART_CR1_TXEIE_TXFNFIE) != 0U ) && (space != 0) )
+	{
+		return true;
+	}
+
+	return ( ( (usart->CR3 & USART_CR3_TXFTIE) != 0U ) &&
+			 ( space >= getFifoThreshold( (usart->CR3 & USART_CR3_TXFTCFG) >> USART_CR3_TXFTCFG_Pos ) ) );
+}
+
+
+
+/**
+  * @brief 		Checks whether the port is the given U(S)ART
+  *
+  * @param[in]  const USART_TypeDef *usart
+  *
+  * @return 	bool
+  */
+bool UART_PORT::isInstance( const USART_TypeDef *usart ) const
+{
+	return (uart_handle->Instance == usart);
+}
+
+
+
+/**
+  * @brief 		Read access of RDR, pops the receive FIFO and updates RXFNE
+  *
+  * @param[in]  void
+  *
+  * @return 	uint8_t
+  */
+uint8_t UART_PORT::readReceiveRegister( void )
+{
+	USART_TypeDef *usart = uart_handle->Instance;
+
+	if(receive_fifo_level != 0)
+	{
+		usart->RDR		  = receive_fifo[receive_fifo_tail];
+		receive_fifo_tail = (receive_fifo_tail + 1) % UART_FIFO_DEPTH;
+		receive_fifo_level--;
+		updateFifoStatus();
+	}
+
+	return static_cast<uint8_t>(usart->RDR);
+}
+
+
+
+/**
+  * @brief 		Write access of TDR, pushes the transmit FIFO and updates TXFNF
+  *
+  * @param[in]  uint8_t data
+  *
+  * @return 	void
+  */
+void UART_PORT::writeTransmitRegister( uint8_t data )
+{
+	uart_handle->Instance->TDR = data;
+
+	if(transmit_fifo_level >= getFifoDepth())
+	{
+		fifo_overrun_counter++;		///< Written while TXFNF was clear, the byte is lost
+		return;
+	}
+
+	transmit_fifo[(transmit_fifo_tail + transmit_fifo_level) % UART_FIFO_DEPTH] = data;
+	transmit_fifo_level++;
+	updateFifoStatus();
+}
+
+
+
+/**
+  * @brief 		Places of the FIFOs, FIFOEN of CR1 selects 16 or 1
+  *
+  * @param[in]  void
+  *
+  * @return 	uint8_t
+  */
+uint8_t UART_PORT::getFifoDepth( void ) const
+{
+	return ( (uart_handle->Instance->CR1 & USART_CR1_FIFOEN) != 0U ) ? UART_FIFO_DEPTH : 1;
+}
+
+
+
+/**
+  * @brief 		Converts RXFTCFG or TXFTCFG to a number of bytes
+  *
+  * @param[in]  uint32_t configuration : Field value, 0 is 1/8 up to 5 which is the full FIFO
+  *
+  * @return 	uint8_t
+  */
+uint8_t UART_PORT::getFifoThreshold( uint32_t configuration ) const
+{
+	static const uint8_t THRESHOLD[] = { 2, 4, 8, 12, 14, 16 };
+
+	if( (getFifoDepth() == 1) || (configuration >= sizeof(THRESHOLD)) )
+	{
+		return 1;
+	}
+
+	return THRESHOLD[configuration];
+}
+
+
+
+/**
+  * @brief 		Mirrors the FIFO levels to RXFNE and TXFNF of ISR
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void UART_PORT::updateFifoStatus( void )
+{
+	USART_TypeDef *usart = uart_handle->Instance;
+
+	usart->ISR &= ~(USART_ISR_RXNE_RXFNE | USART_ISR_TXE_TXFNF);
+	if(receive_fifo_level != 0)
+	{
+		usart->ISR |= USART_ISR_RXNE_RXFNE;
+	}
+	if(transmit_fifo_level < getFifoDepth())
+	{
+		usart->ISR |= USART_ISR_TXE_TXFNF;
+	}
+}
+
+
+
+/**
+  * @brief 		Stores a transmitted byte and loops it back if enabled
+  *
+  * @param[in]  uint8_t data
+  *
+  * @return 	void
+  */
+void UART_PORT::captureByte( uint8_t data )
+{
+	capture_buffer[(capture_head++) & UART_CAPTURE_SIZE_MASK] = data;
+	if( (capture_head - capture_tail) > UART_CAPTURE_SIZE )
+	{
+		capture_tail++;
+		capture_overrun_counter++;
+	}
+	transmitted_byte_counter++;
+
+	if(loopback == true)
+	{
+		receiveByte(data);
+		loopback_idle_pending = true;
+	}
+}
+
+
+
+/**
+  * @brief 		Runs the IDLE line interrupt if it is enabled
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void UART_PORT::raiseIdle( void )
+{
+	USART_TypeDef *usart = uart_handle->Instance;
+
+	if( (usart->CR1 & USART_CR1_IDLEIE) != 0U )
+	{
+		usart->ISR |= USART_ISR_IDLE;
+		interrupt_counter++;
+		DS_UART_DmaInterruptHandler(uart_handle);
+		usart->ISR &= ~USART_ISR_IDLE;
+	}
+}
+
+
+
+/**
+  * @brief Default copy constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+UART_PORT::UART_PORT(const UART_PORT& orig)
+{
+}
+
+
+
+/**
+  * @brief Default destructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+UART_PORT::~UART_PORT()
+{
+}
+
+
+
+/**
+  * @brief Default constructor
+  *
+  * @param[in]  SPI_HandleTypeDef *handle : Spi Instance
+  *
+  * @return 	void
+  */
+SPI_PORT::SPI_PORT(SPI_HandleTypeDef *handle) :
+spi_handle(handle)
+{ }
+
+
+
+/**
+  * @brief 		Completes a started transaction in loopback, MOSI is wired to MISO.
+  *				The interrupt flags follow the enabled interrupt sources, EOT is always
+  *				signalled so DASAL returns to the ready state.
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void SPI_PORT::service( void )
+{
+	SPI_TypeDef *spi		 = spi_handle->Instance;
+	uint16_t	 frame_count = 0;
+	uint32_t	 it_source	 = 0;
+
+	if( (spi != nullptr) && ( (spi->CFG1 & SPI_CFG1_TXDMAEN) != 0U ) )
+	{
+		serviceDma();
+		return;
+	}
+
+	if( (spi == nullptr) || (spi_handle->TxISR == nullptr) || ( (spi->CR1 & SPI_CR1_CSTART) == 0U ) )
+	{
+		return;
+	}
+
+	for(frame_count = 0; frame_count < SPI_MAXIMUM_FRAME_COUNT; frame_count++)
+	{
+		it_source = spi->IER;
+		*reinterpret_cast<volatile uint8_t *>(&spi->RXDR) = static_cast<uint8_t>(spi->TXDR);
+
+		if( ( (it_source & SPI_IT_TXP) != 0U ) && ( (it_source & SPI_IT_RXP) != 0U ) )
+		{
+			spi->SR = SPI_FLAG_DXP | SPI_FLAG_TXP | SPI_FLAG_RXP | SPI_FLAG_EOT;
+		}
+		else if( (it_source & SPI_IT_RXP) != 0U )
+		{
+			spi->SR = SPI_FLAG_RXP | SPI_FLAG_EOT;
+		}
+		else if( (it_source & SPI_IT_TXP) != 0U )
+		{
+			spi->SR = SPI_FLAG_TXP | SPI_FLAG_EOT;
+		}
+		else
+		{
+			break;
+		}
+		spi_handle->TxISR(spi_handle);
+	}
+
+	if( (spi->IER & SPI_IT_EOT) != 0U )
+	{
+		spi->SR = SPI_FLAG_EOT;
+		spi_handle->TxISR(spi_handle);
+	}
+
+	spi->SR = 0;
+	CLEAR_BIT(spi->CR1, SPI_CR1_CSTART);
+	transaction_counter++;
+}
+
+
+
+/**
+  * @brief 		Completes the started DMA transactions in loopback. Every transaction copies the
+  *				transmit stream into the receive stream and raises EOT, the driver starts the next
+  *				queued transaction from the interrupt, so the queue is drained back-to-back.
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void SPI_PORT::serviceDma( void )
+{
+	SPI_TypeDef		   *spi		= spi_handle->Instance;
+	DMA_Stream_TypeDef *tx		= nullptr;
+	DMA_Stream_TypeDef *rx		= nullptr;
+	uint8_t				data	= 0;
+	uint32_t			index	= 0;
+	uint8_t				count	= 0;
+
+	if( (spi_handle->hdmatx == nullptr) || (spi_handle->hdmarx == nullptr) )
+	{
+		return;
+	}
+	tx = static_cast<DMA_Stream_TypeDef *>(spi_handle->hdmatx->Instance);
+	rx = static_cast<DMA_Stream_TypeDef *>(spi_handle->hdmarx->Instance);
+
+	for(count = 0; count < SPI_MAXIMUM_DMA_COUNT; count++)
+	{
+		if( ( (spi->CR1 & SPI_CR1_CSTART) == 0U ) || ( (spi->CFG1 & SPI_CFG1_TXDMAEN) == 0U ) ||
+			( (tx->CR & DMA_SxCR_EN) == 0U ) || ( (rx->CR & DMA_SxCR_EN) == 0U ) )
+		{
+			break;
+		}
+
+		for(index = 0; (index < tx->NDTR) && (index < rx->NDTR); index++)
+		{
+			data = reinterpret_cast<volatile uint8_t *>(static_cast<uintptr_t>(tx->M0AR))[ ( (tx->CR & DMA_SxCR_MINC) != 0U ) ? index : 0U ];
+			reinterpret_cast<volatile uint8_t *>(static_cast<uintptr_t>(rx->M0AR))[ ( (rx->CR & DMA_SxCR_MINC) != 0U ) ? index : 0U ] = data;
+		}
+		tx->NDTR = 0;
+		rx->NDTR = 0;
+		tx->CR	&= ~DMA_SxCR_EN;
+		rx->CR	&= ~DMA_SxCR_EN;
+
+		CLEAR_BIT(spi->CR1, SPI_CR1_CSTART);
+		spi->SR = SPI_FLAG_EOT | SPI_FLAG_TXTF;
+		transaction_counter++;
+		DS_SPI_DmaInterruptHandler(spi_handle);
+	}
+	spi->SR = 0;
+}
+
+
+
+/**
+  * @brief Default copy constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+SPI_PORT::SPI_PORT(const SPI_PORT& orig)
+{
+}
+
+
+
+/**
+  * @brief Default destructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+SPI_PORT::~SPI_PORT()
+{
+}
+
+
+
+/**
+  * @brief Default constructor
+  *
+  * @param[in]  I2C_HandleTypeDef *handle : I2c Instance
+  *
+  * @return 	void
+  */
+I2C_PORT::I2C_PORT(I2C_HandleTypeDef *handle) :
+i2c_handle(handle)
+{ }
+
+
+
+/**
+  * @brief 		Runs the master transfers programmed in CR2 against one emulated register
+  *				device which answers on every address. The first written byte of a transfer
+  *				sets the register pointer, the next ones are stored, reads return the
+  *				registers from the pointer on. TXDR writes are found by a sentinel value,
+  *				RXDR is taken as read once the interrupt has seen RXNE.
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void I2C_PORT::service( void )
+{
+	uint16_t step_count = 0;
+
+	for(step_count = 0; step_count < I2C_MAXIMUM_STEP_COUNT; step_count++)
+	{
+		if(step() == false)
+		{
+			break;
+		}
+	}
+}
+
+
+
+/**
+  * @brief 		One bus event and, if its interrupt is enabled, one call of the event interrupt
+  *
+  * @param[in]  void
+  *
+  * @return 	bool : false if nothing changed
+  */
+bool I2C_PORT::step( void )
+{
+	const uint32_t IT_SOURCES = I2C_CR1_TXIE | I2C_CR1_RXIE | I2C_CR1_TCIE | I2C_CR1_STOPIE | I2C_CR1_NACKIE;
+	I2C_TypeDef *i2c	  = i2c_handle->Instance;
+	uint32_t	 snapshot = 0;
+	bool		 progress = false;
+
+	if( (i2c == nullptr) || ( (i2c->CR1 & I2C_CR1_PE) == 0U ) )
+	{
+		active = false;
+		return false;
+	}
+
+	/* ICR clears the flags at the same bit positions */
+	i2c->ISR &= ~i2c->ICR;
+	i2c->ICR  = 0;
+
+	if( (i2c->CR2 & I2C_CR2_START) != 0U )
+	{
+		i2c->CR2	 &= ~I2C_CR2_START;
+		i2c->ISR	 &= ~(I2C_ISR_TC | I2C_ISR_TCR | I2C_ISR_TXIS | I2C_ISR_RXNE);
+		i2c->ISR	 |= I2C_ISR_BUSY;
+		i2c->TXDR	  = I2C_TXDR_SENTINEL;
+		active		  = true;
+		reading		  = ( (i2c->CR2 & I2C_CR2_RD_WRN) != 0U );
+		pointer_write = (reading == false);
+		remaining	  = static_cast<uint8_t>( (i2c->CR2 & I2C_CR2_NBYTES) >> I2C_CR2_NBYTES_Pos );
+		loadNext();
+		progress	  = true;
+	}
+	else if( (i2c->CR2 & I2C_CR2_STOP) != 0U )
+	{
+		i2c->CR2 &= ~I2C_CR2_STOP;
+		i2c->ISR &= ~(I2C_ISR_TC | I2C_ISR_TCR | I2C_ISR_BUSY);
+		i2c->ISR |= I2C_ISR_STOPF;
+		active	  = false;
+		transfer_counter++;
+		progress  = true;
+	}
+	else if( (active == true) && (reading == false) && ( (i2c->ISR & I2C_ISR_TXIS) != 0U ) && (i2c->TXDR != I2C_TXDR_SENTINEL) )
+	{
+		if(pointer_write == true)
+		{
+			register_pointer = static_cast<uint8_t>(i2c->TXDR);
+			pointer_write	 = false;
+		}
+		else
+		{
+			device_register[register_pointer++] = static_cast<uint8_t>(i2c->TXDR);
+		}
+		i2c->TXDR  = I2C_TXDR_SENTINEL;
+		i2c->ISR  &= ~I2C_ISR_TXIS;
+		remaining--;
+		loadNext();
+		progress   = true;
+	}
+
+	snapshot = i2c->ISR ^ i2c->CR1 ^ i2c->CR2 ^ i2c->TXDR;
+	if( (i2c_handle->XferISR != nullptr) && ( (i2c->CR1 & IT_SOURCES) != 0U ) &&
+		( (i2c->ISR & (I2C_ISR_TXIS | I2C_ISR_RXNE | I2C_ISR_TC | I2C_ISR_TCR | I2C_ISR_STOPF | I2C_ISR_NACKF)) != 0U ) )
+	{
+		const bool received = ( (i2c->ISR & I2C_ISR_RXNE) != 0U ) && ( (i2c->CR1 & I2C_CR1_RXIE) != 0U );
+
+		i2c_handle->XferISR(i2c_handle, i2c->ISR, i2c->CR1);
+		i2c->ISR &= ~i2c->ICR;
+		i2c->ICR  = 0;
+
+		if( (received == true) && (active == true) && (reading == true) )
+		{
+			i2c->ISR &= ~I2C_ISR_RXNE;
+			remaining--;
+			loadNext();
+		}
+		progress |= ( received == true ) || ( snapshot != (i2c->ISR ^ i2c->CR1 ^ i2c->CR2 ^ i2c->TXDR) );
+	}
+
+	return progress;
+}
+
+
+
+/**
+  * @brief 		Presents the next byte of the transfer, or ends it as CR2 asks when NBYTES are done
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void I2C_PORT::loadNext( void )
+{
+	I2C_TypeDef *i2c = i2c_handle->Instance;
+
+	if(remaining != 0)
+	{
+		if(reading == true)
+		{
+			i2c->RXDR = device_register[register_pointer++];
+			i2c->ISR |= I2C_ISR_RXNE;
+		}
+		else
+		{
+			i2c->ISR |= I2C_ISR_TXIS;
+		}
+	}
+	else if( (i2c->CR2 & I2C_CR2_RELOAD) != 0U )
+	{
+		i2c->ISR |= I2C_ISR_TCR;
+	}
+	else if( (i2c->CR2 & I2C_CR2_AUTOEND) != 0U )
+	{
+		i2c->ISR &= ~I2C_ISR_BUSY;
+		i2c->ISR |= I2C_ISR_STOPF;
+		active	  = false;
+		transfer_counter++;
+	}
+	else
+	{
+		i2c->ISR |= I2C_ISR_TC;
+	}
+}
+
+
+
+/**
+  * @brief Default copy constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+I2C_PORT::I2C_PORT(const I2C_PORT& orig)
+{
+}
+
+
+
+/**
+  * @brief Default destructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+I2C_PORT::~I2C_PORT()
+{
+}
+
+
+
+/**
+  * @brief Default constructor
+  *
+  * @param[in]  FDCAN_GlobalTypeDef *instance : FDCAN registers
+  *
+  * @return 	void
+  */
+CAN_PORT::CAN_PORT(FDCAN_GlobalTypeDef *instance) :
+fdcan(instance)
+{ }
+
+
+
+/**
+  * @brief 		Sends the requested transmit buffers in identifier order and loops them back
+  *				through the filter list of the message RAM into the receive FIFOs, like the
+  *				internal loopback test mode. Everything is reset while INIT is set.
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void CAN_PORT::service( void )
+{
+	const uint32_t *transmit = reinterpret_cast<const uint32_t *>(SRAMCAN_BASE + (fdcan->TXBC & FDCAN_TXBC_TBSA_Msk));
+	uint32_t		selected = 0;
+	uint32_t		index	 = 0;
+	uint8_t			fifo	 = 0;
+
+	if( (fdcan->CCCR & FDCAN_CCCR_INIT) != 0U )
+	{
+		fdcan->TXBRP = 0;
+		fdcan->RXF0S = 0;
+		fdcan->RXF1S = 0;
+		updateTransmitStatus();
+		return;
+	}
+
+	while(fdcan->TXBRP != 0U)
+	{
+		/* Arbitration: lowest identifier first, standard ids are aligned to the extended ones */
+		selected = 32;
+		for(index = 0; index < 32; index++)
+		{
+			if( ( (fdcan->TXBRP & (1U << index)) != 0U ) &&
+				( (selected == 32) || ( (transmit[index * CAN_ELEMENT_WORDS] & 0x1FFFFFFFU) < (transmit[selected * CAN_ELEMENT_WORDS] & 0x1FFFFFFFU) ) ) )
+			{
+				selected = index;
+			}
+		}
+
+		if(filterFrame(&transmit[selected * CAN_ELEMENT_WORDS], fifo) == true)
+		{
+			storeFrame(&transmit[selected * CAN_ELEMENT_WORDS], fifo);
+		}
+		else
+		{
+			filtered_counter++;
+		}
+		fdcan->TXBRP &= ~(1U << selected);
+		fdcan->TXBTO |=  (1U << selected);
+		frame_counter++;
+	}
+	updateTransmitStatus();
+}
+
+
+
+bool CAN_PORT::isInstance( const FDCAN_GlobalTypeDef *instance ) const
+{
+	return (fdcan == instance);
+}
+
+
+
+/**
+  * @brief 		TXBAR write, the buffers become pending and the queue put index moves on
+  *
+  * @param[in]  uint32_t buffers
+  *
+  * @return 	void
+  */
+void CAN_PORT::requestTransmission( uint32_t buffers )
+{
+	fdcan->TXBAR  = buffers;
+	fdcan->TXBRP |= buffers;
+	updateTransmitStatus();
+}
+
+
+
+/**
+  * @brief 		RXFnA write, frees the elements up to and including index
+  *
+  * @param[in]  uint8_t fifo	 : 0 or 1
+  * @param[in]  uint32_t index
+  *
+  * @return 	void
+  */
+void CAN_PORT::acknowledge( uint8_t fifo, uint32_t index )
+{
+	__IO uint32_t &status = (fifo == 0) ? fdcan->RXF0S : fdcan->RXF1S;
+	const uint32_t size	  = ( ( (fifo == 0) ? fdcan->RXF0C : fdcan->RXF1C ) & FDCAN_RXF0C_F0S_Msk ) >> FDCAN_RXF0C_F0S_Pos;
+	const uint32_t get	  = (status & FDCAN_RXF0S_F0GI_Msk) >> FDCAN_RXF0S_F0GI_Pos;
+	uint32_t	   level  = (status & FDCAN_RXF0S_F0FL_Msk) >> FDCAN_RXF0S_F0FL_Pos;
+	const uint32_t freed  = ( (index + size - get) % size ) + 1;
+
+	if( (size == 0) || (freed > level) )
+	{
+		return;
+	}
+
+	level -= freed;
+	status = level | ( ( (index + 1) % size ) << FDCAN_RXF0S_F0GI_Pos ) | ( ( (index + 1 + level) % size ) << FDCAN_RXF0S_F0PI_Pos );
+}
+
+
+
+/**
+  * @brief 		Runs a frame through the standard or extended filter list, only classic id and
+  *				mask elements are modelled. Non-matching frames follow GFC.
+  *
+  * @param[in]  const uint32_t element[] : Transmit element
+  * @param[out] uint8_t &fifo			 : Receive FIFO of an accepted frame
+  *
+  * @return 	bool : false if the frame is rejected
+  */
+bool CAN_PORT::filterFrame( const uint32_t element[], uint8_t &fifo ) const
+{
+	const bool	   extended = ( (element[0] & 0x40000000U) != 0U );
+	const uint32_t id		= (extended == true) ? (element[0] & 0x1FFFFFFFU) : ( (element[0] >> 18) & 0x7FFU );
+	uint32_t	   index	= 0;
+	uint32_t	   store	= 0;
+	uint32_t	   other	= 0;
+
+	if(extended == true)
+	{
+		const uint32_t *list   = reinterpret_cast<const uint32_t *>(SRAMCAN_BASE + (fdcan->XIDFC & FDCAN_XIDFC_FLESA_Msk));
+		const uint32_t	number = (fdcan->XIDFC & FDCAN_XIDFC_LSE_Msk) >> FDCAN_XIDFC_LSE_Pos;
+
+		for(index = 0; index < number; index++)
+		{
+			const uint32_t mask = list[(index * 2) + 1] & 0x1FFFFFFFU;
+
+			store = list[index * 2] >> 29;
+			if( ( (list[(index * 2) + 1] >> 30) == 2U ) && ( (id & mask) == (list[index * 2] & mask) ) && (store >= 1U) && (store <= 2U) )
+			{
+				fifo = static_cast<uint8_t>(store - 1);
+				return true;
+			}
+		}
+		other = (fdcan->GFC & FDCAN_GFC_ANFE_Msk) >> FDCAN_GFC_ANFE_Pos;
+	}
+	else
+	{
+		const uint32_t *list   = reinterpret_cast<const uint32_t *>(SRAMCAN_BASE + (fdcan->SIDFC & FDCAN_SIDFC_FLSSA_Msk));
+		const uint32_t	number = (fdcan->SIDFC & FDCAN_SIDFC_LSS_Msk) >> FDCAN_SIDFC_LSS_Pos;
+
+		for(index = 0; index < number; index++)
+		{
+			const uint32_t mask = list[index] & 0x7FFU;
+
+			store = (list[index] >> 27) & 0x7U;
+			if( ( (list[index] >> 30) == 2U ) && ( (id & mask) == ( (list[index] >> 16) & mask ) ) && (store >= 1U) && (store <= 2U) )
+			{
+				fifo = static_cast<uint8_t>(store - 1);
+				return true;
+			}
+		}
+		other = (fdcan->GFC & FDCAN_GFC_ANFS_Msk) >> FDCAN_GFC_ANFS_Pos;
+	}
+
+	fifo = static_cast<uint8_t>(other);
+	return (other < 2U);
+}
+
+
+
+/**
+  * @brief 		Copies a frame into the put position of a receive FIFO, a full FIFO drops it
+  *				and raises the message lost flag like the blocking mode
+  *
+  * @param[in]  const uint32_t element[]
+  * @param[in]  uint8_t fifo
+  *
+  * @return 	void
+  */
+void CAN_PORT::storeFrame( const uint32_t element[], uint8_t fifo )
+{
+	__IO uint32_t  &status		 = (fifo == 0) ? fdcan->RXF0S : fdcan->RXF1S;
+	const uint32_t	configuration = (fifo == 0) ? fdcan->RXF0C : fdcan->RXF1C;
+	const uint32_t	size		 = (configuration & FDCAN_RXF0C_F0S_Msk) >> FDCAN_RXF0C_F0S_Pos;
+	const uint32_t	get			 = (status & FDCAN_RXF0S_F0GI_Msk) >> FDCAN_RXF0S_F0GI_Pos;
+	uint32_t		level		 = (status & FDCAN_RXF0S_F0FL_Msk) >> FDCAN_RXF0S_F0FL_Pos;
+	uint32_t	   *elements	 = reinterpret_cast<uint32_t *>(SRAMCAN_BASE + (configuration & FDCAN_RXF0C_F0SA_Msk));
+
+	if( (size == 0) || (level >= size) )
+	{
+		fdcan->IR |= (fifo == 0) ? FDCAN_IR_RF0L : FDCAN_IR_RF1L;
+		return;
+	}
+
+	std::memcpy(&elements[( (get + level) % size ) * CAN_ELEMENT_WORDS], element, CAN_ELEMENT_WORDS * sizeof(uint32_t));
+	level++;
+	status = level | (get << FDCAN_RXF0S_F0GI_Pos) | ( ( (get + level) % size ) << FDCAN_RXF0S_F0PI_Pos ) |
+			 ( (level == size) ? FDCAN_RXF0S_F0F : 0U );
+	fdcan->IR |= (fifo == 0) ? FDCAN_IR_RF0N : FDCAN_IR_RF1N;
+}
+
+
+
+/**
+  * @brief 		TXFQS of the queue mode: lowest free buffer as put index, full flag
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void CAN_PORT::updateTransmitStatus( void )
+{
+	const uint32_t size	 = (fdcan->TXBC & FDCAN_TXBC_TFQS_Msk) >> FDCAN_TXBC_TFQS_Pos;
+	uint32_t	   index = 0;
+
+	while( (index < size) && ( (fdcan->TXBRP & (1U << index)) != 0U ) )
+	{
+		index++;
+	}
+
+	fdcan->TXFQS = (index < size) ? (index << FDCAN_TXFQS_TFQPI_Pos) : FDCAN_TXFQS_TFQF;
+}
+
+
+
+/**
+  * @brief Default copy constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+CAN_PORT::CAN_PORT(const CAN_PORT& orig)
+{
+}
+
+
+
+/**
+  * @brief Default destructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+CAN_PORT::~CAN_PORT()
+{
+}
+#endif
+
+
+
+/**
+  * @brief Default constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+BOARD::BOARD()
+{ }
+
+
+
+/**
+  * @brief 		Runs the same peripheral init sequence as Core/Src/main.c of the core
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void BOARD::initialize( void )
+{
+#ifdef CORE_CM7
+	MX_GPIO_Init();
+	MX_LPUART1_UART_Init();
+	MX_UART4_Init();
+	MX_UART5_Init();
+	MX_UART7_Init();
+	MX_UART8_Init();
+	MX_USART1_UART_Init();
+	MX_USART2_UART_Init();
+	MX_USART3_UART_Init();
+	MX_USART6_UART_Init();
+	MX_TIM2_Init();
+	MX_TIM5_Init();
+	MX_TIM6_Init();
+	MX_TIM13_Init();
+	MX_I2C4_Init();
+	MX_SPI2_Init();
+	HAL_TIM_Base_Start(&htim5);
+	HAL_TIM_Base_Start(&htim2);
+	HAL_TIM_Base_Start_IT(&htim6);
+#endif
+#ifdef CORE_CM4
+	MX_GPIO_Init();
+	MX_TIM7_Init();
+	MX_FATFS_Init();
+	sd_card.format();
+
+	/* TIM2 and TIM5 are configured by CM7 on the target, this process has no handle for them */
+	TIM2->PSC = 239;
+	TIM5->PSC = 59999;
+	SET_BIT(TIM2->CR1, TIM_CR1_CEN);
+	SET_BIT(TIM5->CR1, TIM_CR1_CEN);
+
+	HAL_TIM_Base_Start_IT(&htim7);
+#endif
+}
+
+
+
+/**
+  * @brief 		Gives every simulated peripheral the chance to progress and raises the HSEM
+  *				interrupt of this core when the other core freed a notified semaphore
+  *
+  * @param[in]  uint32_t elapsed_us : Virtual time since the last call
+  *
+  * @return 	void
+  */
+void BOARD::servicePeripherals( uint32_t elapsed_us )
+{
+#ifdef CORE_CM7
+	sim_lpuart1.service(elapsed_us);
+	sim_uart1.service(elapsed_us);
+	sim_uart2.service(elapsed_us);
+	sim_uart3.service(elapsed_us);
+	sim_uart4.service(elapsed_us);
+	sim_uart5.service(elapsed_us);
+	sim_uart6.service(elapsed_us);
+	sim_uart7.service(elapsed_us);
+	sim_uart8.service(elapsed_us);
+	sim_spi2.service();
+	sim_i2c4.service();
+	sim_fdcan1.service();
+#endif
+
+	if( (HSEM_COMMON->ISR & HSEM_COMMON->IER) != 0 )
+	{
+		HAL_HSEM_IRQHandler();
+	}
+}
+
+
+
+/**
+  * @brief Default copy constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+BOARD::BOARD(const BOARD& orig)
+{
+}
+
+
+
+/**
+  * @brief Default destructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+BOARD::~BOARD()
+{
+}
+
+
+
+} //End of namespace Simulation
+
+
+
+static uint32_t crc_unit_state = 0;	///< Unreflected remainder of the modelled CRC unit
+
+
+
+/**
+  * @brief 		Output of the modelled CRC unit: POLYSIZE wide, bit reversed if REV_OUT is set
+  */
+static void updateCrcOutput(CRC_TypeDef *crc_unit, uint8_t width)
+{
+	uint32_t output = crc_unit_state;
+	uint8_t	 bit	= 0;
+
+	if( (crc_unit->CR & CRC_CR_REV_OUT) != 0U )
+	{
+		output = 0;
+		for(bit = 0; bit < width; bit++)
+		{
+			output |= ( (crc_unit_state >> bit) & 1U ) << (width - 1 - bit);
+		}
+	}
+	crc_unit->DR = output;
+}
+
+
+
+static uint8_t getCrcWidth(const CRC_TypeDef *crc_unit)
+{
+	static const uint8_t WIDTH[] = { 32, 16, 8, 7 };
+
+	return WIDTH[(crc_unit->CR & CRC_CR_POLYSIZE_Msk) >> CRC_CR_POLYSIZE_Pos];
+}
+
+
+
+/**
+  * @brief 		CR RESET and DR writes of CRC16. The unit is modelled bit by bit from POL, INIT
+  *				and CR, REV_IN is modelled for the none and byte modes only.
+  */
+void simulateCrcReset(CRC_TypeDef *crc_unit)
+{
+	const uint8_t width = getCrcWidth(crc_unit);
+
+	crc_unit_state = crc_unit->INIT & ( (width == 32) ? 0xFFFFFFFFU : ((1U << width) - 1U) );
+	updateCrcOutput(crc_unit, width);
+}
+
+
+
+void simulateCrcData(CRC_TypeDef *crc_unit, uint32_t data, uint8_t size)
+{
+	const uint8_t  width = getCrcWidth(crc_unit);
+	const uint32_t mask	 = (width == 32) ? 0xFFFFFFFFU : ((1U << width) - 1U);
+	uint8_t		   value = 0;
+	uint8_t		   byte	 = 0;
+	uint8_t		   bit	 = 0;
+
+	for(byte = size; byte > 0; byte--)
+	{
+		value = static_cast<uint8_t>(data >> ((byte - 1) * 8));
+		if( (crc_unit->CR & CRC_CR_REV_IN_Msk) == CRC_CR_REV_IN_0 )
+		{
+			value = static_cast<uint8_t>(__RBIT(value) >> 24);
+		}
+
+		for(bit = 0; bit < 8; bit++)
+		{
+			const uint32_t feedback = ( (crc_unit_state >> (width - 1)) ^ (value >> (7 - bit)) ) & 1U;
+
+			crc_unit_state = (crc_unit_state << 1) & mask;
+			if(feedback != 0U)
+			{
+				crc_unit_state ^= crc_unit->POL & mask;
+			}
+		}
+	}
+	updateCrcOutput(crc_unit, width);
+}
+
+
+
+#ifdef CORE_CM7
+/**
+  * @brief 		Finds the simulated port of a U(S)ART, nullptr for an unknown instance
+  */
+static Simulation::UART_PORT* findUartPort(const USART_TypeDef *usart)
+{
+	static Simulation::UART_PORT * const PORT_LIST[] = { &sim_lpuart1, &sim_uart1, &sim_uart2, &sim_uart3, &sim_uart4,
+														 &sim_uart5,   &sim_uart6, &sim_uart7, &sim_uart8 };
+	uint8_t index = 0;
+
+	for(index = 0; index < (sizeof(PORT_LIST) / sizeof(PORT_LIST[0])); index++)
+	{
+		if(PORT_LIST[index]->isInstance(usart) == true)
+		{
+			return PORT_LIST[index];
+		}
+	}
+
+	return nullptr;
+}
+
+
+
+/**
+  * @brief 		RDR and TDR accesses of H747_UART, a read or a write moves the modelled FIFO
+  */
+uint8_t simulateReceiveRegister(USART_TypeDef *usart)
+{
+	Simulation::UART_PORT *port = findUartPort(usart);
+
+	return (port != nullptr) ? port->readReceiveRegister() : static_cast<uint8_t>(usart->RDR);
+}
+
+
+
+void simulateTransmitRegister(USART_TypeDef *usart, uint8_t data)
+{
+	Simulation::UART_PORT *port = findUartPort(usart);
+
+	if(port != nullptr)
+	{
+		port->writeTransmitRegister(data);
+	}
+}
+
+
+
+/**
+  * @brief 		TXBAR and RXFnA writes of H747_CAN, only FDCAN1 is modelled
+  */
+void simulateCanTransmitRequest(FDCAN_GlobalTypeDef *fdcan, uint32_t buffers)
+{
+	if(sim_fdcan1.isInstance(fdcan) == true)
+	{
+		sim_fdcan1.requestTransmission(buffers);
+	}
+}
+
+
+
+void simulateCanAcknowledge(FDCAN_GlobalTypeDef *fdcan, uint8_t fifo, uint32_t index)
+{
+	if(sim_fdcan1.isInstance(fdcan) == true)
+	{
+		sim_fdcan1.acknowledge(fifo, index);
+	}
+}
+#endif
+
+
+
+/*
+ * Begin of HAL Stand-in Functions
+ */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+
+uint32_t HAL_GetTick(void)
+{
+	virtual_clock.advance_us(Simulation::POLL_COST_US);
+	return virtual_clock.getTick_ms();
+}
+
+
+
+void HAL_Delay(uint32_t Delay)
+{
+	virtual_clock.advance_us(Delay * 1000);
+}
+
+
+
+void Error_Handler(void)
+{
+	std::fprintf(stderr, "[sim] Error_Handler called\n");
+	std::exit(EXIT_FAILURE);
+}
+
+
+
+void HAL_NVIC_SystemReset(void)
+{
+	std::fprintf(stderr, "[sim] system reset requested at %llu us\n",
+				 static_cast<unsigned long long>(virtual_clock.getTime_us()));
+	std::exit(EXIT_SUCCESS);
+}
+
+
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+}
+
+
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+}
+
+
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+}
+
+
+
+/**
+  * @brief 		MPU registers on the mapped private peripheral space, the host does not enforce them
+  */
+void HAL_MPU_Disable(void)
+{
+	MPU->CTRL = 0;
+}
+
+
+
+void HAL_MPU_Enable(uint32_t MPU_Control)
+{
+	MPU->CTRL = MPU_Control | MPU_CTRL_ENABLE_Msk;
+}
+
+
+
+void HAL_MPU_ConfigRegion(MPU_Region_InitTypeDef *MPU_Init)
+{
+	MPU->RNR  = MPU_Init->Number;
+	MPU->RBAR = MPU_Init->BaseAddress;
+	MPU->RASR = (static_cast<uint32_t>(MPU_Init->DisableExec)		<< MPU_RASR_XN_Pos)	  |
+				(static_cast<uint32_t>(MPU_Init->AccessPermission)	<< MPU_RASR_AP_Pos)	  |
+				(static_cast<uint32_t>(MPU_Init->TypeExtField)		<< MPU_RASR_TEX_Pos)  |
+				(static_cast<uint32_t>(MPU_Init->IsShareable)		<< MPU_RASR_S_Pos)	  |
+				(static_cast<uint32_t>(MPU_Init->IsCacheable)		<< MPU_RASR_C_Pos)	  |
+				(static_cast<uint32_t>(MPU_Init->IsBufferable)		<< MPU_RASR_B_Pos)	  |
+				(static_cast<uint32_t>(MPU_Init->SubRegionDisable)	<< MPU_RASR_SRD_Pos)  |
+				(static_cast<uint32_t>(MPU_Init->Size)				<< MPU_RASR_SIZE_Pos) |
+				(static_cast<uint32_t>(MPU_Init->Enable)			<< MPU_RASR_ENABLE_Pos);
+}
+
+
+
+/**
+  * @brief 		HSEM on the shared page. A free semaphore sets the status bit of both interrupt
+  *				lines, BOARD::servicePeripherals raises the interrupt of this core when its bit is
+  *				enabled. ISR & IER stands in for MISR, the ISR bits are cleared instead of ICR writes.
+  */
+HAL_StatusTypeDef HAL_HSEM_FastTake(uint32_t SemID)
+{
+	uint32_t free_value = 0;
+
+	if(__atomic_compare_exchange_n(&HSEM->R[SemID], &free_value, HSEM_R_LOCK | HSEM_CR_COREID_CURRENT,
+								   false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) == true)
+	{
+		return HAL_OK;
+	}
+
+	return HAL_ERROR;
+}
+
+
+
+void HAL_HSEM_Release(uint32_t SemID, uint32_t ProcessID)
+{
+	const uint32_t mask = __HAL_HSEM_SEMID_TO_MASK(SemID);
+
+	if(HSEM->R[SemID] == (HSEM_R_LOCK | HSEM_CR_COREID_CURRENT | ProcessID))
+	{
+		__atomic_store_n(&HSEM->R[SemID], 0, __ATOMIC_RELEASE);
+		__atomic_fetch_or(&HSEM->C1ISR, mask, __ATOMIC_RELEASE);
+		__atomic_fetch_or(&HSEM->C2ISR, mask, __ATOMIC_RELEASE);
+	}
+}
+
+
+
+void HAL_HSEM_ActivateNotification(uint32_t SemMask)
+{
+	HSEM_COMMON->IER |= SemMask;
+}
+
+
+
+void HAL_HSEM_DeactivateNotification(uint32_t SemMask)
+{
+	HSEM_COMMON->IER &= ~SemMask;
+}
+
+
+
+void HAL_HSEM_IRQHandler(void)
+{
+	const uint32_t status = __atomic_load_n(&HSEM_COMMON->ISR, __ATOMIC_ACQUIRE) & HSEM_COMMON->IER;
+
+	HSEM_COMMON->IER &= ~status;
+	__atomic_fetch_and(&HSEM_COMMON->ISR, ~status, __ATOMIC_RELEASE);
+	HAL_HSEM_FreeCallback(status);
+}
+
+
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+}
+
+
+
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin)
+{
+}
+
+
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+	return ( (GPIOx->ODR & GPIO_Pin) != 0U ) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+	if(PinState != GPIO_PIN_RESET)
+	{
+		GPIOx->ODR |= GPIO_Pin;
+	}
+	else
+	{
+		GPIOx->ODR &= ~static_cast<uint32_t>(GPIO_Pin);
+	}
+}
+
+
+
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+	GPIOx->ODR ^= GPIO_Pin;
+}
+
+
+
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *htim)
+{
+	htim->Instance->PSC = htim->Init.Prescaler;
+	htim->Instance->ARR = htim->Init.Period;
+	htim->State			= HAL_TIM_STATE_READY;
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_TIM_ConfigClockSource(TIM_HandleTypeDef *htim, TIM_ClockConfigTypeDef *sClockSourceConfig)
+{
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_TIMEx_MasterConfigSynchronization(TIM_HandleTypeDef *htim, TIM_MasterConfigTypeDef *sMasterConfig)
+{
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_TIM_Base_Start(TIM_HandleTypeDef *htim)
+{
+	SET_BIT(htim->Instance->CR1, TIM_CR1_CEN);
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim)
+{
+	SET_BIT(htim->Instance->DIER, TIM_DIER_UIE);
+	SET_BIT(htim->Instance->CR1, TIM_CR1_CEN);
+	virtual_clock.startTimer(htim);
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_TIM_Base_Stop_IT(TIM_HandleTypeDef *htim)
+{
+	CLEAR_BIT(htim->Instance->DIER, TIM_DIER_UIE);
+	CLEAR_BIT(htim->Instance->CR1, TIM_CR1_CEN);
+	virtual_clock.stopTimer(htim);
+	return HAL_OK;
+}
+
+
+
+#ifdef CORE_CM7
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
+{
+	if(huart->Init.BaudRate != 0)
+	{
+		huart->Instance->BRR = Simulation::UART_KERNEL_CLOCK_HZ / huart->Init.BaudRate;
+	}
+	huart->Instance->CR1 = USART_CR1_UE | USART_CR1_TE | USART_CR1_RE;
+	huart->gState		 = HAL_UART_STATE_READY;
+	huart->RxState		 = HAL_UART_STATE_READY;
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_HalfDuplex_Init(UART_HandleTypeDef *huart)
+{
+	return HAL_UART_Init(huart);
+}
+
+
+
+HAL_StatusTypeDef HAL_UART_DeInit(UART_HandleTypeDef *huart)
+{
+	huart->Instance->CR1 = 0;
+	huart->Instance->CR3 = 0;
+	huart->gState		 = HAL_UART_STATE_RESET;
+	huart->RxState		 = HAL_UART_STATE_RESET;
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_UARTEx_SetTxFifoThreshold(UART_HandleTypeDef *huart, uint32_t Threshold)
+{
+	MODIFY_REG(huart->Instance->CR3, USART_CR3_TXFTCFG, Threshold);
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_UARTEx_SetRxFifoThreshold(UART_HandleTypeDef *huart, uint32_t Threshold)
+{
+	MODIFY_REG(huart->Instance->CR3, USART_CR3_RXFTCFG, Threshold);
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_UARTEx_DisableFifoMode(UART_HandleTypeDef *huart)
+{
+	CLEAR_BIT(huart->Instance->CR1, USART_CR1_FIFOEN);
+	huart->FifoMode = UART_FIFOMODE_DISABLE;
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_UARTEx_EnableFifoMode(UART_HandleTypeDef *huart)
+{
+	SET_BIT(huart->Instance->CR1, USART_CR1_FIFOEN);
+	huart->FifoMode = UART_FIFOMODE_ENABLE;
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma)
+{
+	hdma->State = HAL_DMA_STATE_READY;
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_DMA_Start(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength)
+{
+	DMA_Stream_TypeDef *stream = static_cast<DMA_Stream_TypeDef *>(hdma->Instance);
+
+	if(hdma->Init.Direction == DMA_MEMORY_TO_PERIPH)
+	{
+		stream->M0AR = SrcAddress;
+		stream->PAR	 = DstAddress;
+	}
+	else
+	{
+		stream->PAR	 = SrcAddress;
+		stream->M0AR = DstAddress;
+	}
+	stream->NDTR = DataLength;
+	stream->CR	|= DMA_SxCR_EN;
+	hdma->State	 = HAL_DMA_STATE_BUSY;
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *hdma)
+{
+	static_cast<DMA_Stream_TypeDef *>(hdma->Instance)->CR &= ~DMA_SxCR_EN;
+	hdma->State = HAL_DMA_STATE_READY;
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi)
+{
+	hspi->State = HAL_SPI_STATE_READY;
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c)
+{
+	SET_BIT(hi2c->Instance->CR1, I2C_CR1_PE);
+	hi2c->State = HAL_I2C_STATE_READY;
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_I2CEx_ConfigAnalogFilter(I2C_HandleTypeDef *hi2c, uint32_t AnalogFilter)
+{
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_I2CEx_ConfigDigitalFilter(I2C_HandleTypeDef *hi2c, uint32_t DigitalFilter)
+{
+	return HAL_OK;
+}
+#endif
+
+
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void)
+{
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_FLASH_Lock(void)
+{
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_FLASH_OB_Unlock(void)
+{
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_FLASH_OB_Lock(void)
+{
+	return HAL_OK;
+}
+
+
+
+HAL_StatusTypeDef HAL_FLASH_OB_Launch(void)
+{
+	return HAL_OK;
+}
+
+
+
+void HAL_FLASHEx_OBGetConfig(FLASH_OBProgramInitTypeDef *pOBInit)
+{
+	std::memset(pOBInit, 0, sizeof(FLASH_OBProgramInitTypeDef));
+}
+
+
+
+HAL_StatusTypeDef HAL_FLASHEx_OBProgram(FLASH_OBProgramInitTypeDef *pOBInit)
+{
+	return HAL_OK;
+}
+
+
+
+#ifdef __cplusplus
+}
+#endif
+// End of HAL Stand-in Functions
@@ -0,0 +1,187 @@
+/**
+ ******************************************************************************
+  * @file		: ds_sim_main_cm4.cpp
+  * @brief		: Host side benchmark runner of the CM4 application
+  *				  This file runs the DASAL hot paths of the CM4 core against the
+  *				  simulated HAL and reports the host time spent per call
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+
+/*
+ * Begin of Includes
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "ds_sim_hal.hpp"
+#include "ds_main.hpp"
+#include "ds_telemetry_core.hpp"
+#include "ds_fatfs_h747.hpp"
+#include "ds_datalogger.hpp"
+// End of Includes
+
+
+
+/*
+ * Begin of Macro Definitions
+ */
+static const uint32_t BENCH_SHARED_ADDRESS	= 0x2407E000;	///< Unused AXI SRAM above the datalogger and UART DMA buffers
+static const uint16_t BENCH_PAYLOAD_SIZE	= 512;
+//End of Macro Definitions
+
+
+
+/*
+ * Begin of Enum, Union and Struct Definitions
+ */
+struct benchmark_type
+{
+	const char *name;
+	bool		(*function)(void);		///< Returns false when the hot path reported an error
+	uint32_t	iterations;
+};
+// End of Enum, Union and Struct Definitions
+
+
+
+/**
+  * @brief 		Core telemetry frame written to and parsed back from the shared RAM, CRC16 on both sides
+  */
+static bool benchCoreTelemetrySharedRam( void )
+{
+	static uint8_t data[BENCH_PAYLOAD_SIZE];
+	static uint8_t payload[BENCH_PAYLOAD_SIZE];
+
+	data[0]++;
+	telemetry_core.sendPacketToSharedBuff(BENCH_SHARED_ADDRESS, static_cast<uint16_t>(Telemetry::command_type::TEST_PARAMETERS), data, BENCH_PAYLOAD_SIZE);
+	return telemetry_core.receivePacketFromSharedBuff(BENCH_SHARED_ADDRESS, payload, BENCH_PAYLOAD_SIZE);
+}
+
+
+
+/**
+  * @brief 		One datalogger sized block appended and synced to the SD card
+  */
+static bool benchFatfsWrite( void )
+{
+	static uint8_t block[Datalogger::MAX_SIZE_WRITE];
+
+	block[0]++;
+	return ( fatfs.updateFile(nullptr, block, Datalogger::MAX_SIZE_WRITE, Middlewares::fatfs_cmd_t::WRITE) == Middlewares::fatfs_result_t::FR_OK );
+}
+
+
+
+/**
+  * @brief 		Every rate slot of the scheduler once
+  */
+static bool benchSchedulerSlots( void )
+{
+	task.task800Hz();
+	task.task400Hz();
+	task.task200Hz();
+	task.task100Hz();
+	task.task50Hz();
+	task.task20Hz();
+	task.task10Hz();
+	task.task5Hz();
+	task.task2Hz();
+	task.task1Hz();
+	return true;
+}
+
+
+
+static const benchmark_type BENCHMARK[] =
+{
+	{ "core_telemetry_shared_ram_512B",	benchCoreTelemetrySharedRam,	20000 },
+	{ "fatfs_write_sync_56KB",			benchFatfsWrite,				  500 },
+	{ "scheduler_all_slots",			benchSchedulerSlots,			20000 },
+};
+
+
+
+/**
+  * @brief 		Runs every benchmark, iterations are scaled with the first argument
+  *
+  * @param[in]  int argc
+  * @param[in]  char *argv[] : argv[1] iteration scale, default 1
+  *
+  * @return 	int
+  */
+int main(int argc, char *argv[])
+{
+	const uint8_t BENCHMARK_NUMBER = sizeof(BENCHMARK) / sizeof(BENCHMARK[0]);
+	static char	  file_name[]	   = "bench.bin";
+	uint32_t	  scale			   = 1;
+	uint8_t		  index			   = 0;
+	uint32_t	  iteration		   = 0;
+	uint32_t	  error_counter	   = 0;
+	int			  result		   = EXIT_SUCCESS;
+
+	if(argc > 1)
+	{
+		scale = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+	}
+
+	board.initialize();
+	task.init();
+
+	if( (fatfs.connect() != Middlewares::fatfs_result_t::FR_OK) ||
+		(fatfs.createFile(file_name) != Middlewares::fatfs_result_t::FR_OK) ||
+		(fatfs.updateFile(file_name, nullptr, 0, Middlewares::fatfs_cmd_t::OPEN) != Middlewares::fatfs_result_t::FR_OK) )
+	{
+		std::fprintf(stderr, "[sim] SD card image can not be prepared\n");
+		return EXIT_FAILURE;
+	}
+
+	std::printf("%-32s %10s %12s %10s %8s\n", "benchmark", "iterations", "total_ms", "ns/call", "errors");
+	for(index = 0; index < BENCHMARK_NUMBER; index++)
+	{
+		const uint32_t iterations = BENCHMARK[index].iterations * scale;
+		error_counter = 0;
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for(iteration = 0; iteration < iterations; iteration++)
+		{
+			if(BENCHMARK[index].function() == false)
+			{
+				error_counter++;
+			}
+		}
+		std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+
+		std::printf("%-32s %10u %12.3f %10.1f %8u\n", BENCHMARK[index].name, iterations,
+					static_cast<double>(elapsed.count()) / 1e6,
+					( iterations > 0 ) ? static_cast<double>(elapsed.count()) / iterations : 0.0,
+					error_counter);
+		if(error_counter != 0)
+		{
+			result = EXIT_FAILURE;
+		}
+	}
+
+	fatfs.updateFile(file_name, nullptr, 0, Middlewares::fatfs_cmd_t::CLOSE);
+
+	return result;
+}
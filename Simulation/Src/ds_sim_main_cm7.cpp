@@ -0,0 +1,719 @@
+/**
+ ******************************************************************************
+  * @file		: ds_sim_main_cm7.cpp
+  * @brief		: Host side benchmark runner of the CM7 application
+  *				  This file runs the DASAL hot paths of the CM7 core against the
+  *				  simulated HAL and reports the host time spent per call
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+
+/*
+ * Begin of Includes
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "ds_sim_hal.hpp"
+#include "ds_main.hpp"
+#include "ds_uart_h747.hpp"
+#include "ds_spi_h747.hpp"
+#include "ds_i2c_h747.hpp"
+#include "ds_can_h747.hpp"
+#include "ds_sbus2.hpp"
+#include "ds_work_queue.hpp"
+#include "ds_telemetry_core.hpp"
+#include "ds_telemetry_gcs.hpp"
+#include "ds_telemetry_router.hpp"
+#include "ds_telemetry_can.hpp"
+#include "ds_telemetry_mc.hpp"
+#include "ds_telemetry_scheduler.hpp"
+#include "ds_shared_ram_h747.hpp"
+#include "ds_ring_buffer.hpp"
+#include "ds_state_sync.hpp"
+#include "ds_serializer.hpp"
+#include "ds_crc16.hpp"
+// End of Includes
+
+
+
+/*
+ * Begin of Macro Definitions
+ */
+static const uint32_t BENCH_SHARED_ADDRESS	 = 0x2407E000;	///< Unused AXI SRAM above the datalogger and UART DMA buffers
+static const uint16_t BENCH_PAYLOAD_SIZE	 = 512;
+static const uint16_t BENCH_SERIALIZER_PACKET_SIZE = 905;	///< Datalogger packet with the core telemetry frame, 896 + 9 bytes
+static const uint16_t BENCH_CRC_SIZE		 = 896;			///< One datalogger record
+static const uint16_t BENCH_UART_BLOCK_SIZE	 = 256;
+static const uint16_t BENCH_GCS_PAYLOAD_SIZE = 64;
+static const uint16_t BENCH_FLOOD_PAYLOAD_SIZE = 193;		///< 200 byte frames at 100Hz, almost twice the uart3 capacity
+static const uint32_t BENCH_SPI_ADDRESS		 = 0x2407E400;	///< Transmit block followed by the receive blocks, below the SPI dummy bytes
+static const uint16_t BENCH_SPI_BLOCK_SIZE	 = 1024;
+static const uint8_t  BENCH_SPI_TRANSACTIONS = 4;
+static const uint8_t  SBUS_FRAME_SIZE		 = 25;
+static const uint32_t BENCH_CAN_CRITICAL_ID	 = 0x120;		///< Standard id filtered into FIFO0
+static const uint32_t BENCH_CAN_REJECTED_ID	 = 0x300;		///< Not in the filter list
+static const uint32_t BENCH_CAN_LOW_ID		 = 0x18DA10F1;	///< Extended id filtered into FIFO1
+static const uint8_t  BENCH_TASK_NUMBER	 = 13;			///< Periodic and event tasks of registerVehicleTasks
+static const uint16_t BENCH_CAN_TELEMETRY_SIZE = Telemetry::TELEMETRY_5HZ_TX_BUFFER_SIZE;
+//End of Macro Definitions
+
+
+
+/*
+ * Begin of Enum, Union and Struct Definitions
+ */
+struct benchmark_type
+{
+	const char *name;
+	bool		(*function)(void);		///< Returns false when the hot path reported an error
+	uint32_t	iterations;
+};
+// End of Enum, Union and Struct Definitions
+
+
+
+/**
+  * @brief 		Core telemetry frame written to and parsed back from the shared RAM, CRC16 on both sides
+  */
+static bool benchCoreTelemetrySharedRam( void )
+{
+	static uint8_t data[BENCH_PAYLOAD_SIZE];
+	static uint8_t payload[BENCH_PAYLOAD_SIZE];
+
+	data[0]++;
+	telemetry_core.sendPacketToSharedBuff(BENCH_SHARED_ADDRESS, static_cast<uint16_t>(Telemetry::command_type::TEST_PARAMETERS), data, BENCH_PAYLOAD_SIZE);
+	return telemetry_core.receivePacketFromSharedBuff(BENCH_SHARED_ADDRESS, payload, BENCH_PAYLOAD_SIZE);
+}
+
+
+
+/**
+  * @brief 		Serializer sized packet copied to an odd shared RAM address and read back
+  */
+static bool benchSharedRamCopy( void )
+{
+	static uint8_t data[BENCH_SERIALIZER_PACKET_SIZE];
+	static uint8_t buffer[BENCH_SERIALIZER_PACKET_SIZE + 1];
+
+	data[0]++;
+	data[BENCH_SERIALIZER_PACKET_SIZE - 1] = data[0];
+	inter_core.sendDataToSharedRam(BENCH_SHARED_ADDRESS + 1, data, BENCH_SERIALIZER_PACKET_SIZE);
+	inter_core.getDataFromSharedRam(BENCH_SHARED_ADDRESS + 1, &buffer[1], BENCH_SERIALIZER_PACKET_SIZE);
+
+	return ( std::memcmp(data, &buffer[1], BENCH_SERIALIZER_PACKET_SIZE) == 0 );
+}
+
+
+
+/**
+  * @brief 		Block through the CM7 to CM4 ring of the SRAM4, read back as the CM4 would
+  */
+static bool benchInterCoreRing( void )
+{
+	typedef Tools::RING_BUFFER<uint8_t, 0x4000> shared_ring_type;
+	shared_ring_type * const cm4_receive_ring = reinterpret_cast<shared_ring_type *>(0x38000000);
+	static uint8_t data[BENCH_PAYLOAD_SIZE];
+	uint8_t		   buffer[BENCH_PAYLOAD_SIZE];
+
+	*reinterpret_cast<volatile uint32_t *>(0x3800FF30) += 1;	///< CM4 heartbeat
+	inter_core.scheduler();
+
+	data[0]++;
+	return ( (inter_core.sendData(data, BENCH_PAYLOAD_SIZE) == BENCH_PAYLOAD_SIZE) &&
+			 (cm4_receive_ring->popBulk(buffer, BENCH_PAYLOAD_SIZE) == BENCH_PAYLOAD_SIZE) && (buffer[0] == data[0]) );
+}
+
+
+
+/**
+  * @brief 		Block written by the CM4 into the CM4 to CM7 ring, the freed semaphore wakes the parser
+  *				through the HSEM interrupt instead of the 800 Hz poll
+  */
+static bool benchInterCoreMailbox( void )
+{
+	typedef Tools::RING_BUFFER<uint8_t, 0x4000> shared_ring_type;
+	shared_ring_type * const cm4_transmit_ring = reinterpret_cast<shared_ring_type *>(0x38008000);
+	static uint8_t data[BENCH_PAYLOAD_SIZE];
+	uint8_t		   buffer[BENCH_PAYLOAD_SIZE];
+	const uint32_t notification_counter = inter_core.notification_counter;
+
+	*reinterpret_cast<volatile uint32_t *>(0x3800FF30) += 1;	///< CM4 heartbeat
+	inter_core.scheduler();
+
+	data[0]++;
+	cm4_transmit_ring->pushBulk(data, BENCH_PAYLOAD_SIZE);
+	HSEM->C1ISR |= __HAL_HSEM_SEMID_TO_MASK(Peripherals::Ram::HSEM_ID_CM4_TO_CM7);	///< Set by the hardware when the CM4 frees it
+	virtual_clock.advance_us(1);
+
+	return ( (inter_core.notification_counter == (notification_counter + 1)) &&
+			 (inter_core.getDataFromBuffer(buffer, BENCH_PAYLOAD_SIZE) == BENCH_PAYLOAD_SIZE) && (buffer[0] == data[0]) );
+}
+
+
+
+/**
+  * @brief 		Master state published with one changed word and read back as the CM4 would
+  */
+static bool benchStateSync( void )
+{
+	static Tools::STATE_PUBLISHER<Datalogger::master_state_t>  publisher (BENCH_SHARED_ADDRESS, static_cast<uint16_t>(Datalogger::cmd_type::MASTER_STATE), Datalogger::STATE_VERSION);
+	static Tools::STATE_SUBSCRIBER<Datalogger::master_state_t> subscriber(BENCH_SHARED_ADDRESS, static_cast<uint16_t>(Datalogger::cmd_type::MASTER_STATE), Datalogger::STATE_VERSION);
+
+	publisher.state.date_and_time[0]++;	///< iTOW, the only field which changes every cycle
+	return ( publisher.publish() && subscriber.update() &&
+			 (std::memcmp(&publisher.state, &subscriber.state, sizeof(publisher.state)) == 0) );
+}
+
+
+
+/**
+  * @brief 		CRC16 of one datalogger record with a backend, compared with the table backend.
+  *				The hardware backend runs on the modelled CRC unit, its time is not the one of the H747.
+  */
+static bool benchCrc16(Tools::crc16_backend_type backend)
+{
+	static uint8_t	data[BENCH_CRC_SIZE + 3];
+	static uint16_t reference[4];		///< Table backend result for every alignment of the record
+	static bool		reference_ready = false;
+	static uint8_t	offset			= 0;
+	uint32_t		index			= 0;
+
+	if(reference_ready == false)
+	{
+		for(index = 0; index < sizeof(data); index++)
+		{
+			data[index] = static_cast<uint8_t>((index * 7U) + 1U);
+		}
+		for(index = 0; index < 4; index++)
+		{
+			reference[index] = crc16.calculate(Tools::crc16_backend_type::TABLE, &data[index], BENCH_CRC_SIZE);
+		}
+		reference_ready = true;
+	}
+
+	offset = (offset + 1) & 0x3U;
+	return ( crc16.calculate(backend, &data[offset], BENCH_CRC_SIZE) == reference[offset] );
+}
+
+static bool benchCrc16Table		( void ) { return benchCrc16(Tools::crc16_backend_type::TABLE); }
+static bool benchCrc16SlicingBy8( void ) { return benchCrc16(Tools::crc16_backend_type::SLICING_BY_8); }
+static bool benchCrc16Hardware	( void ) { return benchCrc16(Tools::crc16_backend_type::HARDWARE); }
+
+
+
+/**
+  * @brief 		One block through the receive interrupt and the uart ring buffer
+  */
+static bool benchUartRing( void )
+{
+	static uint8_t block[BENCH_UART_BLOCK_SIZE];
+	uint8_t		   buffer[BENCH_UART_BLOCK_SIZE];
+
+	block[0]++;
+	sim_uart5.injectData(block, BENCH_UART_BLOCK_SIZE);
+	return ( uart5.getDataFromBuffer(buffer, BENCH_UART_BLOCK_SIZE) == BENCH_UART_BLOCK_SIZE );
+}
+
+
+
+/**
+  * @brief 		Same block with the interrupts counted, the FIFO threshold allows one per 8 bytes and the IDLE
+  */
+static bool benchUartFifoInterrupts( void )
+{
+	static uint8_t block[BENCH_UART_BLOCK_SIZE];
+	uint8_t		   buffer[BENCH_UART_BLOCK_SIZE];
+	uint32_t	   interrupt_counter = sim_uart5.interrupt_counter;
+
+	block[0]++;
+	sim_uart5.injectData(block, BENCH_UART_BLOCK_SIZE);
+	interrupt_counter = sim_uart5.interrupt_counter - interrupt_counter;
+	return ( ( uart5.getDataFromBuffer(buffer, BENCH_UART_BLOCK_SIZE) == BENCH_UART_BLOCK_SIZE ) && (buffer[0] == block[0]) &&
+			 ( interrupt_counter <= ( (BENCH_UART_BLOCK_SIZE / 8) + 1 ) ) );
+}
+
+
+
+/**
+  * @brief 		Same block read in place with peek and consume, without the copy
+  */
+static bool benchUartPeek( void )
+{
+	static uint8_t block[BENCH_UART_BLOCK_SIZE];
+	Peripherals::Uart::receive_span_type span;
+	uint16_t	   size = 0;
+
+	block[0]++;
+	sim_uart5.injectData(block, BENCH_UART_BLOCK_SIZE);
+	size = uart5.peek(span);
+	uart5.consume(size);
+	return ( (size == BENCH_UART_BLOCK_SIZE) && (span[0] == block[0]) );
+}
+
+
+
+/**
+  * @brief 		Same block through the receive DMA of uart6 and one IDLE interrupt
+  */
+static bool benchUartDmaRing( void )
+{
+	static uint8_t block[BENCH_UART_BLOCK_SIZE];
+	uint8_t		   buffer[BENCH_UART_BLOCK_SIZE];
+
+	block[0]++;
+	sim_uart6.injectData(block, BENCH_UART_BLOCK_SIZE);
+	return ( ( uart6.getDataFromBuffer(buffer, BENCH_UART_BLOCK_SIZE) == BENCH_UART_BLOCK_SIZE ) && (buffer[0] == block[0]) );
+}
+
+
+
+/**
+  * @brief 		GCS frame sent over uart3 in loopback and parsed back at line speed
+  */
+static bool benchGcsTelemetry( void )
+{
+	static uint8_t data[BENCH_GCS_PAYLOAD_SIZE];
+
+	const uint32_t frame_counter = uart3_router.getFrameCounter(Telemetry::telemetry_id_type::GCS, Telemetry::telemetry_id_type::FLIGHT_CONTROLLER);
+	bool		   sent			 = false;
+
+	data[0]++;
+	sent = gcs_telemetry.sendPacket(static_cast<uint8_t>(Telemetry::telemetry_id_type::GCS),
+									static_cast<uint8_t>(Telemetry::telemetry_id_type::FLIGHT_CONTROLLER),
+									data, BENCH_GCS_PAYLOAD_SIZE);
+	virtual_clock.advance_us(10000);
+	gcs_telemetry.parseReceivedData();
+	return ( (sent == true) &&
+			 (uart3_router.getFrameCounter(Telemetry::telemetry_id_type::GCS, Telemetry::telemetry_id_type::FLIGHT_CONTROLLER) == (frame_counter + 1)) );
+}
+
+
+
+/**
+  * @brief 		TELEMETRY_5HZ encoded by its descriptor and sent over uart3, the loopback is drained
+  */
+static bool benchGcsSendTelemetry5Hz( void )
+{
+	static Telemetry::telemetry_5hz_type message;
+
+	bool sent = false;
+
+	message.data.ap_runtime_ms++;
+	sent = gcs_telemetry.sendMessage<Telemetry::telemetry_5hz_tx_descriptor>(message);
+	virtual_clock.advance_us(30000);
+	gcs_telemetry.parseReceivedData();
+	return sent;
+}
+
+
+
+/**
+  * @brief 		LOW stream which offers more than the link can take
+  */
+static bool sendBenchFlood( void *context )
+{
+	static uint8_t data[BENCH_FLOOD_PAYLOAD_SIZE];
+
+	UNUSED(context);
+	data[0]++;
+	return gcs_telemetry.sendPacket(static_cast<uint8_t>(Telemetry::telemetry_id_type::GCS),
+									static_cast<uint8_t>(Telemetry::telemetry_id_type::FLIGHT_CONTROLLER),
+									data, BENCH_FLOOD_PAYLOAD_SIZE);
+}
+
+
+
+/**
+  * @brief 		Returns the stream of the uart3 scheduler with the name
+  */
+static const Telemetry::telemetry_stream_type* findStream( const char *name )
+{
+	uint8_t index = 0;
+
+	for(index = 0; index < uart3_telemetry_scheduler.getStreamNumber(); index++)
+	{
+		if(std::strcmp(uart3_telemetry_scheduler.getStream(index)->name, name) == 0)
+		{
+			return uart3_telemetry_scheduler.getStream(index);
+		}
+	}
+
+	return nullptr;
+}
+
+
+
+/**
+  * @brief 		One second of the GCS streams, a heartbeat request, a control request every tick
+  *				and the flood stream on uart3 at line speed. The flood is degraded, control is
+  *				never held back and the transmit ring never refuses a frame.
+  */
+static bool benchGcsLinkScheduler( void )
+{
+	const Telemetry::telemetry_stream_type *control = findStream("gcs_control_1");
+	const Telemetry::telemetry_stream_type *flood	= findStream("bench_flood");
+	const uint32_t reject_counter	= uart3.transmit_reject_counter;
+	const uint32_t control_deferred = control->deferred_counter;
+	const uint32_t flood_deferred	= flood->deferred_counter;
+	uint16_t	   tick				= 0;
+
+	gcs_telemetry.requestMessage<Telemetry::heartbeat_tx_descriptor>();
+	for(tick = 0; tick < Telemetry::TELEMETRY_SCHEDULER_RATE_HZ; tick++)
+	{
+		gcs_telemetry.requestMessage<Telemetry::control_1_tx_descriptor>();
+		uart3_telemetry_scheduler.service();
+		virtual_clock.advance_us(1000000 / Telemetry::TELEMETRY_SCHEDULER_RATE_HZ);
+		gcs_telemetry.parseReceivedData();
+	}
+
+	return ( (uart3.transmit_reject_counter == reject_counter) && (control->deferred_counter == control_deferred) &&
+			 (flood->deferred_counter > flood_deferred) && (findStream("gcs_heartbeat")->achieved_rate_hz == 1) );
+}
+
+
+
+/**
+  * @brief 		GCS heartbeat in loopback, decoded through the dispatch table into its message slot
+  */
+static bool benchGcsHeartbeatDecode( void )
+{
+	static Telemetry::heartbeat_receive_type message;
+	static uint8_t changing_byte = 0;
+	uint8_t		   payload[Telemetry::heartbeat_rx_descriptor::PAYLOAD_SIZE];
+	const uint32_t receive_counter = gcs_telemetry.messages.getReceiveCounter<Telemetry::heartbeat_rx_descriptor>();
+
+	message.data.fc_timestamp_feedback++;
+	Telemetry::heartbeat_rx_descriptor::encode(message, changing_byte++, payload);
+	gcs_telemetry.sendPacket(static_cast<uint8_t>(Telemetry::telemetry_id_type::GCS),
+							 static_cast<uint8_t>(Telemetry::telemetry_id_type::FLIGHT_CONTROLLER),
+							 payload, sizeof(payload));
+	virtual_clock.advance_us(10000);
+	gcs_telemetry.parseReceivedData();
+
+	return ( (gcs_telemetry.messages.getReceiveCounter<Telemetry::heartbeat_rx_descriptor>() == (receive_counter + 1)) &&
+			 (gcs_telemetry.messages.getMessage<Telemetry::heartbeat_rx_descriptor>().data.fc_timestamp_feedback == message.data.fc_timestamp_feedback) );
+}
+
+
+
+/**
+  * @brief 		One frame of every uart3 endpoint in loopback, parsed once by the router and dispatched
+  */
+static bool benchUart3Router( void )
+{
+	static const Telemetry::telemetry_id_type SOURCE[] = { Telemetry::telemetry_id_type::GCS, Telemetry::telemetry_id_type::INS,
+														   Telemetry::telemetry_id_type::MISSION_COMPUTER, Telemetry::telemetry_id_type::RADAR };
+	static uint8_t data[BENCH_GCS_PAYLOAD_SIZE];
+	uint32_t	   frame_counter[sizeof(SOURCE) / sizeof(SOURCE[0])] = {0};
+	uint8_t		   index = 0;
+	bool		   valid = true;
+
+	data[0]++;
+	for(index = 0; index < (sizeof(SOURCE) / sizeof(SOURCE[0])); index++)
+	{
+		frame_counter[index] = uart3_router.getFrameCounter(SOURCE[index], Telemetry::telemetry_id_type::FLIGHT_CONTROLLER);
+		valid &= gcs_telemetry.sendPacket(static_cast<uint8_t>(SOURCE[index]), static_cast<uint8_t>(Telemetry::telemetry_id_type::FLIGHT_CONTROLLER),
+										  data, BENCH_GCS_PAYLOAD_SIZE);
+	}
+	virtual_clock.advance_us(100000);
+	uart3_router.parseReceivedData();
+
+	for(index = 0; index < (sizeof(SOURCE) / sizeof(SOURCE[0])); index++)
+	{
+		valid &= ( uart3_router.getFrameCounter(SOURCE[index], Telemetry::telemetry_id_type::FLIGHT_CONTROLLER) == (frame_counter[index] + 1) );
+	}
+	return valid;
+}
+
+
+
+/**
+  * @brief 		Completion callback of the SPI bench, counts the successful transactions
+  */
+static void benchSpiComplete( void *context, bool success )
+{
+	if(success == true)
+	{
+		(*static_cast<uint32_t *>(context))++;
+	}
+}
+
+
+
+/**
+  * @brief 		Transactions above the old 255 byte limit queued at once and run back-to-back by the DMA
+  */
+static bool benchSpiDmaQueue( void )
+{
+	uint8_t * const tx		= reinterpret_cast<uint8_t *>(BENCH_SPI_ADDRESS);
+	uint8_t * const rx		= tx + BENCH_SPI_BLOCK_SIZE;
+	uint32_t		completed	= 0;
+	uint8_t			index		= 0;
+	bool			valid		= true;
+	Peripherals::Spi::spi_transaction_type transaction = {};
+
+	tx[0]++;
+	for(index = 0; index < BENCH_SPI_TRANSACTIONS; index++)
+	{
+		transaction.tx_data	 = tx;
+		transaction.rx_data	 = &rx[index * BENCH_SPI_BLOCK_SIZE];
+		transaction.size	 = BENCH_SPI_BLOCK_SIZE;
+		transaction.complete = benchSpiComplete;
+		transaction.context	 = &completed;
+		valid &= spi_2.submit(transaction);
+	}
+	virtual_clock.advance_us(10);
+
+	return ( valid && (completed == BENCH_SPI_TRANSACTIONS) && (spi_2.getPendingTransactions() == 0) &&
+			 (rx[(BENCH_SPI_TRANSACTIONS - 1) * BENCH_SPI_BLOCK_SIZE] == tx[0]) );
+}
+
+
+
+/**
+  * @brief 		Completion callback of the I2C bench, counts the successful batches
+  */
+static void benchI2cComplete( void *context, bool success )
+{
+	if(success == true)
+	{
+		(*static_cast<uint32_t *>(context))++;
+	}
+}
+
+
+
+/**
+  * @brief 		Compass like batch of three register reads chained by the interrupt and reported once
+  */
+static bool benchI2cBatch( void )
+{
+	static uint8_t field[6];
+	static uint8_t temperature[2];
+	static uint8_t status = 0;
+	static const Peripherals::I2c::i2c_register_read_type READS[] = { { 0x3C, 0x03, sizeof(field),		 field		 },
+																	   { 0x3C, 0x31, sizeof(temperature), temperature },
+																	   { 0x3C, 0x09, sizeof(status),	  &status	  } };
+	uint32_t completed = 0;
+	bool	 valid	   = false;
+	const Peripherals::I2c::i2c_batch_type batch = { READS, sizeof(READS) / sizeof(READS[0]), 1000, benchI2cComplete, &completed };
+
+	sim_i2c4.device_register[0x08]++;
+	sim_i2c4.device_register[0x09]++;
+	valid = i2c4.submitBatch(batch);
+	virtual_clock.advance_us(10);
+
+	return ( valid && (completed == 1) && (i2c4.isBatchActive() == false) &&
+			 (field[5] == sim_i2c4.device_register[0x08]) && (status == sim_i2c4.device_register[0x09]) );
+}
+
+
+
+/**
+  * @brief 		FD frame with bit rate switching and a classic extended frame looped back through
+  *				the hardware filters, a third frame is dropped by the filters
+  */
+static bool benchCanFdLoopback( void )
+{
+	static Peripherals::Can::can_frame_type frame[3] = { { BENCH_CAN_CRITICAL_ID, false, true,  true,  Peripherals::Can::CAN_MAXIMUM_PAYLOAD_SIZE, {} },
+														  { BENCH_CAN_REJECTED_ID, false, true,  true,  Peripherals::Can::CAN_MAXIMUM_PAYLOAD_SIZE, {} },
+														  { BENCH_CAN_LOW_ID,	   true,  false, false, 8,										{} } };
+	static Peripherals::Can::can_frame_type received[4];
+	uint8_t index = 0;
+	bool	valid = true;
+
+	frame[0].data[Peripherals::Can::CAN_MAXIMUM_PAYLOAD_SIZE - 1]++;
+	frame[2].data[7]++;
+	for(index = 0; index < 3; index++)
+	{
+		valid &= can1.sendFrame(frame[index]);
+	}
+	virtual_clock.advance_us(10);
+
+	valid &= (can1.receiveFrames(Peripherals::Can::can_fifo_type::FIFO0, received, 4) == 1) &&
+			 (received[0].id == BENCH_CAN_CRITICAL_ID) && (received[0].bit_rate_switch == true) &&
+			 (received[0].data[Peripherals::Can::CAN_MAXIMUM_PAYLOAD_SIZE - 1] == frame[0].data[Peripherals::Can::CAN_MAXIMUM_PAYLOAD_SIZE - 1]);
+	valid &= (can1.receiveFrames(Peripherals::Can::can_fifo_type::FIFO1, received, 4) == 1) &&
+			 (received[0].extended == true) && (received[0].size == 8) && (received[0].data[7] == frame[2].data[7]);
+
+	return ( valid && (can1.getPendingFrames() == 0) );
+}
+
+
+
+/**
+  * @brief 		TELEMETRY_5HZ sized frame of the mission computer flow segmented over CAN-FD,
+  *				looped back and reassembled in place
+  */
+static bool benchCanTelemetry( void )
+{
+	static uint8_t data[BENCH_CAN_TELEMETRY_SIZE];
+	const uint32_t frame_counter = can1_transport.getFrameCounter(Telemetry::telemetry_id_type::MISSION_COMPUTER,
+																   Telemetry::telemetry_id_type::FLIGHT_CONTROLLER);
+	bool		   sent			 = false;
+
+	data[0]++;
+	data[BENCH_CAN_TELEMETRY_SIZE - 1]++;
+	sent = mc_telemetry.sendPacket(static_cast<uint8_t>(Telemetry::telemetry_id_type::MISSION_COMPUTER),
+								   static_cast<uint8_t>(Telemetry::telemetry_id_type::FLIGHT_CONTROLLER),
+								   data, BENCH_CAN_TELEMETRY_SIZE);
+	virtual_clock.advance_us(10);
+	mc_telemetry.parseReceivedData();
+
+	return ( sent && (can1_transport.getFrameCounter(Telemetry::telemetry_id_type::MISSION_COMPUTER,
+													 Telemetry::telemetry_id_type::FLIGHT_CONTROLLER) == (frame_counter + 1)) );
+}
+
+
+
+/**
+  * @brief 		SBUS frame through the uart8 interrupt, the deferred latch and the 100Hz parser
+  */
+static bool benchSbusFrame( void )
+{
+	static uint8_t frame[SBUS_FRAME_SIZE] = { Receiver::Futaba::FRAME_START };
+
+	frame[1]++;
+	frame[SBUS_FRAME_SIZE - 3] = 0x80;		///< Channel 16 bits, a non-telemetry frame with them cleared is not recognized
+	frame[SBUS_FRAME_SIZE - 1] = Receiver::Futaba::FRAME_END_NON_TELEMETRY;
+	sim_uart8.injectData(frame, SBUS_FRAME_SIZE);
+	work_queue.drain(Tools::WORK_DRAIN_LIMIT_US);
+	sbus.scheduler();
+	return ( (sbus.channel.raw[0] & 0xFF) == frame[1] );
+}
+
+
+
+/**
+  * @brief 		Every registered task of the scheduler once
+  */
+static bool benchSchedulerTasks( void )
+{
+	uint8_t index	 = 0;
+	uint8_t executed = 0;
+
+	for(index = 0; index < task.getTaskNumber(); index++)
+	{
+		if(task.getTask(index)->function != nullptr)
+		{
+			task.getTask(index)->function();
+			executed++;
+		}
+	}
+	return ( (task.getTaskNumber() == BENCH_TASK_NUMBER) && (executed == BENCH_TASK_NUMBER) );
+}
+
+
+
+static const benchmark_type BENCHMARK[] =
+{
+	{ "core_telemetry_shared_ram_512B",	benchCoreTelemetrySharedRam,	20000 },
+	{ "shared_ram_copy_905B",			benchSharedRamCopy,				20000 },
+	{ "inter_core_ring_512B",			benchInterCoreRing,				20000 },
+	{ "inter_core_mailbox_512B",		benchInterCoreMailbox,			20000 },
+	{ "state_sync_master_24B",			benchStateSync,					20000 },
+	{ "crc16_table_896B",				benchCrc16Table,				20000 },
+	{ "crc16_slicing_by_8_896B",		benchCrc16SlicingBy8,			20000 },
+	{ "crc16_hardware_model_896B",		benchCrc16Hardware,				 2000 },
+	{ "uart_ring_256B",					benchUartRing,					20000 },
+	{ "uart_peek_256B",					benchUartPeek,					20000 },
+	{ "uart_fifo_interrupts_256B",		benchUartFifoInterrupts,		20000 },
+	{ "uart_dma_ring_256B",				benchUartDmaRing,				20000 },
+	{ "gcs_telemetry_loopback_64B",		benchGcsTelemetry,				 2000 },
+	{ "uart3_router_4x64B",				benchUart3Router,				 2000 },
+	{ "gcs_send_telemetry_5hz_313B",	benchGcsSendTelemetry5Hz,		 2000 },
+	{ "gcs_heartbeat_decode",			benchGcsHeartbeatDecode,		 2000 },
+	{ "gcs_link_scheduler_1s",			benchGcsLinkScheduler,			   20 },
+	{ "spi_dma_queue_4x1024B",			benchSpiDmaQueue,				20000 },
+	{ "i2c_batch_3_reads",				benchI2cBatch,					20000 },
+	{ "can_fd_loopback_3_frames",		benchCanFdLoopback,				20000 },
+	{ "can_telemetry_313B",				benchCanTelemetry,				20000 },
+	{ "sbus_frame",						benchSbusFrame,					20000 },
+	{ "scheduler_all_tasks",			benchSchedulerTasks,			20000 },
+};
+
+
+
+/**
+  * @brief 		Runs every benchmark, iterations are scaled with the first argument
+  *
+  * @param[in]  int argc
+  * @param[in]  char *argv[] : argv[1] iteration scale, default 1
+  *
+  * @return 	int
+  */
+int main(int argc, char *argv[])
+{
+	const uint8_t BENCHMARK_NUMBER = sizeof(BENCHMARK) / sizeof(BENCHMARK[0]);
+	uint32_t	  scale			   = 1;
+	uint8_t		  index			   = 0;
+	uint32_t	  iteration		   = 0;
+	uint32_t	  error_counter	   = 0;
+	int			  result		   = EXIT_SUCCESS;
+
+	if(argc > 1)
+	{
+		scale = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+	}
+
+	board.initialize();
+	task.init();
+	crc16.setBackend(Tools::crc16_backend_type::SLICING_BY_8);	///< The modelled CRC unit is bit serial, it would dominate the other benchmarks
+	uart5.initialize();
+	uart3.initialize();
+	sim_uart3.setLoopback(true);
+	can1.addFilter(BENCH_CAN_CRITICAL_ID, 0x7FF,	  false, Peripherals::Can::can_fifo_type::FIFO0);
+	can1.addFilter(BENCH_CAN_LOW_ID,	  0x1FFFFF00, true,	 Peripherals::Can::can_fifo_type::FIFO1);
+	can1_transport.registerEndpoint(&mc_telemetry);
+	uart3_telemetry_scheduler.addStream("bench_flood", Telemetry::TELEMETRY_SCHEDULER_RATE_HZ, Telemetry::stream_priority_type::LOW,
+										BENCH_FLOOD_PAYLOAD_SIZE + Telemetry::FRAME_SIZE_WITHOUT_PAYLOAD, sendBenchFlood, nullptr);
+
+	std::printf("%-32s %10s %12s %10s %8s\n", "benchmark", "iterations", "total_ms", "ns/call", "errors");
+	for(index = 0; index < BENCHMARK_NUMBER; index++)
+	{
+		const uint32_t iterations = BENCHMARK[index].iterations * scale;
+		error_counter = 0;
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for(iteration = 0; iteration < iterations; iteration++)
+		{
+			if(BENCHMARK[index].function() == false)
+			{
+				error_counter++;
+			}
+		}
+		std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+
+		std::printf("%-32s %10u %12.3f %10.1f %8u\n", BENCHMARK[index].name, iterations,
+					static_cast<double>(elapsed.count()) / 1e6,
+					( iterations > 0 ) ? static_cast<double>(elapsed.count()) / iterations : 0.0,
+					error_counter);
+		if(error_counter != 0)
+		{
+			result = EXIT_FAILURE;
+		}
+	}
+
+	return result;
+}
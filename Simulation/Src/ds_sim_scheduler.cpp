@@ -0,0 +1,522 @@
+/**
+ ******************************************************************************
+  * @file		: ds_sim_scheduler.cpp
+  * @brief		: Host side scheduler simulator source file
+  *				  This file steps SCHEDULER frame by frame in virtual time, spends
+  *				  the modelled run time of every task and injects the receive
+  *				  streams. TIM6 ticks and TIM13 SBUS slots come from the virtual clock.
+  *				  The task functions are wrapped, the firmware scheduler is unchanged.
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+
+/*
+ * Begin of Includes
+ */
+#include <cstdio>
+#include <cstring>
+#include <utility>
+#include "ds_sim_scheduler.hpp"
+#include "ds_main.hpp"
+// End of Includes
+
+
+
+/*
+ * Begin of Macro Definitions
+ */
+static const uint8_t WRAPPED_TASK_NUMBER = MAXIMUM_TASK_NUMBER + MAXIMUM_EVENT_NUMBER;
+//End of Macro Definitions
+
+
+
+/*
+ * Begin of Enum, Union and Struct Definitions
+ */
+typedef void (*task_function_type)( void );
+
+struct wrapped_task_type
+{
+	task_function_type	function;		///< Function registered by the firmware
+	const char		   *name;			///< Name pointer of the scheduler task table entry
+};
+// End of Enum, Union and Struct Definitions
+
+
+
+/*
+ * Begin of Object Definitions
+ */
+Simulation::SCHEDULER_SIMULATOR scheduler_simulator;
+static wrapped_task_type wrapped_task[WRAPPED_TASK_NUMBER];
+static uint8_t			 wrapped_task_number = 0;
+// End of Object Definitions
+
+
+
+/**
+  * @brief 		Body of the model tasks, their run time is spent by chargeTaskLoad
+  */
+static void modelTask( void )
+{
+}
+
+
+
+/**
+  * @brief 		Runs the firmware function of a wrapped task and spends its modelled run time,
+  *				SCHEDULER::runTask measures both
+  */
+template <std::size_t SLOT>
+static void runWrappedTask( void )
+{
+	wrapped_task[SLOT].function();
+	scheduler_simulator.chargeTaskLoad(wrapped_task[SLOT].name);
+}
+
+
+
+/**
+  * @brief 		Returns the wrapper of a slot of wrapped_task
+  */
+template <std::size_t... SLOT>
+static task_function_type getTaskWrapper( uint8_t slot, std::index_sequence<SLOT...> )
+{
+	static const task_function_type WRAPPER[] = { &runWrappedTask<SLOT>... };
+
+	return WRAPPER[slot];
+}
+
+
+
+namespace Simulation
+{
+
+
+
+/**
+  * @brief Default constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+SCHEDULER_SIMULATOR::SCHEDULER_SIMULATOR() :
+statistics{},
+statistics_number(0),
+stream{},
+stream_number(0),
+task_start_us(0),
+tick_origin_us(0),
+busy_time_us(0),
+run_time_us(0)
+{ }
+
+
+
+/**
+  * @brief 		Sets the modelled run time of a registered task, call it after SCHEDULER::init
+  *
+  * @param[in]  const char *name : Task name in the scheduler task table
+  * @param[in]  uint32_t load_us : Run time added to every call of the task
+  *
+  * @return 	bool : false if there is no task with the name
+  */
+bool SCHEDULER_SIMULATOR::setTaskLoad( const char *name, uint32_t load_us )
+{
+	task_statistics_type *entry = nullptr;
+	uint8_t				  index = 0;
+
+	for(index = 0; index < task.getTaskNumber(); index++)
+	{
+		if(std::strcmp(task.getTask(index)->name, name) == 0)
+		{
+			entry = getStatistics(task.getTask(index)->name);
+			break;
+		}
+	}
+
+	if(entry == nullptr)
+	{
+		return false;
+	}
+
+	entry->load_us = load_us;
+	return true;
+}
+
+
+
+/**
+  * @brief 		Registers a task which only consumes its modelled run time, e.g. a driver
+  *				which is planned but not written yet
+  *
+  * @param[in]  const char *name	: Task name, must stay valid
+  * @param[in]  uint16_t rate_hz	: Task rate
+  * @param[in]  uint16_t budget_us	: Worst case execution time given to the scheduler
+  * @param[in]  uint32_t load_us	: Run time spent on every call
+  *
+  * @return 	bool : false if the scheduler rejects the task
+  */
+bool SCHEDULER_SIMULATOR::addModelTask( const char *name, uint16_t rate_hz, uint16_t budget_us, uint32_t load_us )
+{
+	if(task.addTask(name, modelTask, rate_hz, budget_us, 0) == false)
+	{
+		return false;
+	}
+
+	return setTaskLoad(name, load_us);
+}
+
+
+
+/**
+  * @brief 		Adds a periodic burst of bytes to the receive line of an uart
+  *
+  * @param[in]  UART_PORT *port			: Simulated uart
+  * @param[in]  const uint8_t data[]	: Bytes of one burst, must stay valid during run()
+  * @param[in]  uint16_t size			: Burst size
+  * @param[in]  uint32_t period_us		: Burst period
+  * @param[in]  uint32_t phase_us		: Time of the first burst from now
+  *
+  * @return 	bool : false if the stream table is full
+  */
+bool SCHEDULER_SIMULATOR::addReceiveStream( UART_PORT *port, const uint8_t data[], uint16_t size, uint32_t period_us, uint32_t phase_us )
+{
+	if( (stream_number >= RECEIVE_STREAM_NUMBER) || (period_us == 0) )
+	{
+		return false;
+	}
+
+	stream[stream_number].port		   = port;
+	stream[stream_number].data		   = data;
+	stream[stream_number].size		   = size;
+	stream[stream_number].period_us	   = period_us;
+	stream[stream_number].next_time_us = virtual_clock.getTime_us() + phase_us;
+	stream_number++;
+
+	return true;
+}
+
+
+
+/**
+  * @brief 		Steps SCHEDULER in virtual time. Idle time is skipped up to the next timer
+  *				interrupt or receive burst, so the result only depends on the workload.
+  *				The tasks registered until now are wrapped first.
+  *
+  * @param[in]  uint64_t duration_us : Virtual time to be simulated
+  *
+  * @return 	void
+  */
+void SCHEDULER_SIMULATOR::run( uint64_t duration_us )
+{
+	const uint64_t START_US	= virtual_clock.getTime_us();
+	const uint64_t END_US	= START_US + duration_us;
+	uint64_t	   frame_start_us	= 0;
+	uint64_t	   frame_time_us	= 0;
+	uint64_t	   next_us			= 0;
+	uint64_t	   tick_number		= 0;
+
+	wrapTasks();
+
+	while(virtual_clock.getTime_us() < END_US)
+	{
+		serviceReceiveStreams();
+
+		frame_start_us = virtual_clock.getTime_us();
+		task_start_us  = frame_start_us;
+		if(task.step() == true)
+		{
+			if(frame_counter == 0)
+			{
+				tick_origin_us = frame_start_us;
+			}
+			frame_time_us = virtual_clock.getTime_us() - frame_start_us;
+			busy_time_us += frame_time_us;
+			frame_counter++;
+
+			if(frame_time_us > FRAME_PERIOD_US)
+			{
+				missed_deadline_counter++;
+			}
+
+			/* The tick is a flag, only one tick fired during a frame is kept pending */
+			tick_number = ( (virtual_clock.getTime_us() - tick_origin_us) / FRAME_PERIOD_US ) -
+						  ( (frame_start_us - tick_origin_us) / FRAME_PERIOD_US );
+			if(tick_number > 1)
+			{
+				skipped_tick_counter += static_cast<uint32_t>(tick_number - 1);
+			}
+			if(frame_time_us > maximum_frame_time_us)
+			{
+				maximum_frame_time_us = static_cast<uint32_t>(frame_time_us);
+			}
+			if(monitor.cpu_load_active > cpu_load_active_maximum)
+			{
+				cpu_load_active_maximum = monitor.cpu_load_active;
+			}
+			continue;
+		}
+
+		next_us = virtual_clock.getNextEvent_us();
+		if(getNextStream_us() < next_us)
+		{
+			next_us = getNextStream_us();
+		}
+		if(next_us > END_US)
+		{
+			next_us = END_US;
+		}
+		virtual_clock.advance_us( static_cast<uint32_t>( (next_us > virtual_clock.getTime_us()) ? (next_us - virtual_clock.getTime_us()) : 1 ) );
+	}
+
+	run_time_us += virtual_clock.getTime_us() - START_US;
+}
+
+
+
+/**
+  * @brief 		Spends the modelled run time of the task which has just been executed and
+  *				records the task execution time. Timer interrupts due in this time fire
+  *				inside the task, as they preempt the main loop on the target.
+  *
+  * @param[in]  const char *name : Name pointer of the scheduler task table entry
+  *
+  * @return 	void
+  */
+void SCHEDULER_SIMULATOR::chargeTaskLoad( const char *name )
+{
+	task_statistics_type *entry	  = getStatistics(name);
+	uint64_t			  time_us = 0;
+
+	if(entry != nullptr)
+	{
+		if(entry->load_us != 0)
+		{
+			virtual_clock.advance_us(entry->load_us);
+		}
+
+		time_us = virtual_clock.getTime_us() - task_start_us;
+		entry->call_counter++;
+		entry->total_time_us += time_us;
+		if(time_us > entry->maximum_time_us)
+		{
+			entry->maximum_time_us = static_cast<uint32_t>(time_us);
+		}
+	}
+
+	task_start_us = virtual_clock.getTime_us();
+}
+
+
+
+/**
+  * @brief 		Replaces the function of every task which is not wrapped yet by a wrapper
+  *				which spends its modelled run time after it
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void SCHEDULER_SIMULATOR::wrapTasks( void )
+{
+	const task_type *entry = nullptr;
+	uint8_t			 index = 0;
+	uint8_t			 slot  = 0;
+
+	for(index = 0; index < task.getTaskNumber(); index++)
+	{
+		entry = task.getTask(index);
+		for(slot = 0; (slot < wrapped_task_number) && (wrapped_task[slot].name != entry->name); slot++)
+		{
+		}
+		if( (slot < wrapped_task_number) || (wrapped_task_number >= WRAPPED_TASK_NUMBER) )
+		{
+			continue;
+		}
+
+		wrapped_task[slot].function = entry->function;
+		wrapped_task[slot].name		= entry->name;
+		task.setTaskFunction(index, getTaskWrapper(slot, std::make_index_sequence<WRAPPED_TASK_NUMBER>()));
+		wrapped_task_number++;
+	}
+}
+
+
+
+/**
+  * @brief 		Prints the task statistics and the frame deadlines
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void SCHEDULER_SIMULATOR::printReport( void ) const
+{
+	const task_type			   *entry	   = nullptr;
+	const task_statistics_type *statistic  = nullptr;
+	uint8_t						index	   = 0;
+	uint8_t						k		   = 0;
+
+	std::printf("%-16s %6s %6s %9s %8s %8s %9s %8s %9s\n",
+				"task", "rate", "phase", "budget_us", "load_us", "calls", "avg_us", "max_us", "overruns");
+	for(index = 0; index < task.getTaskNumber(); index++)
+	{
+		entry	  = task.getTask(index);
+		statistic = nullptr;
+		for(k = 0; k < statistics_number; k++)
+		{
+			if(statistics[k].name == entry->name)
+			{
+				statistic = &statistics[k];
+			}
+		}
+
+		std::printf("%-16s %6u %6u %9u %8u %8u %9.1f %8u %9u\n", entry->name, entry->rate_hz, entry->phase, entry->budget_us,
+					( statistic != nullptr ) ? statistic->load_us : 0, entry->execution_counter,
+					( (statistic != nullptr) && (statistic->call_counter > 0) ) ? static_cast<double>(statistic->total_time_us) / statistic->call_counter : 0.0,
+					entry->maximum_time_us, entry->overrun_counter);
+	}
+
+	std::printf("virtual time       : %.3f s\n", static_cast<double>(run_time_us) / 1e6);
+	std::printf("frames             : %u\n", frame_counter);
+	std::printf("frame period       : %u us\n", FRAME_PERIOD_US);
+	std::printf("max tick budget    : %u us\n", task.getMaximumTickBudget_us());
+	std::printf("max frame time     : %u us\n", maximum_frame_time_us);
+	std::printf("missed deadlines   : %u\n", missed_deadline_counter);
+	std::printf("skipped ticks      : %u\n", skipped_tick_counter);
+	std::printf("busy time          : %.2f %%\n", ( run_time_us > 0 ) ? 100.0 * static_cast<double>(busy_time_us) / run_time_us : 0.0);
+	std::printf("cpu_load_active    : %.2f %% (max %.2f %%)\n", monitor.cpu_load_active, cpu_load_active_maximum);
+	std::printf("deferred work      : %u posted, %u executed, %u dropped, max depth %u\n", work_queue.post_counter.load(),
+				work_queue.execution_counter, work_queue.drop_counter.load(), work_queue.maximum_depth);
+}
+
+
+
+/**
+  * @brief 		Injects every receive burst which is due
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+void SCHEDULER_SIMULATOR::serviceReceiveStreams( void )
+{
+	uint8_t index = 0;
+
+	for(index = 0; index < stream_number; index++)
+	{
+		while(stream[index].next_time_us <= virtual_clock.getTime_us())
+		{
+			stream[index].port->injectData(stream[index].data, stream[index].size);
+			stream[index].next_time_us += stream[index].period_us;
+		}
+	}
+}
+
+
+
+/**
+  * @brief 		Returns the time of the next receive burst
+  *
+  * @param[in]  void
+  *
+  * @return 	uint64_t : UINT64_MAX if there is no stream
+  */
+uint64_t SCHEDULER_SIMULATOR::getNextStream_us( void ) const
+{
+	uint64_t result = UINT64_MAX;
+	uint8_t	 index	= 0;
+
+	for(index = 0; index < stream_number; index++)
+	{
+		if(stream[index].next_time_us < result)
+		{
+			result = stream[index].next_time_us;
+		}
+	}
+
+	return result;
+}
+
+
+
+/**
+  * @brief 		Returns the statistics entry of a task, a new entry is taken on the first call
+  *
+  * @param[in]  const char *name : Name pointer of the scheduler task table entry
+  *
+  * @return 	task_statistics_type* : nullptr if the statistics table is full
+  */
+task_statistics_type* SCHEDULER_SIMULATOR::getStatistics( const char *name )
+{
+	uint8_t index = 0;
+
+	for(index = 0; index < statistics_number; index++)
+	{
+		if(statistics[index].name == name)
+		{
+			return &statistics[index];
+		}
+	}
+
+	if(statistics_number >= MAXIMUM_TASK_NUMBER)
+	{
+		return nullptr;
+	}
+
+	statistics[statistics_number].name = name;
+	statistics_number++;
+
+	return &statistics[statistics_number - 1];
+}
+
+
+
+/**
+  * @brief Default copy constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+SCHEDULER_SIMULATOR::SCHEDULER_SIMULATOR(const SCHEDULER_SIMULATOR& orig)
+{
+}
+
+
+
+/**
+  * @brief Default destructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+SCHEDULER_SIMULATOR::~SCHEDULER_SIMULATOR()
+{
+}
+
+
+
+} //End of namespace Simulation
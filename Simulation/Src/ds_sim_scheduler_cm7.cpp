@@ -0,0 +1,139 @@
+/**
+ ******************************************************************************
+  * @file		: ds_sim_scheduler_cm7.cpp
+  * @brief		: Host side scheduler simulation runner of the CM7 application
+  *				  This file runs SCHEDULER of the CM7 core in virtual time with
+  *				  a modelled task workload, an SBUS2 receiver on uart8 and an
+  *				  LW20 distance stream on uart2
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+
+/*
+ * Begin of Includes
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "ds_sim_scheduler.hpp"
+#include "ds_main.hpp"
+#include "ds_sbus2.hpp"
+// End of Includes
+
+
+
+/*
+ * Begin of Macro Definitions
+ */
+static const uint32_t DEFAULT_DURATION_S		= 10;
+static const uint32_t SBUS2_FRAME_PERIOD_US		= 14000;	///< Receiver frame period, every frame opens the next slot group
+static const uint8_t  SBUS2_GROUP_NUMBER		= 4;
+static const uint8_t  SBUS_FRAME_SIZE			= 25;
+static const uint32_t LW20_STREAM_PERIOD_US		= 20000;	///< 50Hz distance stream
+//End of Macro Definitions
+
+
+
+/*
+ * Begin of Object Definitions
+ */
+static uint8_t sbus2_frame[SBUS2_GROUP_NUMBER][SBUS_FRAME_SIZE];
+static const uint8_t lw20_stream[] = "$ldf,0:12.34\r\n";
+// End of Object Definitions
+
+
+
+/**
+  * @brief 		Runs the scheduler simulation
+  *				Usage: ds_sim_scheduler_cm7 [duration_s] [task=load_us ...] [task@rate_hz=load_us ...]
+  *				task=load_us adds run time to a registered task, task@rate_hz=load_us
+  *				registers a model task with the load as its budget,
+  *				e.g.   ds_sim_scheduler_cm7 10 sbus=300 new_driver@100=900
+  *
+  * @param[in]  int argc
+  * @param[in]  char *argv[]
+  *
+  * @return 	int : EXIT_FAILURE if any frame missed its deadline
+  */
+int main(int argc, char *argv[])
+{
+	const uint8_t FRAME_END[SBUS2_GROUP_NUMBER] = { Receiver::Futaba::FRAME_END_SLOT_0_7,   Receiver::Futaba::FRAME_END_SLOT_8_15,
+													Receiver::Futaba::FRAME_END_SLOT_16_23, Receiver::Futaba::FRAME_END_SLOT_24_31 };
+	uint32_t	  duration_s = DEFAULT_DURATION_S;
+	int			  argument	 = 1;
+	uint8_t		  group		 = 0;
+	char		 *separator	 = nullptr;
+	char		 *rate		 = nullptr;
+	bool		  result	 = false;
+
+	if( (argc > 1) && (std::strchr(argv[1], '=') == nullptr) )
+	{
+		duration_s = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+		argument++;
+	}
+
+	board.initialize();
+	task.init();
+
+	for(; argument < argc; argument++)
+	{
+		separator = std::strchr(argv[argument], '=');
+		rate	  = std::strchr(argv[argument], '@');
+		result	  = false;
+		if(separator != nullptr)
+		{
+			*separator = '\0';
+			if(rate != nullptr)
+			{
+				*rate  = '\0';
+				result = scheduler_simulator.addModelTask(argv[argument], static_cast<uint16_t>(std::strtoul(rate + 1, nullptr, 10)),
+														  static_cast<uint16_t>(std::strtoul(separator + 1, nullptr, 10)),
+														  static_cast<uint32_t>(std::strtoul(separator + 1, nullptr, 10)));
+			}
+			else
+			{
+				result = scheduler_simulator.setTaskLoad(argv[argument], static_cast<uint32_t>(std::strtoul(separator + 1, nullptr, 10)));
+			}
+		}
+
+		if(result == false)
+		{
+			std::fprintf(stderr, "[sim] task load '%s' is not valid, expected e.g. sbus=300 or new_driver@100=900\n", argv[argument]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	for(group = 0; group < SBUS2_GROUP_NUMBER; group++)
+	{
+		sbus2_frame[group][0]					= Receiver::Futaba::FRAME_START;
+		sbus2_frame[group][SBUS_FRAME_SIZE - 1] = FRAME_END[group];
+		scheduler_simulator.addReceiveStream(&sim_uart8, sbus2_frame[group], SBUS_FRAME_SIZE,
+											 SBUS2_FRAME_PERIOD_US * SBUS2_GROUP_NUMBER, SBUS2_FRAME_PERIOD_US * group);
+	}
+
+	scheduler_simulator.addReceiveStream(&sim_uart2, lw20_stream, sizeof(lw20_stream) - 1, LW20_STREAM_PERIOD_US, 0);
+
+	scheduler_simulator.run(static_cast<uint64_t>(duration_s) * 1000000);
+	scheduler_simulator.printReport();
+
+	return ( scheduler_simulator.missed_deadline_counter == 0 ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
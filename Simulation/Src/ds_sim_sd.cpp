@@ -0,0 +1,281 @@
+/**
+ ******************************************************************************
+  * @file		: ds_sim_sd.cpp
+  * @brief		: Host side SD card stand-in source file
+  *				  This file contains the sparse image backed SD card and the
+  *				  FatFs disk driver which replace sd_diskio.c in the CM4 build
+  * @author		: DASAL
+  * @date		: 17.10.2026
+  * @version	: 0.1.0
+ ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 DASAL, All Rights Reserved </center></h2>
+  *
+  * All information contained herein is, and remains the property of DASAL. The
+  * intellectual and technical concepts contained herein are proprietary to DASAL
+  * and are protected by trade secret or copyright law. Dissemination of this
+  * information or reproduction of this material is strictly forbidden unless
+  * prior written permission is obtained from DASAL.  Access to the source code
+  * contained herein is hereby forbidden to anyone except current DASAL employees,
+  * managers or contractors who have executed Confidentiality and Non-disclosure
+  * agreements explicitly covering such access.
+  *
+  *
+ ******************************************************************************
+  */
+
+
+
+/*
+ * Begin of Includes
+ */
+#include <cstdio>
+#include <unistd.h>
+#include "ds_sim_hal.hpp"
+#include "fatfs.h"
+// End of Includes
+
+
+
+/*
+ * Begin of Object Definitions
+ */
+Simulation::SD_CARD sd_card;
+// End of Object Definitions
+
+
+
+namespace Simulation
+{
+
+
+
+/**
+  * @brief Default constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+SD_CARD::SD_CARD() :
+image_fd(-1)
+{ }
+
+
+
+/**
+  * @brief 		Creates a fresh FAT volume on the card, called once after MX_FATFS_Init
+  *
+  * @param[in]  void
+  *
+  * @return 	bool
+  */
+bool SD_CARD::format( void )
+{
+	static uint8_t work_buffer[SD_FORMAT_BUFFER_SIZE];
+
+	return ( f_mkfs(SDPath, FM_ANY, 0, work_buffer, sizeof(work_buffer)) == FR_OK );
+}
+
+
+
+/**
+  * @brief 		Reads sectors from the card image
+  *
+  * @param[out] uint8_t buffer[]	: Sector data
+  * @param[in]  uint32_t sector		: First sector
+  * @param[in]  uint32_t count		: Number of sectors
+  *
+  * @return 	bool
+  */
+bool SD_CARD::readSectors( uint8_t buffer[], uint32_t sector, uint32_t count )
+{
+	const size_t length = static_cast<size_t>(count) * SD_SECTOR_SIZE;
+	const off_t	 offset = static_cast<off_t>(sector) * SD_SECTOR_SIZE;
+
+	if( (openImage() == false) || (sector + count > SD_SECTOR_COUNT) )
+	{
+		return false;
+	}
+
+	return ( pread(image_fd, buffer, length, offset) == static_cast<ssize_t>(length) );
+}
+
+
+
+/**
+  * @brief 		Writes sectors to the card image
+  *
+  * @param[in]  const uint8_t buffer[] : Sector data
+  * @param[in]  uint32_t sector		   : First sector
+  * @param[in]  uint32_t count		   : Number of sectors
+  *
+  * @return 	bool
+  */
+bool SD_CARD::writeSectors( const uint8_t buffer[], uint32_t sector, uint32_t count )
+{
+	const size_t length = static_cast<size_t>(count) * SD_SECTOR_SIZE;
+	const off_t	 offset = static_cast<off_t>(sector) * SD_SECTOR_SIZE;
+
+	if( (openImage() == false) || (sector + count > SD_SECTOR_COUNT) )
+	{
+		return false;
+	}
+
+	return ( pwrite(image_fd, buffer, length, offset) == static_cast<ssize_t>(length) );
+}
+
+
+
+/**
+  * @brief 		Opens the anonymous card image on first use
+  *
+  * @param[in]  void
+  *
+  * @return 	bool
+  */
+bool SD_CARD::openImage( void )
+{
+	std::FILE *image = nullptr;
+
+	if(image_fd >= 0)
+	{
+		return true;
+	}
+
+	image = std::tmpfile();
+	if(image == nullptr)
+	{
+		return false;
+	}
+
+	image_fd = fileno(image);
+	if(ftruncate(image_fd, static_cast<off_t>(SD_SECTOR_COUNT) * SD_SECTOR_SIZE) != 0)
+	{
+		image_fd = -1;
+		return false;
+	}
+
+	return true;
+}
+
+
+
+/**
+  * @brief Default copy constructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+SD_CARD::SD_CARD(const SD_CARD& orig)
+{
+}
+
+
+
+/**
+  * @brief Default destructor
+  *
+  * @param[in]  void
+  *
+  * @return 	void
+  */
+SD_CARD::~SD_CARD()
+{
+}
+
+
+
+} //End of namespace Simulation
+
+
+
+/*
+ * Begin of FatFs Disk Driver Functions
+ */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+
+static DSTATUS SIM_SD_initialize(BYTE lun)
+{
+	return 0;
+}
+
+
+
+static DSTATUS SIM_SD_status(BYTE lun)
+{
+	return 0;
+}
+
+
+
+static DRESULT SIM_SD_read(BYTE lun, BYTE *buff, DWORD sector, UINT count)
+{
+	return ( sd_card.readSectors(buff, sector, count) == true ) ? RES_OK : RES_ERROR;
+}
+
+
+
+static DRESULT SIM_SD_write(BYTE lun, const BYTE *buff, DWORD sector, UINT count)
+{
+	return ( sd_card.writeSectors(buff, sector, count) == true ) ? RES_OK : RES_ERROR;
+}
+
+
+
+static DRESULT SIM_SD_ioctl(BYTE lun, BYTE cmd, void *buff)
+{
+	DRESULT result = RES_OK;
+
+	switch(cmd)
+	{
+		case CTRL_SYNC :
+			break;
+		case GET_SECTOR_COUNT :
+			*static_cast<DWORD *>(buff) = Simulation::SD_SECTOR_COUNT;
+			break;
+		case GET_SECTOR_SIZE :
+			*static_cast<WORD *>(buff) = Simulation::SD_SECTOR_SIZE;
+			break;
+		case GET_BLOCK_SIZE :
+			*static_cast<DWORD *>(buff) = 1;
+			break;
+		default :
+			result = RES_PARERR;
+			break;
+	}
+
+	return result;
+}
+
+
+
+const Diskio_drvTypeDef SD_Driver =
+{
+	SIM_SD_initialize,
+	SIM_SD_status,
+	SIM_SD_read,
+	SIM_SD_write,
+	SIM_SD_ioctl,
+};
+
+
+
+uint8_t BSP_SD_IsDetected(void)
+{
+	return SD_PRESENT;
+}
+
+
+
+#ifdef __cplusplus
+}
+#endif
+// End of FatFs Disk Driver Functions